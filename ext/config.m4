@@ -377,7 +377,9 @@ if test "$PHP_PHALCON" = "yes"; then
 	phalcon/mvc/view/engine/volt/scanner.c
 	phalcon/assets/filters/jsminifier.c
 	phalcon/assets/filters/cssminifier.c
-	phalcon/mvc/url/utils.c"
+	phalcon/mvc/url/utils.c
+	phalcon/db/profiler/clock.c
+	phalcon/debug/stats.c"
 	PHP_NEW_EXTENSION(phalcon, $phalcon_sources, $ext_shared,, )
 	PHP_SUBST(PHALCON_SHARED_LIBADD)
 
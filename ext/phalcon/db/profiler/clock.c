@@ -0,0 +1,70 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+
+#ifdef PHP_WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+#ifdef __MACH__
+#include <mach/mach_time.h>
+#endif
+
+#include "phalcon/db/profiler/clock.h"
+
+double phalcon_monotonic_time(void) {
+
+#ifdef PHP_WIN32
+	LARGE_INTEGER frequency, counter;
+
+	if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
+		return (double) counter.QuadPart / (double) frequency.QuadPart;
+	}
+
+	return (double) GetTickCount() / 1000.0;
+#elif defined(__MACH__)
+	static mach_timebase_info_data_t timebase;
+
+	if (!timebase.denom) {
+		mach_timebase_info(&timebase);
+	}
+
+	return (double) mach_absolute_time() * timebase.numer / timebase.denom / 1000000000.0;
+#else
+	struct timeval tv;
+# if defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (double) ts.tv_sec + (double) ts.tv_nsec / 1000000000.0;
+	}
+# endif
+
+	gettimeofday(&tv, NULL);
+	return (double) tv.tv_sec + (double) tv.tv_usec / 1000000.0;
+#endif
+}
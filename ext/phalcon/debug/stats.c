@@ -0,0 +1,208 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef PHP_WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+#include "php.h"
+#include "php_ext.h"
+
+#include "kernel/main.h"
+#include "phalcon/debug/stats.h"
+
+#ifdef ZEPHIR_KERNEL_STATS_ENABLED
+
+/* Open addressing table indexed by the address of the called function */
+#define ZEPHIR_KERNEL_STATS_SIZE 4096
+#define ZEPHIR_KERNEL_STATS_NAME 128
+
+typedef struct _zephir_kernel_stats_entry {
+	const zend_function *function;
+	char name[ZEPHIR_KERNEL_STATS_NAME];
+	unsigned long calls;
+	unsigned long frames;
+	double time;
+} zephir_kernel_stats_entry;
+
+static zephir_kernel_stats_entry zephir_kernel_stats_table[ZEPHIR_KERNEL_STATS_SIZE];
+static unsigned long zephir_kernel_stats_used = 0;
+static unsigned long zephir_kernel_stats_dropped = 0;
+
+/* Set once the patched kernel initializes a request */
+static int zephir_kernel_stats_hooked = 0;
+
+unsigned long zephir_kernel_stats_frames = 0;
+
+static double zephir_kernel_stats_clock(void)
+{
+#ifdef PHP_WIN32
+	LARGE_INTEGER frequency, counter;
+
+	if (QueryPerformanceFrequency(&frequency) && QueryPerformanceCounter(&counter)) {
+		return (double) counter.QuadPart / (double) frequency.QuadPart;
+	}
+
+	return (double) GetTickCount() / 1000.0;
+#else
+	struct timeval tv;
+# if defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (double) ts.tv_sec + (double) ts.tv_nsec / 1000000000.0;
+	}
+# endif
+
+	gettimeofday(&tv, NULL);
+	return (double) tv.tv_sec + (double) tv.tv_usec / 1000000.0;
+#endif
+}
+
+void zephir_kernel_stats_init(void)
+{
+	zephir_kernel_stats_hooked = 1;
+	zephir_kernel_stats_reset();
+}
+
+void zephir_kernel_stats_begin(double *start, unsigned long *frames)
+{
+	*frames = zephir_kernel_stats_frames;
+	*start  = zephir_kernel_stats_clock();
+}
+
+void zephir_kernel_stats_end(double start, unsigned long frames, const zend_function *function)
+{
+	double elapsed = zephir_kernel_stats_clock() - start;
+	zephir_kernel_stats_entry *entry;
+	size_t slot, i;
+
+	/* The caller passes NULL when the handler can't be trusted after the call, as __call trampolines are freed by it */
+	if (!function) {
+		return;
+	}
+
+	slot = ((size_t) function >> 4) & (ZEPHIR_KERNEL_STATS_SIZE - 1);
+	for (i = 0; i < ZEPHIR_KERNEL_STATS_SIZE; i++) {
+
+		entry = &zephir_kernel_stats_table[(slot + i) & (ZEPHIR_KERNEL_STATS_SIZE - 1)];
+
+		if (entry->function == function) {
+			break;
+		}
+
+		if (!entry->function) {
+
+			/* Keep a free quarter so probing stays short, the rest of the calls are only counted as dropped */
+			if (zephir_kernel_stats_used >= (ZEPHIR_KERNEL_STATS_SIZE / 4) * 3) {
+				++zephir_kernel_stats_dropped;
+				return;
+			}
+
+			/* The name is copied because user functions are freed at the end of the request */
+			entry->function = function;
+			if (function->common.scope) {
+				snprintf(entry->name, ZEPHIR_KERNEL_STATS_NAME, "%s::%s", function->common.scope->name, function->common.function_name ? function->common.function_name : "{closure}");
+			} else {
+				snprintf(entry->name, ZEPHIR_KERNEL_STATS_NAME, "%s", function->common.function_name ? function->common.function_name : "{closure}");
+			}
+
+			++zephir_kernel_stats_used;
+			break;
+		}
+	}
+
+	++entry->calls;
+	entry->time   += elapsed;
+	entry->frames += zephir_kernel_stats_frames - frames;
+}
+
+#endif
+
+void zephir_kernel_stats_to_array(zval *return_value)
+{
+#ifdef ZEPHIR_KERNEL_STATS_ENABLED
+	zephir_kernel_stats_entry *entry;
+	zval *stats, **existing, **value;
+	size_t i;
+
+	if (!zephir_kernel_stats_hooked) {
+		RETURN_NULL();
+	}
+
+	array_init(return_value);
+
+	for (i = 0; i < ZEPHIR_KERNEL_STATS_SIZE; i++) {
+
+		entry = &zephir_kernel_stats_table[i];
+		if (!entry->function) {
+			continue;
+		}
+
+		/* Different functions with the same name (closures, truncated names) are merged */
+		if (zend_hash_find(Z_ARRVAL_P(return_value), entry->name, strlen(entry->name) + 1, (void **) &existing) == SUCCESS) {
+			if (zend_hash_find(Z_ARRVAL_PP(existing), "calls", sizeof("calls"), (void **) &value) == SUCCESS) {
+				Z_LVAL_PP(value) += entry->calls;
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(existing), "time", sizeof("time"), (void **) &value) == SUCCESS) {
+				Z_DVAL_PP(value) += entry->time;
+			}
+			if (zend_hash_find(Z_ARRVAL_PP(existing), "frames", sizeof("frames"), (void **) &value) == SUCCESS) {
+				Z_LVAL_PP(value) += entry->frames;
+			}
+			continue;
+		}
+
+		MAKE_STD_ZVAL(stats);
+		array_init_size(stats, 3);
+		add_assoc_long(stats, "calls", entry->calls);
+		add_assoc_double(stats, "time", entry->time);
+		add_assoc_long(stats, "frames", entry->frames);
+		add_assoc_zval_ex(return_value, entry->name, strlen(entry->name) + 1, stats);
+	}
+
+	if (zephir_kernel_stats_dropped) {
+		MAKE_STD_ZVAL(stats);
+		array_init_size(stats, 3);
+		add_assoc_long(stats, "calls", zephir_kernel_stats_dropped);
+		add_assoc_double(stats, "time", 0);
+		add_assoc_long(stats, "frames", 0);
+		add_assoc_zval_ex(return_value, "{dropped}", sizeof("{dropped}"), stats);
+	}
+#else
+	RETURN_FALSE;
+#endif
+}
+
+void zephir_kernel_stats_reset(void)
+{
+#ifdef ZEPHIR_KERNEL_STATS_ENABLED
+	memset(zephir_kernel_stats_table, 0, sizeof(zephir_kernel_stats_table));
+	zephir_kernel_stats_used    = 0;
+	zephir_kernel_stats_dropped = 0;
+	zephir_kernel_stats_frames  = 0;
+#endif
+}
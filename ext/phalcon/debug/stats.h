@@ -0,0 +1,51 @@
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+#ifndef PHALCON_DEBUG_STATS_H
+#define PHALCON_DEBUG_STATS_H
+
+#include <php.h>
+#include <Zend/zend.h>
+
+/**
+ * Call counters are only compiled in when ZEPHIR_KERNEL_STATS is defined (CFLAGS="-DZEPHIR_KERNEL_STATS"),
+ * the table is process wide so thread safe builds don't collect them. The kernel copied by zephir
+ * doesn't call them until build/kernel-stats adds its hooks to ext/kernel/fcall.c and ext/kernel/memory.c
+ */
+#if defined(ZEPHIR_KERNEL_STATS) && !defined(ZTS)
+# define ZEPHIR_KERNEL_STATS_ENABLED 1
+#endif
+
+#ifdef ZEPHIR_KERNEL_STATS_ENABLED
+
+/* Memory frames grown by the kernel */
+extern unsigned long zephir_kernel_stats_frames;
+
+/* Hooks called by the patched kernel */
+void zephir_kernel_stats_init(void);
+void zephir_kernel_stats_begin(double *start, unsigned long *frames);
+void zephir_kernel_stats_end(double start, unsigned long frames, const zend_function *function);
+
+#endif
+
+/* Exports the counters as an array indexed by "Class::method", false if they weren't compiled in and null if the kernel wasn't patched */
+void zephir_kernel_stats_to_array(zval *return_value);
+void zephir_kernel_stats_reset(void);
+
+#endif /* PHALCON_DEBUG_STATS_H */
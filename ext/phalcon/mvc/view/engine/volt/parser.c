@@ -129,7 +129,7 @@ static zval *phvolt_ret_for_statement(phvolt_parser_token *variable, phvolt_pars
 	return ret;
 }
 
-static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *block_statements, phvolt_scanner_state *state)
+static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *tags, zval *block_statements, phvolt_scanner_state *state)
 {
 	zval *ret;
 
@@ -142,6 +142,10 @@ static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *block_
 	if (lifetime) {
 		add_assoc_zval(ret, "lifetime", lifetime);
 	}
+
+	if (tags) {
+		add_assoc_zval(ret, "tags", tags);
+	}
 	add_assoc_zval(ret, "block_statements", block_statements);
 
 	Z_ADDREF_P(state->active_file);
@@ -151,6 +155,39 @@ static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *block_
 	return ret;
 }
 
+static zval *phvolt_ret_cache_tags(phvolt_parser_token *T, zval *tags, phvolt_parser_status *status)
+{
+	/* The keyword is scanned as an identifier, anything else than 'tags' is a syntax error */
+	if (T->token_len != sizeof("tags") - 1 || memcmp(T->token, "tags", sizeof("tags") - 1)) {
+
+		smart_str error_str = {0};
+
+		smart_str_appendl(&error_str, "Syntax error, unexpected token IDENTIFIER(", sizeof("Syntax error, unexpected token IDENTIFIER(") - 1);
+		smart_str_appendl(&error_str, T->token, T->token_len);
+		smart_str_appendl(&error_str, ") in ", sizeof(") in ") - 1);
+		smart_str_appendl(&error_str, Z_STRVAL_P(status->scanner_state->active_file), Z_STRLEN_P(status->scanner_state->active_file));
+		smart_str_appendl(&error_str, " on line ", sizeof(" on line ") - 1);
+		{
+			char stmp[MAX_LENGTH_OF_LONG + 1];
+			int str_len;
+			str_len = slprintf(stmp, sizeof(stmp), "%ld", status->scanner_state->active_line);
+			smart_str_appendl(&error_str, stmp, str_len);
+		}
+		smart_str_0(&error_str);
+
+		status->syntax_error = error_str.c;
+		status->syntax_error_len = error_str.len;
+		status->status = PHVOLT_PARSING_FAILED;
+	}
+
+	if (T->free_flag) {
+		efree(T->token);
+	}
+	efree(T);
+
+	return tags;
+}
+
 static zval *phvolt_ret_raw_statement(zval *statement, phvolt_scanner_state *state)
 {
 	zval *ret;
@@ -296,7 +333,7 @@ static zval *phvolt_ret_extends_statement(zval *path, phvolt_scanner_state *stat
 	array_init_size(ret, 4);
 
 	add_assoc_long(ret, "type", PHVOLT_T_EXTENDS);
-	add_assoc_zval(ret, "path", path);	
+	add_assoc_zval(ret, "path", path);
 
 	Z_ADDREF_P(state->active_file);
 	add_assoc_zval(ret, "file", state->active_file);
@@ -580,7 +617,7 @@ static zval *phvolt_ret_macro_call_statement(zval *expr, zval *arguments, zval *
 }
 
 
-// 584 "parser.c"
+// 621 "parser.c"
 /* Next is all token values, in a form suitable for use by makeheaders.
 ** This section will be null unless lemon is run with the -m switch.
 */
@@ -630,23 +667,23 @@ static zval *phvolt_ret_macro_call_statement(zval *expr, zval *arguments, zval *
 **                       defined, then do no error processing.
 */
 #define VVCODETYPE unsigned char
-#define VVNOCODE 125
+#define VVNOCODE 126
 #define VVACTIONTYPE unsigned short int
 #define phvolt_TOKENTYPE phvolt_parser_token*
 typedef union {
   phvolt_TOKENTYPE vv0;
-  zval* vv40;
-  int vv249;
+  zval* vv158;
+  int vv251;
 } VVMINORTYPE;
 #define VVSTACKDEPTH 100
 #define phvolt_ARG_SDECL phvolt_parser_status *status;
 #define phvolt_ARG_PDECL ,phvolt_parser_status *status
 #define phvolt_ARG_FETCH phvolt_parser_status *status = vvpParser->status
 #define phvolt_ARG_STORE vvpParser->status = status
-#define VVNSTATE 348
-#define VVNRULE 152
+#define VVNSTATE 362
+#define VVNRULE 155
 #define VVERRORSYMBOL 85
-#define VVERRSYMDT vv249
+#define VVERRSYMDT vv251
 #define VV_NO_ACTION      (VVNSTATE+VVNRULE+2)
 #define VV_ACCEPT_ACTION  (VVNSTATE+VVNRULE+1)
 #define VV_ERROR_ACTION   (VVNSTATE+VVNRULE)
@@ -701,581 +738,625 @@ typedef union {
 static VVACTIONTYPE vv_action[] = {
  /*     0 */    83,   93,  109,   61,   53,   55,   67,   63,   65,   73,
  /*    10 */    75,   77,   79,   69,   71,   49,   47,   51,   44,   41,
- /*    20 */    57,   90,   59,   85,   88,   89,   97,   81,   86,  231,
- /*    30 */    85,   88,   89,   97,   81,  286,   44,   41,   57,   90,
- /*    40 */    59,   85,   88,   89,   97,   81,  108,  285,  180,  201,
+ /*    20 */    57,   90,   59,   85,   88,   89,   97,   81,  362,  231,
+ /*    30 */    85,   88,   89,   97,   81,  300,   44,   41,   57,   90,
+ /*    40 */    59,   85,   88,   89,   97,   81,  108,  291,  180,  201,
  /*    50 */   184,   83,   93,  182,   61,   53,   55,   67,   63,   65,
  /*    60 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*    70 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  223,
- /*    80 */   251,   83,   93,  181,   61,   53,   55,   67,   63,   65,
+ /*    70 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  328,
+ /*    80 */   174,   83,   93,  181,   61,   53,   55,   67,   63,   65,
  /*    90 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   100 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  314,
- /*   110 */   174,  321,  172,   37,   83,   93,  252,   61,   53,   55,
- /*   120 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
- /*   130 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   140 */    97,   81,  330,  325,   83,   93,  228,   61,   53,   55,
+ /*   100 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   31,
+ /*   110 */   251,   83,   93,   33,   61,   53,   55,   67,   63,   65,
+ /*   120 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
+ /*   130 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  344,
+ /*   140 */   339,  335,  172,   37,   83,   93,  252,   61,   53,   55,
  /*   150 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
  /*   160 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   170 */    97,   81,  279,  260,   83,   93,   95,   61,   53,   55,
+ /*   170 */    97,   81,   86,   27,   83,   93,  137,   61,   53,   55,
  /*   180 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
  /*   190 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   200 */    97,   81,   83,   93,  302,   61,   53,   55,   67,   63,
- /*   210 */    65,   73,   75,   77,   79,   69,   71,   49,   47,   51,
- /*   220 */    44,   41,   57,   90,   59,   85,   88,   89,   97,   81,
- /*   230 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   240 */    89,   97,   81,  304,  295,  313,  199,  103,  109,  346,
- /*   250 */   296,   83,   93,  205,   61,   53,   55,   67,   63,   65,
+ /*   200 */    97,   81,  129,   40,   83,   93,  138,   61,   53,   55,
+ /*   210 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
+ /*   220 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
+ /*   230 */    97,   81,   49,   47,   51,   44,   41,   57,   90,   59,
+ /*   240 */    85,   88,   89,   97,   81,  109,  116,   92,  128,  183,
+ /*   250 */   184,   83,   93,   95,   61,   53,   55,   67,   63,   65,
  /*   260 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   270 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  129,
- /*   280 */   316,   83,   93,  145,   61,   53,   55,   67,   63,   65,
- /*   290 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   300 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   90,
- /*   310 */    59,   85,   88,   89,   97,   81,  307,  308,  309,  310,
- /*   320 */   311,  312,  183,  184,   92,  215,  262,  273,   83,   93,
- /*   330 */   113,   61,   53,   55,   67,   63,   65,   73,   75,   77,
+ /*   270 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   83,
+ /*   280 */    93,  497,   61,   53,   55,   67,   63,   65,   73,   75,
+ /*   290 */    77,   79,   69,   71,   49,   47,   51,   44,   41,   57,
+ /*   300 */    90,   59,   85,   88,   89,   97,   81,   90,   59,   85,
+ /*   310 */    88,   89,   97,   81,  321,  322,  323,  324,  325,  326,
+ /*   320 */   309,  327,  279,  285,  103,  262,  273,  113,   83,   93,
+ /*   330 */   498,   61,   53,   55,   67,   63,   65,   73,   75,   77,
  /*   340 */    79,   69,   71,   49,   47,   51,   44,   41,   57,   90,
- /*   350 */    59,   85,   88,   89,   97,   81,  140,  140,  224,  271,
- /*   360 */   284,   56,   91,  235,  143,  102,  216,  344,  139,  139,
- /*   370 */   414,  197,  141,  118,  118,   83,   93,  118,   61,   53,
+ /*   350 */    59,   85,   88,   89,   97,   81,  140,  140,  132,  133,
+ /*   360 */   186,  188,  142,  144,  143,  497,  145,  318,  139,  139,
+ /*   370 */   498,  197,  118,  118,  118,   83,   93,  205,   61,   53,
  /*   380 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
  /*   390 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   400 */    89,   97,   81,  171,   40,   83,   93,  415,   61,   53,
- /*   410 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
- /*   420 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   430 */    89,   97,   81,  237,   27,   83,   93,  481,   61,   53,
- /*   440 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
- /*   450 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   460 */    89,   97,   81,   83,   93,  320,   61,   53,   55,   67,
+ /*   400 */    89,   97,   81,   83,   93,  169,   61,   53,   55,   67,
+ /*   410 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   420 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   430 */    81,  240,  248,   83,   93,  171,   61,   53,   55,   67,
+ /*   440 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   450 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   460 */    81,  178,  254,   83,   93,  199,   61,   53,   55,   67,
  /*   470 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   480 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   490 */    81,  240,  332,   83,   93,  289,   61,   53,   55,   67,
+ /*   490 */    81,  200,  257,   83,   93,  203,   61,   53,   55,   67,
  /*   500 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   510 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   520 */    81,  200,  248,   83,   93,  169,   61,   53,   55,   67,
+ /*   520 */    81,  204,  260,   83,   93,  206,   61,   53,   55,   67,
  /*   530 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   540 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   550 */    81,  291,  254,   83,   93,  280,   61,   53,   55,   67,
+ /*   550 */    81,  210,  430,   83,   93,  216,   61,   53,   55,   67,
  /*   560 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   570 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   580 */    81,  339,  257,   83,   93,  292,   61,   53,   55,   67,
+ /*   580 */    81,  220,  330,   83,   93,  223,   61,   53,   55,   67,
  /*   590 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
- /*   600 */    51,   44,   41,   57,   90,   59,   85,   88,   89,  213,
- /*   610 */    81,   83,   93,  293,   61,   53,   55,   67,   63,   65,
- /*   620 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   630 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   93,
- /*   640 */   322,   61,   53,   55,   67,   63,   65,   73,   75,   77,
- /*   650 */    79,   69,   71,   49,   47,   51,   44,   41,   57,   90,
- /*   660 */    59,   85,   88,   89,   97,   81,   61,   53,   55,   67,
- /*   670 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
- /*   680 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   690 */    81,   53,   55,   67,   63,   65,   73,   75,   77,   79,
- /*   700 */    69,   71,   49,   47,   51,   44,   41,   57,   90,   59,
- /*   710 */    85,   88,   89,   97,   81,  501,    1,    2,  272,    4,
- /*   720 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   730 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   28,
- /*   740 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
- /*   750 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   760 */    23,  207,  272,    4,    5,    6,    7,    8,    9,   10,
- /*   770 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*   780 */    21,   22,   23,   67,   63,   65,   73,   75,   77,   79,
- /*   790 */    69,   71,   49,   47,   51,   44,   41,   57,   90,   59,
- /*   800 */    85,   88,   89,   97,   81,  232,  272,    4,    5,    6,
- /*   810 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*   820 */    17,   18,   19,   20,   21,   22,   23,  264,  272,    4,
- /*   830 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   840 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  217,
- /*   850 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
- /*   860 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   870 */    23,  281,  272,    4,    5,    6,    7,    8,    9,   10,
- /*   880 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*   890 */    21,   22,   23,  275,  272,    4,    5,    6,    7,    8,
- /*   900 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*   910 */    19,   20,   21,   22,   23,  333,  272,    4,    5,    6,
- /*   920 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*   930 */    17,   18,   19,   20,   21,   22,   23,  175,  272,    4,
- /*   940 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   950 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  298,
- /*   960 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
- /*   970 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   980 */    23,  317,  272,    4,    5,    6,    7,    8,    9,   10,
- /*   990 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*  1000 */    21,   22,   23,  326,  272,    4,    5,    6,    7,    8,
- /*  1010 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*  1020 */    19,   20,   21,   22,   23,   34,  272,    4,    5,    6,
- /*  1030 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*  1040 */    17,   18,   19,   20,   21,   22,   23,  225,  272,    4,
- /*  1050 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*  1060 */    15,   16,   17,   18,   19,   20,   21,   22,   23,    3,
- /*  1070 */     4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
- /*  1080 */    14,   15,   16,   17,   18,   19,   20,   21,   22,   23,
- /*  1090 */   241,    4,    5,    6,    7,    8,    9,   10,   11,   12,
- /*  1100 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*  1110 */    23,   25,  221,  341,  343,   38,  168,  170,   98,  294,
- /*  1120 */   179,  349,   24,  105,  480,  127,   98,  202,  242,   24,
- /*  1130 */   118,  135,  107,  214,  114,  118,  211,  340,  118,  135,
- /*  1140 */   222,  263,  229,   26,  236,  105,  246,  249,  167,  255,
- /*  1150 */   258,  261,  196,  268,  270,  118,  126,  118,   45,   42,
- /*  1160 */   118,  104,   70,   99,  118,   29,  101,  243,   45,   42,
- /*  1170 */   117,  104,  105,   99,  118,  119,  101,  323,  297,  238,
- /*  1180 */   336,  112,  118,  114,  118,  119,  238,  120,  121,  122,
- /*  1190 */   123,  124,  125,   98,  238,  239,  245,  120,  121,  122,
- /*  1200 */   123,  124,  125,  245,  337,  118,  130,  118,  176,   68,
- /*  1210 */   345,  245,  129,  155,  156,  157,  158,  159,  160,  161,
- /*  1220 */   110,  118,  238,  148,  149,  150,  151,  152,  153,  154,
- /*  1230 */   110,   25,  221,   30,   32,   38,  168,  170,  244,  245,
- /*  1240 */   179,   58,  173,  247,  348,   54,  203,  202,  204,  301,
- /*  1250 */   481,  304,  342,  118,  118,  118,  211,  118,  128,   31,
- /*  1260 */   222,  238,  229,   35,  236,  238,  246,  249,  208,  255,
- /*  1270 */   258,  261,  218,  268,  270,   33,  303,  250,  245,   25,
- /*  1280 */   221,  195,  245,   38,  168,  170,  206,  198,  179,  118,
- /*  1290 */   287,  137,  305,   72,   39,  202,  144,  306,  185,  187,
- /*  1300 */   189,  191,  193,  116,  211,  118,  118,  138,  222,  227,
- /*  1310 */   229,  226,  236,  178,  246,  249,  233,  255,  258,  261,
- /*  1320 */   238,  268,  270,  347,  220,  238,  274,   25,  221,  238,
- /*  1330 */   132,   38,  168,  170,  210,  265,  179,  245,  276,  253,
- /*  1340 */   267,  212,  245,  202,  142,  256,  245,  238,  282,  480,
- /*  1350 */   329,  118,  211,  118,  278,  269,  222,  118,  229,  234,
- /*  1360 */   236,  278,  246,  249,  245,  255,  258,  261,  238,  268,
- /*  1370 */   270,  278,  278,  238,  278,   25,  221,   36,  278,   38,
- /*  1380 */   168,  170,  278,  299,  179,  245,  318,  278,  278,   64,
- /*  1390 */   245,  202,  238,  278,  327,  238,  334,  278,  278,  278,
- /*  1400 */   211,  118,  278,  278,  222,  238,  229,  278,  236,  245,
- /*  1410 */   246,  249,  245,  255,  258,  261,  278,  268,  270,  278,
- /*  1420 */   278,  163,  245,   25,  221,  278,  315,   38,  168,  170,
- /*  1430 */   259,  335,  179,  118,  278,  278,  278,  278,  118,  202,
- /*  1440 */   238,  278,  118,  238,  278,  278,  278,  278,  211,  278,
- /*  1450 */   278,  238,  222,  238,  229,  278,  236,  245,  246,  249,
- /*  1460 */   245,  255,  258,  261,  278,  268,  270,   76,  245,   66,
- /*  1470 */   245,   25,  221,   62,  324,   38,  168,  170,  165,  118,
- /*  1480 */   179,  118,  278,  278,  278,  118,  118,  202,  278,  278,
- /*  1490 */   118,   52,  278,  278,  278,  278,  211,  219,  278,  278,
- /*  1500 */   222,  278,  229,  118,  236,  278,  246,  249,  278,  255,
- /*  1510 */   258,  261,  278,  268,  270,  186,  278,  133,  278,   25,
- /*  1520 */   221,   50,  331,   38,  168,  170,  188,  118,  179,  118,
- /*  1530 */   278,  278,  278,  118,  118,  202,  278,   60,  118,  278,
- /*  1540 */   278,   87,  278,  278,  211,  278,  278,  278,  222,  118,
- /*  1550 */   229,  283,  236,  118,  246,  249,  278,  255,  258,  261,
- /*  1560 */   278,  268,  270,   48,  278,  190,  278,   25,  221,   46,
- /*  1570 */   192,   38,  168,  170,  166,  118,  179,  118,   94,   84,
- /*  1580 */   278,  118,  118,  202,  278,   96,  118,  230,  278,   74,
- /*  1590 */   118,  118,  211,  278,  278,  278,  222,  118,  229,  118,
- /*  1600 */   236,  118,  246,  249,  278,  255,  258,  261,  277,  268,
- /*  1610 */   270,   82,  278,   80,  194,   25,  221,  338,  100,   38,
- /*  1620 */   168,  170,   78,  118,  179,  118,  118,  278,  278,  278,
- /*  1630 */   118,  202,  278,   43,  118,  278,  278,  278,  278,  278,
- /*  1640 */   211,  278,  278,  278,  222,  118,  229,  278,  236,  278,
- /*  1650 */   246,  249,  278,  255,  258,  261,  278,  268,  270,  278,
- /*  1660 */   278,  278,  278,   25,  221,  278,  278,   38,  168,  170,
- /*  1670 */   278,  278,  179,  278,  278,  278,  278,  278,  278,  202,
- /*  1680 */   278,  209,  278,  278,  278,  278,  278,  278,  211,  278,
- /*  1690 */   278,  278,  222,  278,  229,  278,  236,  278,  246,  249,
- /*  1700 */   278,  255,  258,  261,  278,  268,  270,  278,  278,  278,
- /*  1710 */   278,   25,  221,  278,  278,   38,  168,  170,  278,  278,
- /*  1720 */   179,  278,  278,  278,  278,  278,  278,  202,  278,  278,
- /*  1730 */   278,  278,  278,  278,  278,  278,  211,  278,  278,  278,
- /*  1740 */   222,  288,  229,  278,  236,  278,  246,  249,  278,  255,
- /*  1750 */   258,  261,  278,  268,  270,  278,  278,  278,  278,   25,
- /*  1760 */   221,  278,  278,   38,  168,  170,  278,  278,  179,  278,
- /*  1770 */   278,  278,  278,  278,  278,  202,  278,  278,  278,  278,
- /*  1780 */   278,  278,  278,  278,  211,  278,  278,  278,  222,  278,
- /*  1790 */   229,  278,  236,  278,  246,  249,  278,  255,  258,  261,
- /*  1800 */   266,  268,  270,  278,  278,  278,  278,   25,  221,  278,
- /*  1810 */   278,   38,  168,  170,  278,  328,  179,  278,  278,  278,
- /*  1820 */   278,  278,  278,  202,  278,  278,  278,  278,  278,  278,
- /*  1830 */   278,  278,  211,  278,  278,  278,  222,  278,  229,  278,
- /*  1840 */   236,  278,  246,  249,  278,  255,  258,  261,  278,  268,
- /*  1850 */   270,  278,  278,  278,  278,   25,  221,  278,  278,   38,
- /*  1860 */   168,  170,  278,  278,  179,  278,  278,  278,  278,  278,
- /*  1870 */   278,  202,  278,  300,  278,  278,  278,  278,  278,  278,
- /*  1880 */   211,  278,  278,  278,  222,  278,  229,  278,  236,  278,
- /*  1890 */   246,  249,  278,  255,  258,  261,  278,  268,  270,  278,
- /*  1900 */   278,  278,  278,   25,  221,  278,  278,   38,  168,  170,
- /*  1910 */   278,  177,  179,  278,  278,  278,  278,  278,  278,  202,
- /*  1920 */   278,  278,  278,  278,  278,  278,  278,  278,  211,  278,
- /*  1930 */   278,  278,  222,  278,  229,  278,  236,  278,  246,  249,
- /*  1940 */   278,  255,  258,  261,  278,  268,  270,  278,  278,  278,
- /*  1950 */   278,   25,  221,  278,  278,   38,  168,  170,  278,  319,
- /*  1960 */   179,  278,  278,  278,  278,  278,  278,  202,  278,  278,
- /*  1970 */   278,  278,  278,  278,  278,  278,  211,  278,  278,  278,
- /*  1980 */   222,  278,  229,  278,  236,  278,  246,  249,  278,  255,
- /*  1990 */   258,  261,  278,  268,  270,  278,  278,  278,  278,   25,
- /*  2000 */   221,  278,  278,   38,  168,  170,  278,  278,  179,  278,
- /*  2010 */   278,  278,  278,  278,  278,  202,  278,  278,  278,  278,
- /*  2020 */   278,  278,  278,  278,  211,  278,  278,  278,  222,  278,
- /*  2030 */   229,  278,  236,  278,  246,  249,  278,  255,  258,  261,
- /*  2040 */   278,  268,  270,  278,  164,  278,   45,   42,  278,  104,
- /*  2050 */   136,   99,  278,  162,  101,  278,   45,   42,  278,  104,
- /*  2060 */   278,   99,  278,  119,  101,  278,   45,   42,  278,  104,
- /*  2070 */   278,   99,  278,  119,  101,  120,  121,  122,  123,  124,
- /*  2080 */   125,  278,  278,  147,  278,  120,  121,  122,  123,  124,
- /*  2090 */   125,  278,  278,  278,  278,  146,  121,  122,  123,  124,
- /*  2100 */   125,  278,   45,   42,  278,  104,  278,   99,  110,  278,
- /*  2110 */   101,  278,   45,   42,  278,  104,  278,   99,  110,  119,
- /*  2120 */   101,  278,  278,  278,  278,  278,  278,  106,  110,  119,
- /*  2130 */   278,  120,  115,  122,  123,  124,  125,  278,  278,  134,
- /*  2140 */   278,  120,  131,  122,  123,  124,  125,  278,  278,   45,
- /*  2150 */    42,  278,  104,  278,   99,   45,   42,  101,  104,  278,
- /*  2160 */    99,  278,  278,  101,  110,  278,  119,  278,  278,  278,
- /*  2170 */   278,  278,  119,  278,  110,  278,  290,  278,  120,  131,
- /*  2180 */   122,  123,  124,  125,  120,  115,  122,  123,  124,  125,
- /*  2190 */   278,  278,  278,  278,  278,  278,   45,   42,  278,  104,
- /*  2200 */   278,   99,   45,   42,  101,  104,  278,   99,  278,  278,
- /*  2210 */   101,  110,  278,  119,  278,  278,  278,  110,  111,  119,
- /*  2220 */   278,  278,  278,  278,  278,  120,  121,  122,  123,  124,
- /*  2230 */   125,  120,  115,  122,  123,  124,  125,  278,  278,   45,
- /*  2240 */    42,  278,  104,  278,   99,  278,  278,  101,  278,  278,
- /*  2250 */   278,  278,  278,  278,  278,  278,  119,  278,  110,  278,
- /*  2260 */   278,  278,  278,  278,  110,  278,  278,  278,  120,  131,
- /*  2270 */   122,  123,  124,  125,  278,  278,  278,  278,  278,  278,
- /*  2280 */   278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
- /*  2290 */   278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
- /*  2300 */   278,  110,
+ /*   600 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   610 */    81,  224,  346,   83,   93,  228,   61,   53,   55,   67,
+ /*   620 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   630 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   640 */    81,   83,   93,  235,   61,   53,   55,   67,   63,   65,
+ /*   650 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
+ /*   660 */    41,   57,   90,   59,   85,   88,   89,  213,   81,   93,
+ /*   670 */   242,   61,   53,   55,   67,   63,   65,   73,   75,   77,
+ /*   680 */    79,   69,   71,   49,   47,   51,   44,   41,   57,   90,
+ /*   690 */    59,   85,   88,   89,   97,   81,   61,   53,   55,   67,
+ /*   700 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   710 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   720 */    81,  518,    1,    2,  272,    4,    5,    6,    7,    8,
+ /*   730 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*   740 */    19,   20,   21,   22,   23,   53,   55,   67,   63,   65,
+ /*   750 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
+ /*   760 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   28,
+ /*   770 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+ /*   780 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
+ /*   790 */    23,   34,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*   800 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*   810 */    21,   22,   23,   67,   63,   65,   73,   75,   77,   79,
+ /*   820 */    69,   71,   49,   47,   51,   44,   41,   57,   90,   59,
+ /*   830 */    85,   88,   89,   97,   81,  175,  272,    4,    5,    6,
+ /*   840 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
+ /*   850 */    17,   18,   19,   20,   21,   22,   23,  207,  272,    4,
+ /*   860 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   870 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  217,
+ /*   880 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+ /*   890 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
+ /*   900 */    23,  225,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*   910 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*   920 */    21,   22,   23,  232,  272,    4,    5,    6,    7,    8,
+ /*   930 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*   940 */    19,   20,   21,   22,   23,  264,  272,    4,    5,    6,
+ /*   950 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
+ /*   960 */    17,   18,   19,   20,   21,   22,   23,  275,  272,    4,
+ /*   970 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   980 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  281,
+ /*   990 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+ /*  1000 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
+ /*  1010 */    23,  287,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*  1020 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*  1030 */    21,   22,   23,  294,  272,    4,    5,    6,    7,    8,
+ /*  1040 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*  1050 */    19,   20,   21,   22,   23,  312,  272,    4,    5,    6,
+ /*  1060 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
+ /*  1070 */    17,   18,   19,   20,   21,   22,   23,  331,  272,    4,
+ /*  1080 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*  1090 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  340,
+ /*  1100 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+ /*  1110 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
+ /*  1120 */    23,  347,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*  1130 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*  1140 */    21,   22,   23,    3,    4,    5,    6,    7,    8,    9,
+ /*  1150 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*  1160 */    20,   21,   22,   23,  241,    4,    5,    6,    7,    8,
+ /*  1170 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*  1180 */    19,   20,   21,   22,   23,   25,  221,   30,   32,   38,
+ /*  1190 */   168,  170,   98,  237,  179,  363,   24,  431,   91,  127,
+ /*  1200 */   105,  202,   26,  298,  243,  118,  135,  244,  263,  141,
+ /*  1210 */   211,  118,  126,  118,  222,  118,  229,   98,  236,  267,
+ /*  1220 */   246,  249,  269,  255,  258,  261,  105,  268,  270,  271,
+ /*  1230 */   118,  130,   45,   42,  292,  104,  107,   99,  114,  118,
+ /*  1240 */   101,  274,   45,   42,  105,  104,  278,   99,  280,  119,
+ /*  1250 */   101,  284,  286,  238,  112,   39,  114,  118,   24,  119,
+ /*  1260 */   290,  120,  121,  122,  123,  124,  125,  167,  118,   43,
+ /*  1270 */   245,  120,  121,  122,  123,  124,  125,  293,  354,  297,
+ /*  1280 */   118,  129,  118,  166,  303,  316,  305,  155,  156,  157,
+ /*  1290 */   158,  159,  160,  161,  110,  306,  118,  148,  149,  150,
+ /*  1300 */   151,  152,  153,  154,  110,   25,  221,  355,  357,   38,
+ /*  1310 */   168,  170,   98,   29,  179,  238,  351,  307,  308,  214,
+ /*  1320 */    46,  202,  318,  311,  315,  118,  135,  215,  317,  319,
+ /*  1330 */   211,  310,  245,  118,  222,  238,  229,   35,  236,  320,
+ /*  1340 */   246,  249,  176,  255,  258,  261,  208,  268,  270,  334,
+ /*  1350 */    48,  336,  245,   25,  221,   36,  343,   38,  168,  170,
+ /*  1360 */   350,  218,  179,  118,  301,  337,   50,  353,   52,  202,
+ /*  1370 */   238,  356,  226,  238,  233,  358,  359,  360,  211,  118,
+ /*  1380 */   361,  118,  222,  282,  229,   54,  236,  245,  246,  249,
+ /*  1390 */   245,  255,  258,  261,  238,  268,  270,  282,  118,  238,
+ /*  1400 */    56,   25,  221,  238,  282,   38,  168,  170,  282,  177,
+ /*  1410 */   179,  245,   58,  118,   60,   62,  245,  202,  238,  282,
+ /*  1420 */   245,  238,  265,  282,  282,  118,  211,  118,  118,  238,
+ /*  1430 */   222,  238,  229,  276,  236,  245,  246,  249,  245,  255,
+ /*  1440 */   258,  261,  282,  268,  270,  282,  245,  282,  245,   25,
+ /*  1450 */   221,  195,  282,   38,  168,  170,  282,  198,  179,  282,
+ /*  1460 */   288,  282,  282,   64,   66,  202,  282,  209,  185,  187,
+ /*  1470 */   189,  191,  193,  282,  211,  282,  118,  118,  222,  238,
+ /*  1480 */   229,  295,  236,  282,  246,  249,  313,  255,  258,  261,
+ /*  1490 */   238,  268,  270,  282,  282,  282,  245,   25,  221,  238,
+ /*  1500 */   282,   38,  168,  170,  282,  332,  179,  245,  341,  282,
+ /*  1510 */   282,   68,   70,  202,   72,  282,  245,  238,   74,  282,
+ /*  1520 */   282,  282,  211,  219,  118,  118,  222,  118,  229,   76,
+ /*  1530 */   236,  118,  246,  249,  245,  255,  258,  261,  238,  268,
+ /*  1540 */   270,  282,  118,  238,   78,   25,  221,  348,  282,   38,
+ /*  1550 */   168,  170,  282,   80,  179,  245,  282,  118,  282,   82,
+ /*  1560 */   245,  202,  238,  282,   84,  238,  118,  282,  282,  282,
+ /*  1570 */   211,  282,  118,  282,  222,  227,  229,  118,  236,  245,
+ /*  1580 */   246,  249,  245,  255,  258,  261,  282,  268,  270,  282,
+ /*  1590 */   282,  282,   87,   25,  221,  282,  282,   38,  168,  170,
+ /*  1600 */    94,   96,  179,  100,  238,  118,  282,  102,  282,  202,
+ /*  1610 */   117,  282,  282,  118,  118,  282,  118,  282,  211,  282,
+ /*  1620 */   118,  245,  222,  118,  229,  234,  236,  163,  246,  249,
+ /*  1630 */   282,  255,  258,  261,  282,  268,  270,  282,  165,  173,
+ /*  1640 */   118,   25,  221,  190,  282,   38,  168,  170,  192,  194,
+ /*  1650 */   179,  118,  118,  282,  196,  212,  118,  202,  230,  282,
+ /*  1660 */   239,  118,  118,  282,  282,  247,  211,  118,  118,  282,
+ /*  1670 */   222,  118,  229,  118,  236,  250,  246,  249,  118,  255,
+ /*  1680 */   258,  261,  266,  268,  270,  282,  253,  256,  118,   25,
+ /*  1690 */   221,  259,  282,   38,  168,  170,  299,  282,  179,  118,
+ /*  1700 */   118,  282,  282,  329,  118,  202,  282,  282,  338,  118,
+ /*  1710 */   345,  282,  282,  282,  211,  282,  118,  282,  222,  282,
+ /*  1720 */   229,  118,  236,  118,  246,  249,  282,  255,  258,  261,
+ /*  1730 */   277,  268,  270,  282,  282,  282,  282,   25,  221,  282,
+ /*  1740 */   282,   38,  168,  170,  282,  282,  179,  282,  282,  282,
+ /*  1750 */   282,  282,  282,  202,  282,  282,  282,  282,  282,  282,
+ /*  1760 */   282,  282,  211,  282,  282,  282,  222,  282,  229,  283,
+ /*  1770 */   236,  282,  246,  249,  282,  255,  258,  261,  282,  268,
+ /*  1780 */   270,  282,  282,  282,  282,   25,  221,  282,  282,   38,
+ /*  1790 */   168,  170,  282,  282,  179,  282,  282,  282,  282,  282,
+ /*  1800 */   282,  202,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  1810 */   211,  282,  282,  282,  222,  282,  229,  289,  236,  282,
+ /*  1820 */   246,  249,  282,  255,  258,  261,  282,  268,  270,  282,
+ /*  1830 */   282,  282,  282,   25,  221,  282,  282,   38,  168,  170,
+ /*  1840 */   282,  282,  179,  282,  282,  282,  282,  282,  282,  202,
+ /*  1850 */   282,  282,  282,  282,  282,  282,  282,  282,  211,  282,
+ /*  1860 */   282,  282,  222,  282,  229,  296,  236,  282,  246,  249,
+ /*  1870 */   282,  255,  258,  261,  282,  268,  270,  282,  282,  282,
+ /*  1880 */   282,   25,  221,  282,  282,   38,  168,  170,  282,  282,
+ /*  1890 */   179,  282,  282,  282,  282,  282,  282,  202,  282,  282,
+ /*  1900 */   282,  282,  282,  282,  282,  282,  211,  282,  282,  282,
+ /*  1910 */   222,  302,  229,  282,  236,  282,  246,  249,  282,  255,
+ /*  1920 */   258,  261,  282,  268,  270,  282,  282,  282,  282,   25,
+ /*  1930 */   221,  282,  282,   38,  168,  170,  282,  282,  179,  282,
+ /*  1940 */   282,  282,  282,  282,  282,  202,  282,  314,  282,  282,
+ /*  1950 */   282,  282,  282,  282,  211,  282,  282,  282,  222,  282,
+ /*  1960 */   229,  282,  236,  282,  246,  249,  282,  255,  258,  261,
+ /*  1970 */   282,  268,  270,  282,  282,  282,  282,   25,  221,  282,
+ /*  1980 */   282,   38,  168,  170,  282,  333,  179,  282,  282,  282,
+ /*  1990 */   282,  282,  282,  202,  282,  282,  282,  282,  282,  282,
+ /*  2000 */   282,  282,  211,  282,  282,  282,  222,  282,  229,  282,
+ /*  2010 */   236,  282,  246,  249,  282,  255,  258,  261,  282,  268,
+ /*  2020 */   270,  282,  282,  282,  282,   25,  221,  282,  282,   38,
+ /*  2030 */   168,  170,  282,  342,  179,  282,  282,  282,  282,  282,
+ /*  2040 */   282,  202,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2050 */   211,  282,  282,  282,  222,  282,  229,  282,  236,  282,
+ /*  2060 */   246,  249,  282,  255,  258,  261,  282,  268,  270,  282,
+ /*  2070 */   282,  282,  282,   25,  221,  282,  282,   38,  168,  170,
+ /*  2080 */   282,  349,  179,  282,  282,  282,  282,  282,  282,  202,
+ /*  2090 */   282,  282,  282,  282,  282,  282,  282,  282,  211,  282,
+ /*  2100 */   282,  282,  222,  282,  229,  282,  236,  282,  246,  249,
+ /*  2110 */   282,  255,  258,  261,  282,  268,  270,  282,  282,  282,
+ /*  2120 */   282,   25,  221,  352,  282,   38,  168,  170,  282,  282,
+ /*  2130 */   179,  282,  282,  282,  282,  282,  282,  202,  282,  282,
+ /*  2140 */   282,  282,  282,  282,  282,  282,  211,  282,  282,  282,
+ /*  2150 */   222,  282,  229,  282,  236,  282,  246,  249,  282,  255,
+ /*  2160 */   258,  261,  282,  268,  270,  282,  282,  282,  282,   25,
+ /*  2170 */   221,  282,  282,   38,  168,  170,  282,  282,  179,  282,
+ /*  2180 */   282,  282,  282,  282,  282,  202,  282,  282,  282,  282,
+ /*  2190 */   282,  282,  282,  282,  211,  282,  282,  282,  222,  282,
+ /*  2200 */   229,  282,  236,  282,  246,  249,  282,  255,  258,  261,
+ /*  2210 */   282,  268,  270,  282,  164,  282,   45,   42,  282,  104,
+ /*  2220 */   136,   99,  282,  162,  101,  282,   45,   42,  282,  104,
+ /*  2230 */   282,   99,  282,  119,  101,  282,   45,   42,  282,  104,
+ /*  2240 */   282,   99,  282,  119,  101,  120,  121,  122,  123,  124,
+ /*  2250 */   125,  282,  282,  147,  282,  120,  121,  122,  123,  124,
+ /*  2260 */   125,  282,  282,  282,  282,  146,  121,  122,  123,  124,
+ /*  2270 */   125,  282,   45,   42,  282,  104,  282,   99,  110,  282,
+ /*  2280 */   101,  282,  282,  282,  282,  282,  282,  282,  110,  119,
+ /*  2290 */   282,  282,   45,   42,  282,  104,  282,   99,  110,  134,
+ /*  2300 */   101,  120,  131,  122,  123,  124,  125,  282,  282,  119,
+ /*  2310 */    45,   42,  282,  104,  282,   99,  282,  106,  101,  282,
+ /*  2320 */   282,  120,  115,  122,  123,  124,  125,  119,   45,   42,
+ /*  2330 */   282,  104,  282,   99,  110,  282,  101,  282,  282,  120,
+ /*  2340 */   115,  122,  123,  124,  125,  119,  282,  282,  282,  282,
+ /*  2350 */   282,  282,  282,  282,  110,  304,  282,  120,  131,  122,
+ /*  2360 */   123,  124,  125,   45,   42,  282,  104,  282,   99,  282,
+ /*  2370 */   282,  101,  110,  111,  432,  282,  282,  282,  282,  282,
+ /*  2380 */   119,   45,   42,  282,  104,  282,   99,  282,  282,  101,
+ /*  2390 */   110,  282,  120,  121,  122,  123,  124,  125,  119,  282,
+ /*  2400 */   282,  282,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2410 */   120,  121,  122,  123,  124,  125,   45,   42,  282,  104,
+ /*  2420 */   282,   99,  282,  282,  101,  110,  282,  282,  282,  282,
+ /*  2430 */   282,  282,  282,  119,   45,   42,  282,  104,  282,   99,
+ /*  2440 */   282,  282,  101,  110,  282,  120,  115,  122,  123,  124,
+ /*  2450 */   125,  119,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2460 */   282,  282,  282,  120,  131,  122,  123,  124,  125,  282,
+ /*  2470 */   282,  282,  282,  282,  282,  282,  282,  282,  110,  282,
+ /*  2480 */   282,  282,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2490 */   282,  282,  282,  282,  282,  282,  110,
 };
 static VVCODETYPE vv_lookahead[] = {
  /*     0 */     3,    4,    2,    6,    7,    8,    9,   10,   11,   12,
  /*    10 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*    20 */    23,   24,   25,   26,   27,   28,   29,   30,    3,   32,
+ /*    20 */    23,   24,   25,   26,   27,   28,   29,   30,    0,   32,
  /*    30 */    26,   27,   28,   29,   30,   38,   21,   22,   23,   24,
  /*    40 */    25,   26,   27,   28,   29,   30,   46,   50,  111,  112,
  /*    50 */   113,    3,    4,    2,    6,    7,    8,    9,   10,   11,
  /*    60 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*    70 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   38,
+ /*    70 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
  /*    80 */    32,    3,    4,   32,    6,    7,    8,    9,   10,   11,
  /*    90 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   100 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
- /*   110 */    32,    2,    3,   32,    3,    4,   68,    6,    7,    8,
- /*   120 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*   130 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   140 */    29,   30,   31,   32,    3,    4,   32,    6,    7,    8,
+ /*   100 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   32,
+ /*   110 */    32,    3,    4,   32,    6,    7,    8,    9,   10,   11,
+ /*   120 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
+ /*   130 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+ /*   140 */    32,    2,    3,   32,    3,    4,   68,    6,    7,    8,
  /*   150 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
  /*   160 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   170 */    29,   30,  118,   32,    3,    4,    5,    6,    7,    8,
+ /*   170 */    29,   30,    3,   32,    3,    4,  121,    6,    7,    8,
  /*   180 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
  /*   190 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   200 */    29,   30,    3,    4,    2,    6,    7,    8,    9,   10,
- /*   210 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*   220 */    21,   22,   23,   24,   25,   26,   27,   28,   29,   30,
- /*   230 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   240 */    28,   29,   30,   38,  114,  115,   38,   48,    2,   33,
- /*   250 */    48,    3,    4,   48,    6,    7,    8,    9,   10,   11,
+ /*   200 */    29,   30,    2,   32,    3,    4,   46,    6,    7,    8,
+ /*   210 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*   220 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
+ /*   230 */    29,   30,   18,   19,   20,   21,   22,   23,   24,   25,
+ /*   240 */    26,   27,   28,   29,   30,    2,    5,   46,   48,  112,
+ /*   250 */   113,    3,    4,    5,    6,    7,    8,    9,   10,   11,
  /*   260 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   270 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    2,
- /*   280 */    32,    3,    4,   46,    6,    7,    8,    9,   10,   11,
- /*   290 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   300 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   24,
- /*   310 */    25,   26,   27,   28,   29,   30,   50,   51,   52,   53,
- /*   320 */    54,   55,  112,  113,   46,   48,   54,   55,    3,    4,
- /*   330 */    84,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   270 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    3,
+ /*   280 */     4,   46,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*   290 */    14,   15,   16,   17,   18,   19,   20,   21,   22,   23,
+ /*   300 */    24,   25,   26,   27,   28,   29,   30,   24,   25,   26,
+ /*   310 */    27,   28,   29,   30,   50,   51,   52,   53,   54,   55,
+ /*   320 */   114,  115,  118,  119,   48,   54,   55,   84,    3,    4,
+ /*   330 */    46,    6,    7,    8,    9,   10,   11,   12,   13,   14,
  /*   340 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
- /*   350 */    25,   26,   27,   28,   29,   30,   38,   38,   32,   32,
- /*   360 */    32,  110,  110,   32,   46,  110,   32,   32,   50,   50,
- /*   370 */    32,   46,  120,  122,  122,    3,    4,  122,    6,    7,
+ /*   350 */    25,   26,   27,   28,   29,   30,   38,   38,    5,  110,
+ /*   360 */   110,  110,    5,  121,   46,    5,   46,   38,   50,   50,
+ /*   370 */     5,   46,  123,  123,  123,    3,    4,   48,    6,    7,
  /*   380 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
  /*   390 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   400 */    28,   29,   30,   38,   32,    3,    4,   32,    6,    7,
- /*   410 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
- /*   420 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   430 */    28,   29,   30,   32,   32,    3,    4,   46,    6,    7,
- /*   440 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
- /*   450 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   460 */    28,   29,   30,    3,    4,   32,    6,    7,    8,    9,
+ /*   400 */    28,   29,   30,    3,    4,   32,    6,    7,    8,    9,
+ /*   410 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   420 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   430 */    30,   59,   32,    3,    4,   38,    6,    7,    8,    9,
+ /*   440 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   450 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   460 */    30,   32,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   470 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   480 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   490 */    30,   59,   32,    3,    4,   32,    6,    7,    8,    9,
+ /*   490 */    30,  113,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   500 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   510 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   520 */    30,  113,   32,    3,    4,   32,    6,    7,    8,    9,
+ /*   520 */    30,   29,   32,    3,    4,   32,    6,    7,    8,    9,
  /*   530 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   540 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
  /*   550 */    30,   32,   32,    3,    4,   32,    6,    7,    8,    9,
  /*   560 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   570 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   580 */    30,   32,   32,    3,    4,    1,    6,    7,    8,    9,
+ /*   580 */    30,   32,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   590 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   600 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   610 */    30,    3,    4,   57,    6,    7,    8,    9,   10,   11,
- /*   620 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   630 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    4,
- /*   640 */    38,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   650 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
- /*   660 */    25,   26,   27,   28,   29,   30,    6,    7,    8,    9,
- /*   670 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
- /*   680 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   690 */    30,    7,    8,    9,   10,   11,   12,   13,   14,   15,
- /*   700 */    16,   17,   18,   19,   20,   21,   22,   23,   24,   25,
- /*   710 */    26,   27,   28,   29,   30,   86,   87,   88,   89,   90,
- /*   720 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*   730 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
- /*   740 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
- /*   750 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
- /*   760 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
- /*   770 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
- /*   780 */   107,  108,  109,    9,   10,   11,   12,   13,   14,   15,
- /*   790 */    16,   17,   18,   19,   20,   21,   22,   23,   24,   25,
- /*   800 */    26,   27,   28,   29,   30,   88,   89,   90,   91,   92,
- /*   810 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
- /*   820 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
- /*   830 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*   840 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
- /*   850 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
- /*   860 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
- /*   870 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
- /*   880 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
- /*   890 */   107,  108,  109,   88,   89,   90,   91,   92,   93,   94,
- /*   900 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
- /*   910 */   105,  106,  107,  108,  109,   88,   89,   90,   91,   92,
- /*   920 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
- /*   930 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
- /*   940 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*   950 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
- /*   960 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
- /*   970 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
- /*   980 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
- /*   990 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
- /*  1000 */   107,  108,  109,   88,   89,   90,   91,   92,   93,   94,
- /*  1010 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
- /*  1020 */   105,  106,  107,  108,  109,   88,   89,   90,   91,   92,
- /*  1030 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
- /*  1040 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
- /*  1050 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*  1060 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   89,
- /*  1070 */    90,   91,   92,   93,   94,   95,   96,   97,   98,   99,
- /*  1080 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
- /*  1090 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
- /*  1100 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
- /*  1110 */   109,   31,   32,   33,   34,   35,   36,   37,  110,   32,
- /*  1120 */    40,    0,    1,  110,    5,  117,  110,   47,    1,    1,
- /*  1130 */   122,  123,  119,  117,  121,  122,   56,    1,  122,  123,
- /*  1140 */    60,   32,   62,  110,   64,  110,   66,   67,  110,   69,
- /*  1150 */    70,   71,  110,   73,   74,  122,  121,  122,   21,   22,
- /*  1160 */   122,   24,  110,   26,  122,    1,   29,   65,   21,   22,
- /*  1170 */   110,   24,  110,   26,  122,   38,   29,    3,   32,   58,
- /*  1180 */    32,  119,  122,  121,  122,   38,   58,   50,   51,   52,
- /*  1190 */    53,   54,   55,  110,   58,  110,   75,   50,   51,   52,
- /*  1200 */    53,   54,   55,   75,    1,  122,  123,  122,    1,  110,
- /*  1210 */     1,   75,    2,   76,   77,   78,   79,   80,   81,   82,
- /*  1220 */    83,  122,   58,   76,   77,   78,   79,   80,   81,   82,
- /*  1230 */    83,   31,   32,   33,   34,   35,   36,   37,   32,   75,
- /*  1240 */    40,  110,  110,  110,    0,  110,   38,   47,   29,   32,
- /*  1250 */     5,   38,   32,  122,  122,  122,   56,  122,   48,   32,
- /*  1260 */    60,   58,   62,    1,   64,   58,   66,   67,    1,   69,
- /*  1270 */    70,   71,    1,   73,   74,   32,  115,  110,   75,   31,
- /*  1280 */    32,   24,   75,   35,   36,   37,   32,   30,   40,  122,
- /*  1290 */     1,  120,   41,  110,  110,   47,  120,  116,   41,   42,
- /*  1300 */    43,   44,   45,    5,   56,  122,  122,   46,   60,   61,
- /*  1310 */    62,    1,   64,   32,   66,   67,    1,   69,   70,   71,
- /*  1320 */    58,   73,   74,   32,   32,   58,   32,   31,   32,   58,
- /*  1330 */     5,   35,   36,   37,   32,    1,   40,   75,    1,  110,
- /*  1340 */    32,  110,   75,   47,    5,  110,   75,   58,    1,   46,
- /*  1350 */    32,  122,   56,  122,   32,   32,   60,  122,   62,   63,
- /*  1360 */    64,  124,   66,   67,   75,   69,   70,   71,   58,   73,
- /*  1370 */    74,  124,  124,   58,  124,   31,   32,   33,  124,   35,
- /*  1380 */    36,   37,  124,    1,   40,   75,    1,  124,  124,  110,
- /*  1390 */    75,   47,   58,  124,    1,   58,    1,  124,  124,  124,
- /*  1400 */    56,  122,  124,  124,   60,   58,   62,  124,   64,   75,
- /*  1410 */    66,   67,   75,   69,   70,   71,  124,   73,   74,  124,
- /*  1420 */   124,  110,   75,   31,   32,  124,  110,   35,   36,   37,
- /*  1430 */   110,   39,   40,  122,  124,  124,  124,  124,  122,   47,
- /*  1440 */    58,  124,  122,   58,  124,  124,  124,  124,   56,  124,
- /*  1450 */   124,   58,   60,   58,   62,  124,   64,   75,   66,   67,
- /*  1460 */    75,   69,   70,   71,  124,   73,   74,  110,   75,  110,
- /*  1470 */    75,   31,   32,  110,  110,   35,   36,   37,  110,  122,
- /*  1480 */    40,  122,  124,  124,  124,  122,  122,   47,  124,  124,
- /*  1490 */   122,  110,  124,  124,  124,  124,   56,   57,  124,  124,
- /*  1500 */    60,  124,   62,  122,   64,  124,   66,   67,  124,   69,
- /*  1510 */    70,   71,  124,   73,   74,  110,  124,  110,  124,   31,
- /*  1520 */    32,  110,  110,   35,   36,   37,  110,  122,   40,  122,
- /*  1530 */   124,  124,  124,  122,  122,   47,  124,  110,  122,  124,
- /*  1540 */   124,  110,  124,  124,   56,  124,  124,  124,   60,  122,
- /*  1550 */    62,   63,   64,  122,   66,   67,  124,   69,   70,   71,
- /*  1560 */   124,   73,   74,  110,  124,  110,  124,   31,   32,  110,
- /*  1570 */   110,   35,   36,   37,  110,  122,   40,  122,  110,  110,
- /*  1580 */   124,  122,  122,   47,  124,  110,  122,  110,  124,  110,
- /*  1590 */   122,  122,   56,  124,  124,  124,   60,  122,   62,  122,
- /*  1600 */    64,  122,   66,   67,  124,   69,   70,   71,   72,   73,
- /*  1610 */    74,  110,  124,  110,  110,   31,   32,   33,  110,   35,
- /*  1620 */    36,   37,  110,  122,   40,  122,  122,  124,  124,  124,
- /*  1630 */   122,   47,  124,  110,  122,  124,  124,  124,  124,  124,
- /*  1640 */    56,  124,  124,  124,   60,  122,   62,  124,   64,  124,
- /*  1650 */    66,   67,  124,   69,   70,   71,  124,   73,   74,  124,
- /*  1660 */   124,  124,  124,   31,   32,  124,  124,   35,   36,   37,
- /*  1670 */   124,  124,   40,  124,  124,  124,  124,  124,  124,   47,
- /*  1680 */   124,   49,  124,  124,  124,  124,  124,  124,   56,  124,
- /*  1690 */   124,  124,   60,  124,   62,  124,   64,  124,   66,   67,
- /*  1700 */   124,   69,   70,   71,  124,   73,   74,  124,  124,  124,
- /*  1710 */   124,   31,   32,  124,  124,   35,   36,   37,  124,  124,
- /*  1720 */    40,  124,  124,  124,  124,  124,  124,   47,  124,  124,
- /*  1730 */   124,  124,  124,  124,  124,  124,   56,  124,  124,  124,
- /*  1740 */    60,   61,   62,  124,   64,  124,   66,   67,  124,   69,
- /*  1750 */    70,   71,  124,   73,   74,  124,  124,  124,  124,   31,
- /*  1760 */    32,  124,  124,   35,   36,   37,  124,  124,   40,  124,
- /*  1770 */   124,  124,  124,  124,  124,   47,  124,  124,  124,  124,
- /*  1780 */   124,  124,  124,  124,   56,  124,  124,  124,   60,  124,
- /*  1790 */    62,  124,   64,  124,   66,   67,  124,   69,   70,   71,
- /*  1800 */    72,   73,   74,  124,  124,  124,  124,   31,   32,  124,
- /*  1810 */   124,   35,   36,   37,  124,   39,   40,  124,  124,  124,
- /*  1820 */   124,  124,  124,   47,  124,  124,  124,  124,  124,  124,
- /*  1830 */   124,  124,   56,  124,  124,  124,   60,  124,   62,  124,
- /*  1840 */    64,  124,   66,   67,  124,   69,   70,   71,  124,   73,
- /*  1850 */    74,  124,  124,  124,  124,   31,   32,  124,  124,   35,
- /*  1860 */    36,   37,  124,  124,   40,  124,  124,  124,  124,  124,
- /*  1870 */   124,   47,  124,   49,  124,  124,  124,  124,  124,  124,
- /*  1880 */    56,  124,  124,  124,   60,  124,   62,  124,   64,  124,
- /*  1890 */    66,   67,  124,   69,   70,   71,  124,   73,   74,  124,
- /*  1900 */   124,  124,  124,   31,   32,  124,  124,   35,   36,   37,
- /*  1910 */   124,   39,   40,  124,  124,  124,  124,  124,  124,   47,
- /*  1920 */   124,  124,  124,  124,  124,  124,  124,  124,   56,  124,
- /*  1930 */   124,  124,   60,  124,   62,  124,   64,  124,   66,   67,
- /*  1940 */   124,   69,   70,   71,  124,   73,   74,  124,  124,  124,
- /*  1950 */   124,   31,   32,  124,  124,   35,   36,   37,  124,   39,
- /*  1960 */    40,  124,  124,  124,  124,  124,  124,   47,  124,  124,
- /*  1970 */   124,  124,  124,  124,  124,  124,   56,  124,  124,  124,
- /*  1980 */    60,  124,   62,  124,   64,  124,   66,   67,  124,   69,
- /*  1990 */    70,   71,  124,   73,   74,  124,  124,  124,  124,   31,
- /*  2000 */    32,  124,  124,   35,   36,   37,  124,  124,   40,  124,
- /*  2010 */   124,  124,  124,  124,  124,   47,  124,  124,  124,  124,
- /*  2020 */   124,  124,  124,  124,   56,  124,  124,  124,   60,  124,
- /*  2030 */    62,  124,   64,  124,   66,   67,  124,   69,   70,   71,
- /*  2040 */   124,   73,   74,  124,   19,  124,   21,   22,  124,   24,
- /*  2050 */     5,   26,  124,   18,   29,  124,   21,   22,  124,   24,
- /*  2060 */   124,   26,  124,   38,   29,  124,   21,   22,  124,   24,
- /*  2070 */   124,   26,  124,   38,   29,   50,   51,   52,   53,   54,
- /*  2080 */    55,  124,  124,   38,  124,   50,   51,   52,   53,   54,
- /*  2090 */    55,  124,  124,  124,  124,   50,   51,   52,   53,   54,
- /*  2100 */    55,  124,   21,   22,  124,   24,  124,   26,   83,  124,
- /*  2110 */    29,  124,   21,   22,  124,   24,  124,   26,   83,   38,
- /*  2120 */    29,  124,  124,  124,  124,  124,  124,   46,   83,   38,
- /*  2130 */   124,   50,   51,   52,   53,   54,   55,  124,  124,   48,
- /*  2140 */   124,   50,   51,   52,   53,   54,   55,  124,  124,   21,
- /*  2150 */    22,  124,   24,  124,   26,   21,   22,   29,   24,  124,
- /*  2160 */    26,  124,  124,   29,   83,  124,   38,  124,  124,  124,
- /*  2170 */   124,  124,   38,  124,   83,  124,   48,  124,   50,   51,
- /*  2180 */    52,   53,   54,   55,   50,   51,   52,   53,   54,   55,
- /*  2190 */   124,  124,  124,  124,  124,  124,   21,   22,  124,   24,
- /*  2200 */   124,   26,   21,   22,   29,   24,  124,   26,  124,  124,
- /*  2210 */    29,   83,  124,   38,  124,  124,  124,   83,   84,   38,
- /*  2220 */   124,  124,  124,  124,  124,   50,   51,   52,   53,   54,
- /*  2230 */    55,   50,   51,   52,   53,   54,   55,  124,  124,   21,
- /*  2240 */    22,  124,   24,  124,   26,  124,  124,   29,  124,  124,
- /*  2250 */   124,  124,  124,  124,  124,  124,   38,  124,   83,  124,
- /*  2260 */   124,  124,  124,  124,   83,  124,  124,  124,   50,   51,
- /*  2270 */    52,   53,   54,   55,  124,  124,  124,  124,  124,  124,
- /*  2280 */   124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
- /*  2290 */   124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
- /*  2300 */   124,   83,
+ /*   610 */    30,   32,   32,    3,    4,   32,    6,    7,    8,    9,
+ /*   620 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   630 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   640 */    30,    3,    4,   32,    6,    7,    8,    9,   10,   11,
+ /*   650 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
+ /*   660 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    4,
+ /*   670 */     1,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   680 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
+ /*   690 */    25,   26,   27,   28,   29,   30,    6,    7,    8,    9,
+ /*   700 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   710 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   720 */    30,   86,   87,   88,   89,   90,   91,   92,   93,   94,
+ /*   730 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*   740 */   105,  106,  107,  108,  109,    7,    8,    9,   10,   11,
+ /*   750 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
+ /*   760 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   88,
+ /*   770 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
+ /*   780 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*   790 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+ /*   800 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*   810 */   107,  108,  109,    9,   10,   11,   12,   13,   14,   15,
+ /*   820 */    16,   17,   18,   19,   20,   21,   22,   23,   24,   25,
+ /*   830 */    26,   27,   28,   29,   30,   88,   89,   90,   91,   92,
+ /*   840 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
+ /*   850 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
+ /*   860 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
+ /*   870 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
+ /*   880 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
+ /*   890 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*   900 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+ /*   910 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*   920 */   107,  108,  109,   88,   89,   90,   91,   92,   93,   94,
+ /*   930 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*   940 */   105,  106,  107,  108,  109,   88,   89,   90,   91,   92,
+ /*   950 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
+ /*   960 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
+ /*   970 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
+ /*   980 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
+ /*   990 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
+ /*  1000 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  1010 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+ /*  1020 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  1030 */   107,  108,  109,   88,   89,   90,   91,   92,   93,   94,
+ /*  1040 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*  1050 */   105,  106,  107,  108,  109,   88,   89,   90,   91,   92,
+ /*  1060 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
+ /*  1070 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
+ /*  1080 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
+ /*  1090 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
+ /*  1100 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
+ /*  1110 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  1120 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+ /*  1130 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  1140 */   107,  108,  109,   89,   90,   91,   92,   93,   94,   95,
+ /*  1150 */    96,   97,   98,   99,  100,  101,  102,  103,  104,  105,
+ /*  1160 */   106,  107,  108,  109,   89,   90,   91,   92,   93,   94,
+ /*  1170 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*  1180 */   105,  106,  107,  108,  109,   31,   32,   33,   34,   35,
+ /*  1190 */    36,   37,  110,   32,   40,    0,    1,   32,  110,  117,
+ /*  1200 */   110,   47,  110,   38,   65,  123,  124,   32,   32,  121,
+ /*  1210 */    56,  123,  122,  123,   60,  123,   62,  110,   64,   32,
+ /*  1220 */    66,   67,   32,   69,   70,   71,  110,   73,   74,   32,
+ /*  1230 */   123,  124,   21,   22,  119,   24,  120,   26,  122,  123,
+ /*  1240 */    29,   32,   21,   22,  110,   24,   32,   26,   32,   38,
+ /*  1250 */    29,   32,   32,   58,  120,  110,  122,  123,    1,   38,
+ /*  1260 */    32,   50,   51,   52,   53,   54,   55,  110,  123,  110,
+ /*  1270 */    75,   50,   51,   52,   53,   54,   55,   32,    1,   32,
+ /*  1280 */   123,    2,  123,  110,   32,    2,   32,   76,   77,   78,
+ /*  1290 */    79,   80,   81,   82,   83,    1,  123,   76,   77,   78,
+ /*  1300 */    79,   80,   81,   82,   83,   31,   32,   33,   34,   35,
+ /*  1310 */    36,   37,  110,    1,   40,   58,    1,   57,   32,  117,
+ /*  1320 */   110,   47,   38,   32,   32,  123,  124,   48,  115,   41,
+ /*  1330 */    56,   48,   75,  123,   60,   58,   62,    1,   64,  116,
+ /*  1340 */    66,   67,    1,   69,   70,   71,    1,   73,   74,   32,
+ /*  1350 */   110,   38,   75,   31,   32,   33,   32,   35,   36,   37,
+ /*  1360 */    32,    1,   40,  123,    1,    3,  110,   32,  110,   47,
+ /*  1370 */    58,   32,    1,   58,    1,   32,    1,   33,   56,  123,
+ /*  1380 */    32,  123,   60,  125,   62,  110,   64,   75,   66,   67,
+ /*  1390 */    75,   69,   70,   71,   58,   73,   74,  125,  123,   58,
+ /*  1400 */   110,   31,   32,   58,  125,   35,   36,   37,  125,   39,
+ /*  1410 */    40,   75,  110,  123,  110,  110,   75,   47,   58,  125,
+ /*  1420 */    75,   58,    1,  125,  125,  123,   56,  123,  123,   58,
+ /*  1430 */    60,   58,   62,    1,   64,   75,   66,   67,   75,   69,
+ /*  1440 */    70,   71,    1,   73,   74,  125,   75,  125,   75,   31,
+ /*  1450 */    32,   24,  125,   35,   36,   37,  125,   30,   40,  125,
+ /*  1460 */     1,  125,  125,  110,  110,   47,  125,   49,   41,   42,
+ /*  1470 */    43,   44,   45,  125,   56,  125,  123,  123,   60,   58,
+ /*  1480 */    62,    1,   64,  125,   66,   67,    1,   69,   70,   71,
+ /*  1490 */    58,   73,   74,  125,  125,  125,   75,   31,   32,   58,
+ /*  1500 */   125,   35,   36,   37,  125,    1,   40,   75,    1,  125,
+ /*  1510 */   125,  110,  110,   47,  110,  125,   75,   58,  110,  125,
+ /*  1520 */   125,  125,   56,   57,  123,  123,   60,  123,   62,  110,
+ /*  1530 */    64,  123,   66,   67,   75,   69,   70,   71,   58,   73,
+ /*  1540 */    74,  125,  123,   58,  110,   31,   32,    1,  125,   35,
+ /*  1550 */    36,   37,  125,  110,   40,   75,  125,  123,  125,  110,
+ /*  1560 */    75,   47,   58,  125,  110,   58,  123,  125,  125,  125,
+ /*  1570 */    56,  125,  123,  125,   60,   61,   62,  123,   64,   75,
+ /*  1580 */    66,   67,   75,   69,   70,   71,  125,   73,   74,  125,
+ /*  1590 */   125,  125,  110,   31,   32,  125,  125,   35,   36,   37,
+ /*  1600 */   110,  110,   40,  110,   58,  123,  125,  110,  125,   47,
+ /*  1610 */   110,  125,  125,  123,  123,  125,  123,  125,   56,  125,
+ /*  1620 */   123,   75,   60,  123,   62,   63,   64,  110,   66,   67,
+ /*  1630 */   125,   69,   70,   71,  125,   73,   74,  125,  110,  110,
+ /*  1640 */   123,   31,   32,  110,  125,   35,   36,   37,  110,  110,
+ /*  1650 */    40,  123,  123,  125,  110,  110,  123,   47,  110,  125,
+ /*  1660 */   110,  123,  123,  125,  125,  110,   56,  123,  123,  125,
+ /*  1670 */    60,  123,   62,  123,   64,  110,   66,   67,  123,   69,
+ /*  1680 */    70,   71,   72,   73,   74,  125,  110,  110,  123,   31,
+ /*  1690 */    32,  110,  125,   35,   36,   37,  110,  125,   40,  123,
+ /*  1700 */   123,  125,  125,  110,  123,   47,  125,  125,  110,  123,
+ /*  1710 */   110,  125,  125,  125,   56,  125,  123,  125,   60,  125,
+ /*  1720 */    62,  123,   64,  123,   66,   67,  125,   69,   70,   71,
+ /*  1730 */    72,   73,   74,  125,  125,  125,  125,   31,   32,  125,
+ /*  1740 */   125,   35,   36,   37,  125,  125,   40,  125,  125,  125,
+ /*  1750 */   125,  125,  125,   47,  125,  125,  125,  125,  125,  125,
+ /*  1760 */   125,  125,   56,  125,  125,  125,   60,  125,   62,   63,
+ /*  1770 */    64,  125,   66,   67,  125,   69,   70,   71,  125,   73,
+ /*  1780 */    74,  125,  125,  125,  125,   31,   32,  125,  125,   35,
+ /*  1790 */    36,   37,  125,  125,   40,  125,  125,  125,  125,  125,
+ /*  1800 */   125,   47,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  1810 */    56,  125,  125,  125,   60,  125,   62,   63,   64,  125,
+ /*  1820 */    66,   67,  125,   69,   70,   71,  125,   73,   74,  125,
+ /*  1830 */   125,  125,  125,   31,   32,  125,  125,   35,   36,   37,
+ /*  1840 */   125,  125,   40,  125,  125,  125,  125,  125,  125,   47,
+ /*  1850 */   125,  125,  125,  125,  125,  125,  125,  125,   56,  125,
+ /*  1860 */   125,  125,   60,  125,   62,   63,   64,  125,   66,   67,
+ /*  1870 */   125,   69,   70,   71,  125,   73,   74,  125,  125,  125,
+ /*  1880 */   125,   31,   32,  125,  125,   35,   36,   37,  125,  125,
+ /*  1890 */    40,  125,  125,  125,  125,  125,  125,   47,  125,  125,
+ /*  1900 */   125,  125,  125,  125,  125,  125,   56,  125,  125,  125,
+ /*  1910 */    60,   61,   62,  125,   64,  125,   66,   67,  125,   69,
+ /*  1920 */    70,   71,  125,   73,   74,  125,  125,  125,  125,   31,
+ /*  1930 */    32,  125,  125,   35,   36,   37,  125,  125,   40,  125,
+ /*  1940 */   125,  125,  125,  125,  125,   47,  125,   49,  125,  125,
+ /*  1950 */   125,  125,  125,  125,   56,  125,  125,  125,   60,  125,
+ /*  1960 */    62,  125,   64,  125,   66,   67,  125,   69,   70,   71,
+ /*  1970 */   125,   73,   74,  125,  125,  125,  125,   31,   32,  125,
+ /*  1980 */   125,   35,   36,   37,  125,   39,   40,  125,  125,  125,
+ /*  1990 */   125,  125,  125,   47,  125,  125,  125,  125,  125,  125,
+ /*  2000 */   125,  125,   56,  125,  125,  125,   60,  125,   62,  125,
+ /*  2010 */    64,  125,   66,   67,  125,   69,   70,   71,  125,   73,
+ /*  2020 */    74,  125,  125,  125,  125,   31,   32,  125,  125,   35,
+ /*  2030 */    36,   37,  125,   39,   40,  125,  125,  125,  125,  125,
+ /*  2040 */   125,   47,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2050 */    56,  125,  125,  125,   60,  125,   62,  125,   64,  125,
+ /*  2060 */    66,   67,  125,   69,   70,   71,  125,   73,   74,  125,
+ /*  2070 */   125,  125,  125,   31,   32,  125,  125,   35,   36,   37,
+ /*  2080 */   125,   39,   40,  125,  125,  125,  125,  125,  125,   47,
+ /*  2090 */   125,  125,  125,  125,  125,  125,  125,  125,   56,  125,
+ /*  2100 */   125,  125,   60,  125,   62,  125,   64,  125,   66,   67,
+ /*  2110 */   125,   69,   70,   71,  125,   73,   74,  125,  125,  125,
+ /*  2120 */   125,   31,   32,   33,  125,   35,   36,   37,  125,  125,
+ /*  2130 */    40,  125,  125,  125,  125,  125,  125,   47,  125,  125,
+ /*  2140 */   125,  125,  125,  125,  125,  125,   56,  125,  125,  125,
+ /*  2150 */    60,  125,   62,  125,   64,  125,   66,   67,  125,   69,
+ /*  2160 */    70,   71,  125,   73,   74,  125,  125,  125,  125,   31,
+ /*  2170 */    32,  125,  125,   35,   36,   37,  125,  125,   40,  125,
+ /*  2180 */   125,  125,  125,  125,  125,   47,  125,  125,  125,  125,
+ /*  2190 */   125,  125,  125,  125,   56,  125,  125,  125,   60,  125,
+ /*  2200 */    62,  125,   64,  125,   66,   67,  125,   69,   70,   71,
+ /*  2210 */   125,   73,   74,  125,   19,  125,   21,   22,  125,   24,
+ /*  2220 */     5,   26,  125,   18,   29,  125,   21,   22,  125,   24,
+ /*  2230 */   125,   26,  125,   38,   29,  125,   21,   22,  125,   24,
+ /*  2240 */   125,   26,  125,   38,   29,   50,   51,   52,   53,   54,
+ /*  2250 */    55,  125,  125,   38,  125,   50,   51,   52,   53,   54,
+ /*  2260 */    55,  125,  125,  125,  125,   50,   51,   52,   53,   54,
+ /*  2270 */    55,  125,   21,   22,  125,   24,  125,   26,   83,  125,
+ /*  2280 */    29,  125,  125,  125,  125,  125,  125,  125,   83,   38,
+ /*  2290 */   125,  125,   21,   22,  125,   24,  125,   26,   83,   48,
+ /*  2300 */    29,   50,   51,   52,   53,   54,   55,  125,  125,   38,
+ /*  2310 */    21,   22,  125,   24,  125,   26,  125,   46,   29,  125,
+ /*  2320 */   125,   50,   51,   52,   53,   54,   55,   38,   21,   22,
+ /*  2330 */   125,   24,  125,   26,   83,  125,   29,  125,  125,   50,
+ /*  2340 */    51,   52,   53,   54,   55,   38,  125,  125,  125,  125,
+ /*  2350 */   125,  125,  125,  125,   83,   48,  125,   50,   51,   52,
+ /*  2360 */    53,   54,   55,   21,   22,  125,   24,  125,   26,  125,
+ /*  2370 */   125,   29,   83,   84,   32,  125,  125,  125,  125,  125,
+ /*  2380 */    38,   21,   22,  125,   24,  125,   26,  125,  125,   29,
+ /*  2390 */    83,  125,   50,   51,   52,   53,   54,   55,   38,  125,
+ /*  2400 */   125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2410 */    50,   51,   52,   53,   54,   55,   21,   22,  125,   24,
+ /*  2420 */   125,   26,  125,  125,   29,   83,  125,  125,  125,  125,
+ /*  2430 */   125,  125,  125,   38,   21,   22,  125,   24,  125,   26,
+ /*  2440 */   125,  125,   29,   83,  125,   50,   51,   52,   53,   54,
+ /*  2450 */    55,   38,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2460 */   125,  125,  125,   50,   51,   52,   53,   54,   55,  125,
+ /*  2470 */   125,  125,  125,  125,  125,  125,  125,  125,   83,  125,
+ /*  2480 */   125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2490 */   125,  125,  125,  125,  125,  125,   83,
 };
 #define VV_SHIFT_USE_DFLT (-4)
 static short vv_shift_ofst[] = {
- /*     0 */  1128, 1244, 1121,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
+ /*     0 */  1257,   28, 1195,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
  /*    10 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
- /*    20 */    -4,   -4,   -4,   -4, 1968, 2175,  402, 1136, 1164, 1200,
- /*    30 */  1227,   -4, 1243, 1203, 1262, 1344,   81,   -4, 2175,  372,
- /*    40 */    -4, 2175, 2175,  285, 2175, 2175,  285, 2025,   15, 2035,
- /*    50 */    15, 2175,   15, 2175,  774, 2175,  774, 2175,  285, 2175,
- /*    60 */     4, 2175,  684, 2175,  212, 1137,  212, 1147,  212, 2175,
- /*    70 */   212, 2175,  212, 2175,  212, 2175,  212, 2175,  212, 2175,
- /*    80 */   212, 2175,   -4, 2175,  635,   25, 2175,    4,   -4,   -4,
- /*    90 */  2045,  278,   -4, 2175,  171, 2175,  660, 2091,  608, 2175,
- /*   100 */     4, 2175,  199,   -4, 2081,  608,   -4,    0,   -4, 2181,
- /*   110 */  2134,   -4,  246,   -4,   -4, 1298, 2175,  608,   -4,   -4,
- /*   120 */    -4,   -4,   -4,   -4,   -4,   -4,   -4, 1210,   -4, 2218,
- /*   130 */    -4, 1325, 2175,  608,   -4,   -4,  319, 1261,   -4, 1303,
- /*   140 */   391, 1339,  318,   -4,  237,   -4, 1119, 1245,   -4,   -4,
+ /*    20 */    -4,   -4,   -4,   -4, 2138, 2360,  141, 1277, 1312, 1154,
+ /*    30 */    77,   -4,   81, 1315, 1336, 1322,  111,   -4, 2360,  171,
+ /*    40 */    -4, 2360, 2360,  283, 2360, 2360,  283, 2195,   15, 2205,
+ /*    50 */    15, 2360,   15, 2360,  804, 2360,  804, 2360,  283, 2360,
+ /*    60 */     4, 2360,  738, 2360,  214, 1211,  214, 1221,  214, 2360,
+ /*    70 */   214, 2360,  214, 2360,  214, 2360,  214, 2360,  214, 2360,
+ /*    80 */   214, 2360,   -4, 2360,  665,  169, 2360,    4,   -4,   -4,
+ /*    90 */  2215,  201,   -4, 2360,  248, 2360,  690, 2251,  610, 2360,
+ /*   100 */     4, 2360,  276,   -4, 2271,  610,   -4,    0,   -4, 2395,
+ /*   110 */  2289,   -4,  243,   -4,   -4,  241, 2360,  610,   -4,   -4,
+ /*   120 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,  200,   -4, 2413,
+ /*   130 */    -4,  353, 2360,  610,   -4,   -4,  319,  160,   -4,  235,
+ /*   140 */   284,  357,  318,   -4,  320,   -4,  360,  365,   -4,   -4,
  /*   150 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
- /*   160 */    -4,   -4, 2175,   15, 2175,   15,  285,  285,  493,   -4,
- /*   170 */   365,  109, 2175,   78, 1128, 1207, 1872, 1281,   -4,  208,
- /*   180 */    51,   -4,  208,   -4, 1257, 2175,  608, 2175,  608, 2175,
- /*   190 */   608, 2175,  608, 2175,  608, 2175,  325,   -4,  208,   -4,
- /*   200 */    -4,   -4, 1208, 1219,  205, 1254, 1128, 1267, 1632, 1302,
- /*   210 */    -4, 2175,  580, 2128,  277,  334, 1128, 1271, 1440, 1292,
- /*   220 */    -4,   -4,   41,  326, 1289, 1310, 1248,  114,   -4, 2175,
- /*   230 */    -3, 1128, 1315, 1296,  331,   -4,  401, 1128, 2175,  432,
- /*   240 */    -4, 1127, 1102, 1206,   -4,   -4, 2175,  490,   -4, 2175,
- /*   250 */    48,   -4, 2175,  520,   -4, 2175,  550,   -4, 2175,  141,
- /*   260 */    -4,  272, 1109, 1128, 1334, 1728, 1308,   -4, 1323,   -4,
- /*   270 */   327,   -4,   -4, 1294, 1128, 1337, 1536, 1322,   -4,  523,
- /*   280 */  1128, 1347, 1488,  328,   -4,  338,  375, 1680,  463,   -4,
- /*   290 */   519,  584,  556, 1087,   -4,  202, 1146, 1128, 1382, 1824,
- /*   300 */  1217,   -4, 1213,   -4, 1251,  266,   -4,   -4,   -4,   -4,
- /*   310 */    -4,   -4,   -4,   -4, 2175,  248, 1128, 1385, 1920,  433,
- /*   320 */    -4,  602, 1174, 2175,  111, 1128, 1393, 1776, 1318,   -4,
- /*   330 */  2175,  460, 1128, 1395, 1392, 1148,   -4, 1584,  549,   -4,
- /*   340 */  1080, 1220,   -4,  335, 1209,  216, 1291,   -4,
+ /*   160 */    -4,   -4, 2360,   15, 2360,   15,  283,  283,  373,   -4,
+ /*   170 */   397,  139, 2360,   48, 1257, 1341, 1370,  429,   -4,  427,
+ /*   180 */    51,   -4,  427,   -4, 1427, 2360,  610, 2360,  610, 2360,
+ /*   190 */   610, 2360,  610, 2360,  610, 2360,  325,   -4,  427,   -4,
+ /*   200 */    -4,   -4,  457,  492,  329,  493, 1257, 1345, 1418,  519,
+ /*   210 */    -4, 2360,  638, 2307, 1279,  523, 1257, 1360, 1466,  549,
+ /*   220 */    -4,   -4,  547,  579, 1363, 1371, 1514,  583,   -4, 2360,
+ /*   230 */    -3, 1257, 1373, 1562,  611,   -4, 1161, 1257, 2360,  372,
+ /*   240 */    -4,  669, 1139, 1175,   -4,   -4, 2360,  400,   -4, 2360,
+ /*   250 */    78,   -4, 2360,  430,   -4, 2360,  460,   -4, 2360,  490,
+ /*   260 */    -4,  271, 1176, 1257, 1421, 1610, 1187,   -4, 1190,   -4,
+ /*   270 */  1197,   -4,   -4, 1209, 1257, 1432, 1658, 1214,   -4, 1216,
+ /*   280 */  1257, 1441, 1706, 1219,   -4, 1220, 1257, 1459, 1754, 1228,
+ /*   290 */    -4, 1165, 1245, 1257, 1480, 1802, 1247,   -4, 2360,  520,
+ /*   300 */  2342, 1850, 1252,   -4, 1254, 1294, 1260, 1286,   -4, 1283,
+ /*   310 */  1291, 1257, 1485, 1898, 1292,   -4, 1284,   -4, 1288,  264,
+ /*   320 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4, 2360,  550,
+ /*   330 */  1257, 1504, 1946, 1317,   -4, 1313, 1362, 2360,  108, 1257,
+ /*   340 */  1507, 1994, 1324,   -4, 2360,  580, 1257, 1546, 2042, 1328,
+ /*   350 */    -4, 2090, 1335,   -4, 1274, 1339,   -4, 1343, 1375, 1344,
+ /*   360 */  1348,   -4,
 };
 #define VV_REDUCE_USE_DFLT (-64)
 static short vv_reduce_ofst[] = {
- /*     0 */   629,  -64,  980,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*     0 */   635,  -64, 1054,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
  /*    10 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*    20 */   -64,  -64,  -64,  -64,  -64, 1033,  -64,  651,  980,  -64,
- /*    30 */   -64,  -64,  -64,  937,  980,  -64,  -64,  -64, 1184,  -64,
- /*    40 */   -64, 1038, 1523,  -64, 1464, 1459,  -64, 1453,  -64, 1411,
- /*    50 */   -64, 1381,  -64, 1135,  -64,  251,  -64, 1131,  -64, 1427,
- /*    60 */   -64, 1363,  -64, 1279,  -64, 1359,  -64, 1099,  -64, 1052,
- /*    70 */   -64, 1183,  -64, 1479,  -64, 1357,  -64, 1512,  -64, 1503,
- /*    80 */   -64, 1501,  -64, 1469,  -64,  -64, 1431,  -64,  -64,  -64,
- /*    90 */   252,  -64,  -64, 1468,  -64, 1475,  -64, 1008,  -64, 1508,
- /*   100 */   -64,  255,  -64,  -64, 1013,  -64,  -64,  -64,  -64, 1035,
- /*   110 */  1062,  -64,  -64,  -64,  -64,  -64, 1060,  -64,  -64,  -64,
- /*   120 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64, 1083,
- /*   130 */   -64,  -64, 1407,  -64,  -64,  -64, 1171,  -64,  -64,  -64,
- /*   140 */   -64,  -64, 1176,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*    20 */   -64,  -64,  -64,  -64,  -64, 1092,  -64,  681, 1054,  -64,
+ /*    30 */   -64,  -64,  -64,  703, 1054,  -64,  -64,  -64, 1145,  -64,
+ /*    40 */   -64, 1157, 1159,  -64, 1173, 1210,  -64, 1240,  -64, 1256,
+ /*    50 */   -64, 1258,  -64, 1275,  -64, 1290,  -64, 1302,  -64, 1304,
+ /*    60 */   -64, 1305,  -64, 1353,  -64, 1354,  -64, 1401,  -64, 1402,
+ /*    70 */   -64, 1404,  -64, 1408,  -64, 1419,  -64, 1434,  -64, 1443,
+ /*    80 */   -64, 1449,  -64, 1454,  -64,  -64, 1482,  -64,  -64,  -64,
+ /*    90 */  1088,  -64,  -64, 1490,  -64, 1491,  -64, 1082,  -64, 1493,
+ /*   100 */   -64, 1497,  -64,  -64, 1116,  -64,  -64,  -64,  -64, 1090,
+ /*   110 */  1134,  -64,  -64,  -64,  -64,  -64, 1500,  -64,  -64,  -64,
+ /*   120 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64, 1107,
+ /*   130 */   -64,  -64,  249,  -64,  -64,  -64,   55,  -64,  -64,  -64,
+ /*   140 */   -64,  -64,  242,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
  /*   150 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   160 */   -64,  -64, 1311,  -64, 1368,  -64,  -64,  -64,  -64,  -64,
- /*   170 */   -64,  -64, 1132,  -64,  849,  980,  -64,  -64,  -64,  -63,
- /*   180 */   -64,  -64,  210,  -64,  -64, 1405,  -64, 1416,  -64, 1455,
- /*   190 */   -64, 1460,  -64, 1504,  -64, 1042,  -64,  -64,  408,  -64,
- /*   200 */   -64,  -64,  -64,  -64,  130,  -64,  673,  980,  -64,  -64,
- /*   210 */   -64, 1231,  -64, 1016,  -64,  -64,  761,  980,  -64,  -64,
- /*   220 */   -64,  -64,  -64,  -64,  959,  980,  -64,  -64,  -64, 1477,
- /*   230 */    54,  717,  980,  -64,  -64,  -64,  -64, 1001, 1085,  -64,
- /*   240 */   -64,  -64,  -64,  -64,  -64,  -64, 1133,  -64,  -64, 1167,
- /*   250 */   -64,  -64, 1229,  -64,  -64, 1235,  -64,  -64, 1320,  -64,
- /*   260 */   -64,  -64,  -64,  739,  980,  -64,  -64,  -64,  -64,  -64,
- /*   270 */   -64,  -64,  -64,  -64,  805,  980,  -64,  -64,  -64,  -64,
- /*   280 */   783,  980,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   290 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  871,  980,  -64,
- /*   300 */   -64,  -64, 1161,  -64,  -64, 1181,  -64,  -64,  -64,  -64,
- /*   310 */   -64,  -64,  -64,  -64, 1316,  -64,  893,  980,  -64,  -64,
- /*   320 */   -64,  -64,  -64, 1364,  -64,  915,  980,  -64,  -64,  -64,
- /*   330 */  1412,  -64,  827,  980,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   340 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   160 */   -64,  -64, 1517,  -64, 1528,  -64,  -64,  -64,  -64,  -64,
+ /*   170 */   -64,  -64, 1529,  -64,  747, 1054,  -64,  -64,  -64,  -63,
+ /*   180 */   -64,  -64,  137,  -64,  -64,  250,  -64,  251,  -64, 1533,
+ /*   190 */   -64, 1538,  -64, 1539,  -64, 1544,  -64,  -64,  378,  -64,
+ /*   200 */   -64,  -64,  -64,  -64,  206,  -64,  769, 1054,  -64,  -64,
+ /*   210 */   -64, 1545,  -64, 1202,  -64,  -64,  791, 1054,  -64,  -64,
+ /*   220 */   -64,  -64,  -64,  -64,  813, 1054,  -64,  -64,  -64, 1548,
+ /*   230 */   204,  835, 1054,  -64,  -64,  -64,  -64, 1075, 1550,  -64,
+ /*   240 */   -64,  -64,  -64,  -64,  -64,  -64, 1555,  -64,  -64, 1565,
+ /*   250 */   -64,  -64, 1576,  -64,  -64, 1577,  -64,  -64, 1581,  -64,
+ /*   260 */   -64,  -64,  -64,  857, 1054,  -64,  -64,  -64,  -64,  -64,
+ /*   270 */   -64,  -64,  -64,  -64,  879, 1054,  -64,  -64,  -64,  -64,
+ /*   280 */   901, 1054,  -64,  -64,  -64,  -64,  923, 1054,  -64,  -64,
+ /*   290 */   -64, 1115,  -64,  945, 1054,  -64,  -64,  -64, 1586,  -64,
+ /*   300 */  1586,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   310 */   -64,  967, 1054,  -64,  -64,  -64, 1213,  -64,  -64, 1223,
+ /*   320 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64, 1593,  -64,
+ /*   330 */   989, 1054,  -64,  -64,  -64,  -64,  -64, 1598,  -64, 1011,
+ /*   340 */  1054,  -64,  -64,  -64, 1600,  -64, 1033, 1054,  -64,  -64,
+ /*   350 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   360 */   -64,  -64,
 };
 static VVACTIONTYPE vv_default[] = {
- /*     0 */   500,  500,  500,  350,  352,  353,  354,  355,  356,  357,
- /*    10 */   358,  359,  360,  361,  362,  363,  364,  365,  366,  367,
- /*    20 */   368,  369,  370,  371,  500,  500,  500,  500,  500,  500,
- /*    30 */   500,  372,  500,  500,  500,  500,  500,  374,  500,  500,
- /*    40 */   377,  500,  500,  427,  500,  500,  428,  500,  431,  500,
- /*    50 */   433,  500,  435,  500,  436,  500,  437,  500,  438,  500,
- /*    60 */   439,  500,  440,  500,  441,  500,  457,  500,  456,  500,
- /*    70 */   458,  500,  459,  500,  460,  500,  461,  500,  462,  500,
- /*    80 */   463,  500,  464,  500,  465,  500,  500,  466,  468,  469,
- /*    90 */   500,  500,  475,  500,  500,  500,  476,  500,  491,  500,
- /*   100 */   467,  500,  500,  470,  500,  485,  471,  500,  472,  500,
- /*   110 */   500,  473,  500,  474,  483,  495,  500,  484,  486,  493,
- /*   120 */   494,  495,  496,  497,  498,  499,  482,  500,  487,  500,
- /*   130 */   489,  495,  500,  492,  488,  490,  500,  500,  477,  500,
- /*   140 */   500,  500,  500,  478,  500,  479,  494,  493,  443,  445,
- /*   150 */   447,  449,  451,  453,  455,  442,  444,  446,  448,  450,
- /*   160 */   452,  454,  500,  434,  500,  432,  430,  429,  500,  378,
- /*   170 */   500,  500,  500,  500,  500,  500,  500,  500,  379,  500,
- /*   180 */   500,  383,  500,  384,  500,  500,  386,  500,  387,  500,
- /*   190 */   388,  500,  389,  500,  390,  500,  500,  392,  500,  391,
- /*   200 */   393,  385,  500,  500,  500,  500,  500,  500,  500,  500,
- /*   210 */   394,  500,  500,  500,  500,  487,  500,  500,  500,  500,
- /*   220 */   406,  408,  500,  500,  500,  500,  500,  500,  410,  500,
- /*   230 */   500,  500,  500,  500,  500,  412,  500,  500,  500,  500,
- /*   240 */   409,  500,  500,  500,  416,  426,  500,  500,  417,  500,
- /*   250 */   500,  418,  500,  500,  419,  500,  500,  420,  500,  500,
- /*   260 */   421,  500,  500,  500,  500,  500,  500,  422,  500,  424,
- /*   270 */   500,  425,  351,  500,  500,  500,  500,  500,  423,  500,
- /*   280 */   500,  500,  500,  500,  413,  500,  500,  500,  500,  411,
- /*   290 */   488,  500,  500,  500,  407,  500,  500,  500,  500,  500,
- /*   300 */   500,  395,  500,  396,  398,  500,  399,  400,  401,  402,
- /*   310 */   403,  404,  405,  397,  500,  500,  500,  500,  500,  500,
- /*   320 */   380,  500,  500,  500,  500,  500,  500,  500,  500,  381,
- /*   330 */   500,  500,  500,  500,  500,  500,  382,  500,  500,  375,
- /*   340 */   500,  500,  373,  500,  500,  500,  500,  376,
+ /*     0 */   517,  517,  517,  364,  366,  367,  368,  369,  370,  371,
+ /*    10 */   372,  373,  374,  375,  376,  377,  378,  379,  380,  381,
+ /*    20 */   382,  383,  384,  385,  517,  517,  517,  517,  517,  517,
+ /*    30 */   517,  386,  517,  517,  517,  517,  517,  388,  517,  517,
+ /*    40 */   391,  517,  517,  444,  517,  517,  445,  517,  448,  517,
+ /*    50 */   450,  517,  452,  517,  453,  517,  454,  517,  455,  517,
+ /*    60 */   456,  517,  457,  517,  458,  517,  474,  517,  473,  517,
+ /*    70 */   475,  517,  476,  517,  477,  517,  478,  517,  479,  517,
+ /*    80 */   480,  517,  481,  517,  482,  517,  517,  483,  485,  486,
+ /*    90 */   517,  517,  492,  517,  517,  517,  493,  517,  508,  517,
+ /*   100 */   484,  517,  517,  487,  517,  502,  488,  517,  489,  517,
+ /*   110 */   517,  490,  517,  491,  500,  512,  517,  501,  503,  510,
+ /*   120 */   511,  512,  513,  514,  515,  516,  499,  517,  504,  517,
+ /*   130 */   506,  512,  517,  509,  505,  507,  517,  517,  494,  517,
+ /*   140 */   517,  517,  517,  495,  517,  496,  511,  510,  460,  462,
+ /*   150 */   464,  466,  468,  470,  472,  459,  461,  463,  465,  467,
+ /*   160 */   469,  471,  517,  451,  517,  449,  447,  446,  517,  392,
+ /*   170 */   517,  517,  517,  517,  517,  517,  517,  517,  393,  517,
+ /*   180 */   517,  397,  517,  398,  517,  517,  400,  517,  401,  517,
+ /*   190 */   402,  517,  403,  517,  404,  517,  517,  406,  517,  405,
+ /*   200 */   407,  399,  517,  517,  517,  517,  517,  517,  517,  517,
+ /*   210 */   408,  517,  517,  517,  517,  504,  517,  517,  517,  517,
+ /*   220 */   420,  422,  517,  517,  517,  517,  517,  517,  424,  517,
+ /*   230 */   517,  517,  517,  517,  517,  426,  517,  517,  517,  517,
+ /*   240 */   423,  517,  517,  517,  433,  443,  517,  517,  434,  517,
+ /*   250 */   517,  435,  517,  517,  436,  517,  517,  437,  517,  517,
+ /*   260 */   438,  517,  517,  517,  517,  517,  517,  439,  517,  441,
+ /*   270 */   517,  442,  365,  517,  517,  517,  517,  517,  440,  517,
+ /*   280 */   517,  517,  517,  517,  427,  517,  517,  517,  517,  517,
+ /*   290 */   428,  517,  517,  517,  517,  517,  517,  429,  517,  517,
+ /*   300 */   517,  517,  517,  425,  505,  517,  517,  517,  421,  517,
+ /*   310 */   517,  517,  517,  517,  517,  409,  517,  410,  412,  517,
+ /*   320 */   413,  414,  415,  416,  417,  418,  419,  411,  517,  517,
+ /*   330 */   517,  517,  517,  517,  394,  517,  517,  517,  517,  517,
+ /*   340 */   517,  517,  517,  395,  517,  517,  517,  517,  517,  517,
+ /*   350 */   396,  517,  517,  389,  517,  517,  387,  517,  517,  517,
+ /*   360 */   517,  390,
 };
 #define VV_SZ_ACTTAB (sizeof(vv_action)/sizeof(vv_action[0]))
 
@@ -1390,8 +1471,9 @@ static const char *vvTokenName[] = {
   "raw_statement",  "break_statement",  "continue_statement",  "macro_statement",
   "empty_statement",  "macro_call_statement",  "expr",          "set_assignments",
   "set_assignment",  "assignable_expr",  "macro_parameters",  "macro_parameter",
-  "macro_parameter_default",  "argument_list",  "cache_lifetime",  "array_list",  
-  "slice_offset",  "array_item",    "function_call",  "argument_item",
+  "macro_parameter_default",  "argument_list",  "cache_lifetime",  "cache_tags",  
+  "array_list",    "slice_offset",  "array_item",    "function_call",
+  "argument_item",
 };
 #endif /* NDEBUG */
 
@@ -1465,92 +1547,95 @@ static const char *vvRuleName[] = {
  /*  63 */ "block_statement ::= OPEN_DELIMITER BLOCK IDENTIFIER CLOSE_DELIMITER OPEN_DELIMITER ENDBLOCK CLOSE_DELIMITER",
  /*  64 */ "cache_statement ::= OPEN_DELIMITER CACHE expr CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
  /*  65 */ "cache_statement ::= OPEN_DELIMITER CACHE expr cache_lifetime CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
- /*  66 */ "cache_lifetime ::= INTEGER",
- /*  67 */ "cache_lifetime ::= IDENTIFIER",
- /*  68 */ "raw_statement ::= OPEN_DELIMITER RAW CLOSE_DELIMITER statement OPEN_DELIMITER ENDRAW CLOSE_DELIMITER",
- /*  69 */ "extends_statement ::= OPEN_DELIMITER EXTENDS expr CLOSE_DELIMITER",
- /*  70 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr CLOSE_DELIMITER",
- /*  71 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr WITH expr CLOSE_DELIMITER",
- /*  72 */ "do_statement ::= OPEN_DELIMITER DO expr CLOSE_DELIMITER",
- /*  73 */ "return_statement ::= OPEN_DELIMITER RETURN expr CLOSE_DELIMITER",
- /*  74 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE FALSE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
- /*  75 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE TRUE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
- /*  76 */ "break_statement ::= OPEN_DELIMITER BREAK CLOSE_DELIMITER",
- /*  77 */ "continue_statement ::= OPEN_DELIMITER CONTINUE CLOSE_DELIMITER",
- /*  78 */ "raw_fragment ::= RAW_FRAGMENT",
- /*  79 */ "expr ::= MINUS expr",
- /*  80 */ "expr ::= PLUS expr",
- /*  81 */ "expr ::= expr MINUS expr",
- /*  82 */ "expr ::= expr PLUS expr",
- /*  83 */ "expr ::= expr TIMES expr",
- /*  84 */ "expr ::= expr TIMES TIMES expr",
- /*  85 */ "expr ::= expr DIVIDE expr",
- /*  86 */ "expr ::= expr DIVIDE DIVIDE expr",
- /*  87 */ "expr ::= expr MOD expr",
- /*  88 */ "expr ::= expr AND expr",
- /*  89 */ "expr ::= expr OR expr",
- /*  90 */ "expr ::= expr CONCAT expr",
- /*  91 */ "expr ::= expr PIPE expr",
- /*  92 */ "expr ::= expr RANGE expr",
- /*  93 */ "expr ::= expr EQUALS expr",
- /*  94 */ "expr ::= expr NOTEQUALS DEFINED",
- /*  95 */ "expr ::= expr IS DEFINED",
- /*  96 */ "expr ::= expr NOTEQUALS EMPTY",
- /*  97 */ "expr ::= expr IS EMPTY",
- /*  98 */ "expr ::= expr NOTEQUALS EVEN",
- /*  99 */ "expr ::= expr IS EVEN",
- /* 100 */ "expr ::= expr NOTEQUALS ODD",
- /* 101 */ "expr ::= expr IS ODD",
- /* 102 */ "expr ::= expr NOTEQUALS NUMERIC",
- /* 103 */ "expr ::= expr IS NUMERIC",
- /* 104 */ "expr ::= expr NOTEQUALS SCALAR",
- /* 105 */ "expr ::= expr IS SCALAR",
- /* 106 */ "expr ::= expr NOTEQUALS ITERABLE",
- /* 107 */ "expr ::= expr IS ITERABLE",
- /* 108 */ "expr ::= expr IS expr",
- /* 109 */ "expr ::= expr NOTEQUALS expr",
- /* 110 */ "expr ::= expr IDENTICAL expr",
- /* 111 */ "expr ::= expr NOTIDENTICAL expr",
- /* 112 */ "expr ::= expr LESS expr",
- /* 113 */ "expr ::= expr GREATER expr",
- /* 114 */ "expr ::= expr GREATEREQUAL expr",
- /* 115 */ "expr ::= expr LESSEQUAL expr",
- /* 116 */ "expr ::= expr DOT expr",
- /* 117 */ "expr ::= expr IN expr",
- /* 118 */ "expr ::= expr NOT IN expr",
- /* 119 */ "expr ::= NOT expr",
- /* 120 */ "expr ::= expr INCR",
- /* 121 */ "expr ::= expr DECR",
- /* 122 */ "expr ::= PARENTHESES_OPEN expr PARENTHESES_CLOSE",
- /* 123 */ "expr ::= SBRACKET_OPEN SBRACKET_CLOSE",
- /* 124 */ "expr ::= SBRACKET_OPEN array_list SBRACKET_CLOSE",
- /* 125 */ "expr ::= CBRACKET_OPEN CBRACKET_CLOSE",
- /* 126 */ "expr ::= CBRACKET_OPEN array_list CBRACKET_CLOSE",
- /* 127 */ "expr ::= expr SBRACKET_OPEN expr SBRACKET_CLOSE",
- /* 128 */ "expr ::= expr QUESTION expr COLON expr",
- /* 129 */ "expr ::= expr SBRACKET_OPEN COLON slice_offset SBRACKET_CLOSE",
- /* 130 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON SBRACKET_CLOSE",
- /* 131 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON slice_offset SBRACKET_CLOSE",
- /* 132 */ "slice_offset ::= INTEGER",
- /* 133 */ "slice_offset ::= IDENTIFIER",
- /* 134 */ "array_list ::= array_list COMMA array_item",
- /* 135 */ "array_list ::= array_item",
- /* 136 */ "array_item ::= STRING COLON expr",
- /* 137 */ "array_item ::= expr",
- /* 138 */ "expr ::= function_call",
- /* 139 */ "function_call ::= expr PARENTHESES_OPEN argument_list PARENTHESES_CLOSE",
- /* 140 */ "function_call ::= expr PARENTHESES_OPEN PARENTHESES_CLOSE",
- /* 141 */ "argument_list ::= argument_list COMMA argument_item",
- /* 142 */ "argument_list ::= argument_item",
- /* 143 */ "argument_item ::= expr",
- /* 144 */ "argument_item ::= STRING COLON expr",
- /* 145 */ "expr ::= IDENTIFIER",
- /* 146 */ "expr ::= INTEGER",
- /* 147 */ "expr ::= STRING",
- /* 148 */ "expr ::= DOUBLE",
- /* 149 */ "expr ::= NULL",
- /* 150 */ "expr ::= FALSE",
- /* 151 */ "expr ::= TRUE",
+ /*  66 */ "cache_statement ::= OPEN_DELIMITER CACHE expr cache_tags CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
+ /*  67 */ "cache_statement ::= OPEN_DELIMITER CACHE expr INTEGER cache_tags CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
+ /*  68 */ "cache_tags ::= IDENTIFIER expr",
+ /*  69 */ "cache_lifetime ::= INTEGER",
+ /*  70 */ "cache_lifetime ::= IDENTIFIER",
+ /*  71 */ "raw_statement ::= OPEN_DELIMITER RAW CLOSE_DELIMITER statement OPEN_DELIMITER ENDRAW CLOSE_DELIMITER",
+ /*  72 */ "extends_statement ::= OPEN_DELIMITER EXTENDS expr CLOSE_DELIMITER",
+ /*  73 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr CLOSE_DELIMITER",
+ /*  74 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr WITH expr CLOSE_DELIMITER",
+ /*  75 */ "do_statement ::= OPEN_DELIMITER DO expr CLOSE_DELIMITER",
+ /*  76 */ "return_statement ::= OPEN_DELIMITER RETURN expr CLOSE_DELIMITER",
+ /*  77 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE FALSE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
+ /*  78 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE TRUE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
+ /*  79 */ "break_statement ::= OPEN_DELIMITER BREAK CLOSE_DELIMITER",
+ /*  80 */ "continue_statement ::= OPEN_DELIMITER CONTINUE CLOSE_DELIMITER",
+ /*  81 */ "raw_fragment ::= RAW_FRAGMENT",
+ /*  82 */ "expr ::= MINUS expr",
+ /*  83 */ "expr ::= PLUS expr",
+ /*  84 */ "expr ::= expr MINUS expr",
+ /*  85 */ "expr ::= expr PLUS expr",
+ /*  86 */ "expr ::= expr TIMES expr",
+ /*  87 */ "expr ::= expr TIMES TIMES expr",
+ /*  88 */ "expr ::= expr DIVIDE expr",
+ /*  89 */ "expr ::= expr DIVIDE DIVIDE expr",
+ /*  90 */ "expr ::= expr MOD expr",
+ /*  91 */ "expr ::= expr AND expr",
+ /*  92 */ "expr ::= expr OR expr",
+ /*  93 */ "expr ::= expr CONCAT expr",
+ /*  94 */ "expr ::= expr PIPE expr",
+ /*  95 */ "expr ::= expr RANGE expr",
+ /*  96 */ "expr ::= expr EQUALS expr",
+ /*  97 */ "expr ::= expr NOTEQUALS DEFINED",
+ /*  98 */ "expr ::= expr IS DEFINED",
+ /*  99 */ "expr ::= expr NOTEQUALS EMPTY",
+ /* 100 */ "expr ::= expr IS EMPTY",
+ /* 101 */ "expr ::= expr NOTEQUALS EVEN",
+ /* 102 */ "expr ::= expr IS EVEN",
+ /* 103 */ "expr ::= expr NOTEQUALS ODD",
+ /* 104 */ "expr ::= expr IS ODD",
+ /* 105 */ "expr ::= expr NOTEQUALS NUMERIC",
+ /* 106 */ "expr ::= expr IS NUMERIC",
+ /* 107 */ "expr ::= expr NOTEQUALS SCALAR",
+ /* 108 */ "expr ::= expr IS SCALAR",
+ /* 109 */ "expr ::= expr NOTEQUALS ITERABLE",
+ /* 110 */ "expr ::= expr IS ITERABLE",
+ /* 111 */ "expr ::= expr IS expr",
+ /* 112 */ "expr ::= expr NOTEQUALS expr",
+ /* 113 */ "expr ::= expr IDENTICAL expr",
+ /* 114 */ "expr ::= expr NOTIDENTICAL expr",
+ /* 115 */ "expr ::= expr LESS expr",
+ /* 116 */ "expr ::= expr GREATER expr",
+ /* 117 */ "expr ::= expr GREATEREQUAL expr",
+ /* 118 */ "expr ::= expr LESSEQUAL expr",
+ /* 119 */ "expr ::= expr DOT expr",
+ /* 120 */ "expr ::= expr IN expr",
+ /* 121 */ "expr ::= expr NOT IN expr",
+ /* 122 */ "expr ::= NOT expr",
+ /* 123 */ "expr ::= expr INCR",
+ /* 124 */ "expr ::= expr DECR",
+ /* 125 */ "expr ::= PARENTHESES_OPEN expr PARENTHESES_CLOSE",
+ /* 126 */ "expr ::= SBRACKET_OPEN SBRACKET_CLOSE",
+ /* 127 */ "expr ::= SBRACKET_OPEN array_list SBRACKET_CLOSE",
+ /* 128 */ "expr ::= CBRACKET_OPEN CBRACKET_CLOSE",
+ /* 129 */ "expr ::= CBRACKET_OPEN array_list CBRACKET_CLOSE",
+ /* 130 */ "expr ::= expr SBRACKET_OPEN expr SBRACKET_CLOSE",
+ /* 131 */ "expr ::= expr QUESTION expr COLON expr",
+ /* 132 */ "expr ::= expr SBRACKET_OPEN COLON slice_offset SBRACKET_CLOSE",
+ /* 133 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON SBRACKET_CLOSE",
+ /* 134 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON slice_offset SBRACKET_CLOSE",
+ /* 135 */ "slice_offset ::= INTEGER",
+ /* 136 */ "slice_offset ::= IDENTIFIER",
+ /* 137 */ "array_list ::= array_list COMMA array_item",
+ /* 138 */ "array_list ::= array_item",
+ /* 139 */ "array_item ::= STRING COLON expr",
+ /* 140 */ "array_item ::= expr",
+ /* 141 */ "expr ::= function_call",
+ /* 142 */ "function_call ::= expr PARENTHESES_OPEN argument_list PARENTHESES_CLOSE",
+ /* 143 */ "function_call ::= expr PARENTHESES_OPEN PARENTHESES_CLOSE",
+ /* 144 */ "argument_list ::= argument_list COMMA argument_item",
+ /* 145 */ "argument_list ::= argument_item",
+ /* 146 */ "argument_item ::= expr",
+ /* 147 */ "argument_item ::= STRING COLON expr",
+ /* 148 */ "expr ::= IDENTIFIER",
+ /* 149 */ "expr ::= INTEGER",
+ /* 150 */ "expr ::= STRING",
+ /* 151 */ "expr ::= DOUBLE",
+ /* 152 */ "expr ::= NULL",
+ /* 153 */ "expr ::= FALSE",
+ /* 154 */ "expr ::= TRUE",
 };
 #endif /* NDEBUG */
 
@@ -1692,7 +1777,7 @@ static void vv_destructor(VVCODETYPE vvmajor, VVMINORTYPE *vvpminor){
     case 82:
     case 83:
     case 84:
-// 716 "parser.lemon"
+// 753 "parser.lemon"
 {
 	if ((vvpminor->vv0)) {
 		if ((vvpminor->vv0)->free_flag) {
@@ -1701,7 +1786,7 @@ static void vv_destructor(VVCODETYPE vvmajor, VVMINORTYPE *vvpminor){
 		efree((vvpminor->vv0));
 	}
 }
-// 1705 "parser.c"
+// 1790 "parser.c"
       break;
     case 88:
     case 89:
@@ -1737,9 +1822,10 @@ static void vv_destructor(VVCODETYPE vvmajor, VVMINORTYPE *vvpminor){
     case 121:
     case 122:
     case 123:
-// 733 "parser.lemon"
-{ zval_ptr_dtor(&(vvpminor->vv40)); }
-// 1743 "parser.c"
+    case 124:
+// 770 "parser.lemon"
+{ zval_ptr_dtor(&(vvpminor->vv158)); }
+// 1829 "parser.c"
       break;
     default:  break;   /* If no destructor action specified: do nothing */
   }
@@ -1981,6 +2067,9 @@ static struct {
   { 97, 7 },
   { 98, 8 },
   { 98, 9 },
+  { 98, 9 },
+  { 98, 10 },
+  { 119, 2 },
   { 118, 1 },
   { 118, 1 },
   { 104, 7 },
@@ -2047,19 +2136,19 @@ static struct {
   { 110, 5 },
   { 110, 5 },
   { 110, 6 },
-  { 120, 1 },
-  { 120, 1 },
-  { 119, 3 },
-  { 119, 1 },
-  { 121, 3 },
   { 121, 1 },
-  { 110, 1 },
-  { 122, 4 },
+  { 121, 1 },
+  { 120, 3 },
+  { 120, 1 },
   { 122, 3 },
+  { 122, 1 },
+  { 110, 1 },
+  { 123, 4 },
+  { 123, 3 },
   { 117, 3 },
   { 117, 1 },
-  { 123, 1 },
-  { 123, 3 },
+  { 124, 1 },
+  { 124, 3 },
   { 110, 1 },
   { 110, 1 },
   { 110, 1 },
@@ -2104,11 +2193,11 @@ static void vv_reduce(
   **     break;
   */
       case 0:
-// 725 "parser.lemon"
+// 762 "parser.lemon"
 {
-	status->ret = vvmsp[0].minor.vv40;
+	status->ret = vvmsp[0].minor.vv158;
 }
-// 2112 "parser.c"
+// 2201 "parser.c"
         break;
       case 1:
       case 4:
@@ -2131,35 +2220,35 @@ static void vv_reduce(
       case 21:
       case 22:
       case 23:
-      case 138:
-// 729 "parser.lemon"
+      case 141:
+// 766 "parser.lemon"
 {
-	vvgotominor.vv40 = vvmsp[0].minor.vv40;
+	vvgotominor.vv158 = vvmsp[0].minor.vv158;
 }
-// 2140 "parser.c"
+// 2229 "parser.c"
         break;
       case 2:
-// 735 "parser.lemon"
+// 772 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_zval_list(vvmsp[-1].minor.vv40, vvmsp[0].minor.vv40);
+	vvgotominor.vv158 = phvolt_ret_zval_list(vvmsp[-1].minor.vv158, vvmsp[0].minor.vv158);
 }
-// 2147 "parser.c"
+// 2236 "parser.c"
         break;
       case 3:
       case 37:
       case 49:
-      case 135:
-      case 142:
-// 739 "parser.lemon"
+      case 138:
+      case 145:
+// 776 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_zval_list(NULL, vvmsp[0].minor.vv40);
+	vvgotominor.vv158 = phvolt_ret_zval_list(NULL, vvmsp[0].minor.vv158);
 }
-// 2158 "parser.c"
+// 2247 "parser.c"
         break;
       case 24:
-// 827 "parser.lemon"
+// 864 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_if_statement(vvmsp[-5].minor.vv40, vvmsp[-3].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_if_statement(vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-7].minor);
   vv_destructor(31,&vvmsp[-6].minor);
   vv_destructor(32,&vvmsp[-4].minor);
@@ -2167,12 +2256,12 @@ static void vv_reduce(
   vv_destructor(33,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2171 "parser.c"
+// 2260 "parser.c"
         break;
       case 25:
-// 831 "parser.lemon"
+// 868 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_if_statement(vvmsp[-4].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_if_statement(vvmsp[-4].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-6].minor);
   vv_destructor(31,&vvmsp[-5].minor);
   vv_destructor(32,&vvmsp[-3].minor);
@@ -2180,12 +2269,12 @@ static void vv_reduce(
   vv_destructor(33,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2184 "parser.c"
+// 2273 "parser.c"
         break;
       case 26:
-// 835 "parser.lemon"
+// 872 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_if_statement(vvmsp[-9].minor.vv40, vvmsp[-7].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_if_statement(vvmsp[-9].minor.vv158, vvmsp[-7].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-11].minor);
   vv_destructor(31,&vvmsp[-10].minor);
   vv_destructor(32,&vvmsp[-8].minor);
@@ -2196,12 +2285,12 @@ static void vv_reduce(
   vv_destructor(33,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2200 "parser.c"
+// 2289 "parser.c"
         break;
       case 27:
-// 839 "parser.lemon"
+// 876 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_if_statement(vvmsp[-8].minor.vv40, vvmsp[-6].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_if_statement(vvmsp[-8].minor.vv158, vvmsp[-6].minor.vv158, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-10].minor);
   vv_destructor(31,&vvmsp[-9].minor);
   vv_destructor(32,&vvmsp[-7].minor);
@@ -2212,12 +2301,12 @@ static void vv_reduce(
   vv_destructor(33,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2216 "parser.c"
+// 2305 "parser.c"
         break;
       case 28:
-// 843 "parser.lemon"
+// 880 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_if_statement(vvmsp[-7].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_if_statement(vvmsp[-7].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-9].minor);
   vv_destructor(31,&vvmsp[-8].minor);
   vv_destructor(32,&vvmsp[-6].minor);
@@ -2228,32 +2317,32 @@ static void vv_reduce(
   vv_destructor(33,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2232 "parser.c"
+// 2321 "parser.c"
         break;
       case 29:
-// 849 "parser.lemon"
+// 886 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_elseif_statement(vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_elseif_statement(vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(35,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2242 "parser.c"
+// 2331 "parser.c"
         break;
       case 30:
-// 855 "parser.lemon"
+// 892 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_elsefor_statement(status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_elsefor_statement(status->scanner_state);
   vv_destructor(1,&vvmsp[-2].minor);
   vv_destructor(36,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2252 "parser.c"
+// 2341 "parser.c"
         break;
       case 31:
-// 861 "parser.lemon"
+// 898 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_for_statement(vvmsp[-7].minor.vv0, NULL, vvmsp[-5].minor.vv40, NULL, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_for_statement(vvmsp[-7].minor.vv0, NULL, vvmsp[-5].minor.vv158, NULL, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-9].minor);
   vv_destructor(37,&vvmsp[-8].minor);
   vv_destructor(3,&vvmsp[-6].minor);
@@ -2262,12 +2351,12 @@ static void vv_reduce(
   vv_destructor(39,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2266 "parser.c"
+// 2355 "parser.c"
         break;
       case 32:
-// 865 "parser.lemon"
+// 902 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_for_statement(vvmsp[-9].minor.vv0, NULL, vvmsp[-7].minor.vv40, vvmsp[-5].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_for_statement(vvmsp[-9].minor.vv0, NULL, vvmsp[-7].minor.vv158, vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-11].minor);
   vv_destructor(37,&vvmsp[-10].minor);
   vv_destructor(3,&vvmsp[-8].minor);
@@ -2277,12 +2366,12 @@ static void vv_reduce(
   vv_destructor(39,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2281 "parser.c"
+// 2370 "parser.c"
         break;
       case 33:
-// 869 "parser.lemon"
+// 906 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_for_statement(vvmsp[-7].minor.vv0, vvmsp[-9].minor.vv0, vvmsp[-5].minor.vv40, NULL, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_for_statement(vvmsp[-7].minor.vv0, vvmsp[-9].minor.vv0, vvmsp[-5].minor.vv158, NULL, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-11].minor);
   vv_destructor(37,&vvmsp[-10].minor);
   vv_destructor(2,&vvmsp[-8].minor);
@@ -2292,12 +2381,12 @@ static void vv_reduce(
   vv_destructor(39,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2296 "parser.c"
+// 2385 "parser.c"
         break;
       case 34:
-// 873 "parser.lemon"
+// 910 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_for_statement(vvmsp[-9].minor.vv0, vvmsp[-11].minor.vv0, vvmsp[-7].minor.vv40, vvmsp[-5].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_for_statement(vvmsp[-9].minor.vv0, vvmsp[-11].minor.vv0, vvmsp[-7].minor.vv158, vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-13].minor);
   vv_destructor(37,&vvmsp[-12].minor);
   vv_destructor(2,&vvmsp[-10].minor);
@@ -2308,102 +2397,102 @@ static void vv_reduce(
   vv_destructor(39,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2312 "parser.c"
+// 2401 "parser.c"
         break;
       case 35:
-// 879 "parser.lemon"
+// 916 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_statement(vvmsp[-1].minor.vv40);
+	vvgotominor.vv158 = phvolt_ret_set_statement(vvmsp[-1].minor.vv158);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(40,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2322 "parser.c"
+// 2411 "parser.c"
         break;
       case 36:
       case 48:
-      case 134:
-      case 141:
-// 885 "parser.lemon"
+      case 137:
+      case 144:
+// 922 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_zval_list(vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40);
+	vvgotominor.vv158 = phvolt_ret_zval_list(vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158);
   vv_destructor(2,&vvmsp[-1].minor);
 }
-// 2333 "parser.c"
+// 2422 "parser.c"
         break;
       case 38:
-// 895 "parser.lemon"
+// 932 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv40, PHVOLT_T_ASSIGN, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv158, PHVOLT_T_ASSIGN, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(41,&vvmsp[-1].minor);
 }
-// 2341 "parser.c"
+// 2430 "parser.c"
         break;
       case 39:
-// 899 "parser.lemon"
+// 936 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv40, PHVOLT_T_ADD_ASSIGN, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv158, PHVOLT_T_ADD_ASSIGN, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(42,&vvmsp[-1].minor);
 }
-// 2349 "parser.c"
+// 2438 "parser.c"
         break;
       case 40:
-// 903 "parser.lemon"
+// 940 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv40, PHVOLT_T_SUB_ASSIGN, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv158, PHVOLT_T_SUB_ASSIGN, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(43,&vvmsp[-1].minor);
 }
-// 2357 "parser.c"
+// 2446 "parser.c"
         break;
       case 41:
-// 907 "parser.lemon"
+// 944 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv40, PHVOLT_T_MUL_ASSIGN, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv158, PHVOLT_T_MUL_ASSIGN, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(44,&vvmsp[-1].minor);
 }
-// 2365 "parser.c"
+// 2454 "parser.c"
         break;
       case 42:
-// 911 "parser.lemon"
+// 948 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv40, PHVOLT_T_DIV_ASSIGN, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_set_assignment(vvmsp[-2].minor.vv158, PHVOLT_T_DIV_ASSIGN, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(45,&vvmsp[-1].minor);
 }
-// 2373 "parser.c"
+// 2462 "parser.c"
         break;
       case 43:
-      case 67:
-      case 133:
-      case 145:
-// 915 "parser.lemon"
+      case 70:
+      case 136:
+      case 148:
+// 952 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_IDENTIFIER, vvmsp[0].minor.vv0, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_IDENTIFIER, vvmsp[0].minor.vv0, status->scanner_state);
 }
-// 2383 "parser.c"
+// 2472 "parser.c"
         break;
       case 44:
-      case 127:
-// 919 "parser.lemon"
+      case 130:
+// 956 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ARRAYACCESS, vvmsp[-3].minor.vv40, vvmsp[-1].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ARRAYACCESS, vvmsp[-3].minor.vv158, vvmsp[-1].minor.vv158, NULL, status->scanner_state);
   vv_destructor(24,&vvmsp[-2].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 2393 "parser.c"
+// 2482 "parser.c"
         break;
       case 45:
-      case 116:
-// 923 "parser.lemon"
+      case 119:
+// 960 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_DOT, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_DOT, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(30,&vvmsp[-1].minor);
 }
-// 2402 "parser.c"
+// 2491 "parser.c"
         break;
       case 46:
-// 929 "parser.lemon"
+// 966 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_statement(vvmsp[-7].minor.vv0, NULL, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_statement(vvmsp[-7].minor.vv0, NULL, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-9].minor);
   vv_destructor(47,&vvmsp[-8].minor);
   vv_destructor(29,&vvmsp[-6].minor);
@@ -2413,12 +2502,12 @@ static void vv_reduce(
   vv_destructor(49,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2417 "parser.c"
+// 2506 "parser.c"
         break;
       case 47:
-// 933 "parser.lemon"
+// 970 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_statement(vvmsp[-8].minor.vv0, vvmsp[-6].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_statement(vvmsp[-8].minor.vv0, vvmsp[-6].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-10].minor);
   vv_destructor(47,&vvmsp[-9].minor);
   vv_destructor(29,&vvmsp[-7].minor);
@@ -2428,80 +2517,80 @@ static void vv_reduce(
   vv_destructor(49,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2432 "parser.c"
+// 2521 "parser.c"
         break;
       case 50:
-// 949 "parser.lemon"
+// 986 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_parameter(vvmsp[0].minor.vv0, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_parameter(vvmsp[0].minor.vv0, NULL, status->scanner_state);
 }
-// 2439 "parser.c"
+// 2528 "parser.c"
         break;
       case 51:
-// 953 "parser.lemon"
+// 990 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_parameter(vvmsp[-2].minor.vv0, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_parameter(vvmsp[-2].minor.vv0, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(41,&vvmsp[-1].minor);
 }
-// 2447 "parser.c"
+// 2536 "parser.c"
         break;
       case 52:
-      case 66:
-      case 132:
-      case 146:
-// 957 "parser.lemon"
+      case 69:
+      case 135:
+      case 149:
+// 994 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_INTEGER, vvmsp[0].minor.vv0, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_INTEGER, vvmsp[0].minor.vv0, status->scanner_state);
 }
-// 2457 "parser.c"
+// 2546 "parser.c"
         break;
       case 53:
-      case 147:
-// 961 "parser.lemon"
+      case 150:
+// 998 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_STRING, vvmsp[0].minor.vv0, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_STRING, vvmsp[0].minor.vv0, status->scanner_state);
 }
-// 2465 "parser.c"
+// 2554 "parser.c"
         break;
       case 54:
-      case 148:
-// 965 "parser.lemon"
+      case 151:
+// 1002 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_DOUBLE, vvmsp[0].minor.vv0, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_DOUBLE, vvmsp[0].minor.vv0, status->scanner_state);
 }
-// 2473 "parser.c"
+// 2562 "parser.c"
         break;
       case 55:
-      case 149:
-// 969 "parser.lemon"
+      case 152:
+// 1006 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_NULL, NULL, status->scanner_state);
   vv_destructor(53,&vvmsp[0].minor);
 }
-// 2482 "parser.c"
+// 2571 "parser.c"
         break;
       case 56:
-      case 150:
-// 973 "parser.lemon"
+      case 153:
+// 1010 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_FALSE, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_FALSE, NULL, status->scanner_state);
   vv_destructor(54,&vvmsp[0].minor);
 }
-// 2491 "parser.c"
+// 2580 "parser.c"
         break;
       case 57:
-      case 151:
-// 977 "parser.lemon"
+      case 154:
+// 1014 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_TRUE, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_TRUE, NULL, status->scanner_state);
   vv_destructor(55,&vvmsp[0].minor);
 }
-// 2500 "parser.c"
+// 2589 "parser.c"
         break;
       case 58:
-// 983 "parser.lemon"
+// 1020 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_call_statement(vvmsp[-8].minor.vv40, vvmsp[-6].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_call_statement(vvmsp[-8].minor.vv158, vvmsp[-6].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-10].minor);
   vv_destructor(56,&vvmsp[-9].minor);
   vv_destructor(29,&vvmsp[-7].minor);
@@ -2511,12 +2600,12 @@ static void vv_reduce(
   vv_destructor(57,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2515 "parser.c"
+// 2604 "parser.c"
         break;
       case 59:
-// 987 "parser.lemon"
+// 1024 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_macro_call_statement(vvmsp[-6].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_macro_call_statement(vvmsp[-6].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-8].minor);
   vv_destructor(56,&vvmsp[-7].minor);
   vv_destructor(29,&vvmsp[-5].minor);
@@ -2526,30 +2615,30 @@ static void vv_reduce(
   vv_destructor(57,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2530 "parser.c"
+// 2619 "parser.c"
         break;
       case 60:
-// 993 "parser.lemon"
+// 1030 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_empty_statement(status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_empty_statement(status->scanner_state);
   vv_destructor(1,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2539 "parser.c"
+// 2628 "parser.c"
         break;
       case 61:
-// 999 "parser.lemon"
+// 1036 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_echo_statement(vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_echo_statement(vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(58,&vvmsp[-2].minor);
   vv_destructor(59,&vvmsp[0].minor);
 }
-// 2548 "parser.c"
+// 2637 "parser.c"
         break;
       case 62:
-// 1005 "parser.lemon"
+// 1042 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_block_statement(vvmsp[-5].minor.vv0, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_block_statement(vvmsp[-5].minor.vv0, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-7].minor);
   vv_destructor(60,&vvmsp[-6].minor);
   vv_destructor(32,&vvmsp[-4].minor);
@@ -2557,12 +2646,12 @@ static void vv_reduce(
   vv_destructor(61,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2561 "parser.c"
+// 2650 "parser.c"
         break;
       case 63:
-// 1009 "parser.lemon"
+// 1046 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_block_statement(vvmsp[-4].minor.vv0, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_block_statement(vvmsp[-4].minor.vv0, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-6].minor);
   vv_destructor(60,&vvmsp[-5].minor);
   vv_destructor(32,&vvmsp[-3].minor);
@@ -2570,12 +2659,12 @@ static void vv_reduce(
   vv_destructor(61,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2574 "parser.c"
+// 2663 "parser.c"
         break;
       case 64:
-// 1015 "parser.lemon"
+// 1052 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_cache_statement(vvmsp[-5].minor.vv40, NULL, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_cache_statement(vvmsp[-5].minor.vv158, NULL, NULL, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-7].minor);
   vv_destructor(62,&vvmsp[-6].minor);
   vv_destructor(32,&vvmsp[-4].minor);
@@ -2583,12 +2672,12 @@ static void vv_reduce(
   vv_destructor(63,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2587 "parser.c"
+// 2676 "parser.c"
         break;
       case 65:
-// 1019 "parser.lemon"
+// 1056 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_cache_statement(vvmsp[-6].minor.vv40, vvmsp[-5].minor.vv40, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_cache_statement(vvmsp[-6].minor.vv158, vvmsp[-5].minor.vv158, NULL, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-8].minor);
   vv_destructor(62,&vvmsp[-7].minor);
   vv_destructor(32,&vvmsp[-4].minor);
@@ -2596,12 +2685,45 @@ static void vv_reduce(
   vv_destructor(63,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2600 "parser.c"
+// 2689 "parser.c"
+        break;
+      case 66:
+// 1060 "parser.lemon"
+{
+	vvgotominor.vv158 = phvolt_ret_cache_statement(vvmsp[-6].minor.vv158, NULL, vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
+  vv_destructor(1,&vvmsp[-8].minor);
+  vv_destructor(62,&vvmsp[-7].minor);
+  vv_destructor(32,&vvmsp[-4].minor);
+  vv_destructor(1,&vvmsp[-2].minor);
+  vv_destructor(63,&vvmsp[-1].minor);
+  vv_destructor(32,&vvmsp[0].minor);
+}
+// 2702 "parser.c"
+        break;
+      case 67:
+// 1064 "parser.lemon"
+{
+	vvgotominor.vv158 = phvolt_ret_cache_statement(vvmsp[-7].minor.vv158, phvolt_ret_literal_zval(PHVOLT_T_INTEGER, vvmsp[-6].minor.vv0, status->scanner_state), vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, status->scanner_state);
+  vv_destructor(1,&vvmsp[-9].minor);
+  vv_destructor(62,&vvmsp[-8].minor);
+  vv_destructor(32,&vvmsp[-4].minor);
+  vv_destructor(1,&vvmsp[-2].minor);
+  vv_destructor(63,&vvmsp[-1].minor);
+  vv_destructor(32,&vvmsp[0].minor);
+}
+// 2715 "parser.c"
         break;
       case 68:
-// 1035 "parser.lemon"
+// 1070 "parser.lemon"
+{
+	vvgotominor.vv158 = phvolt_ret_cache_tags(vvmsp[-1].minor.vv0, vvmsp[0].minor.vv158, status);
+}
+// 2722 "parser.c"
+        break;
+      case 71:
+// 1086 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_raw_statement(vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_raw_statement(vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-6].minor);
   vv_destructor(64,&vvmsp[-5].minor);
   vv_destructor(32,&vvmsp[-4].minor);
@@ -2609,63 +2731,63 @@ static void vv_reduce(
   vv_destructor(65,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2613 "parser.c"
+// 2735 "parser.c"
         break;
-      case 69:
-// 1041 "parser.lemon"
+      case 72:
+// 1092 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_extends_statement(vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_extends_statement(vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(66,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2623 "parser.c"
+// 2745 "parser.c"
         break;
-      case 70:
-// 1047 "parser.lemon"
+      case 73:
+// 1098 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_include_statement(vvmsp[-1].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_include_statement(vvmsp[-1].minor.vv158, NULL, status->scanner_state);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(67,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2633 "parser.c"
+// 2755 "parser.c"
         break;
-      case 71:
-// 1051 "parser.lemon"
+      case 74:
+// 1102 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_include_statement(vvmsp[-3].minor.vv40, vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_include_statement(vvmsp[-3].minor.vv158, vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-5].minor);
   vv_destructor(67,&vvmsp[-4].minor);
   vv_destructor(68,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2644 "parser.c"
+// 2766 "parser.c"
         break;
-      case 72:
-// 1057 "parser.lemon"
+      case 75:
+// 1108 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_do_statement(vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_do_statement(vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(69,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2654 "parser.c"
+// 2776 "parser.c"
         break;
-      case 73:
-// 1063 "parser.lemon"
+      case 76:
+// 1114 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_return_statement(vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_return_statement(vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-3].minor);
   vv_destructor(70,&vvmsp[-2].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2664 "parser.c"
+// 2786 "parser.c"
         break;
-      case 74:
-// 1069 "parser.lemon"
+      case 77:
+// 1120 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_autoescape_statement(0, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_autoescape_statement(0, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-7].minor);
   vv_destructor(71,&vvmsp[-6].minor);
   vv_destructor(54,&vvmsp[-5].minor);
@@ -2674,12 +2796,12 @@ static void vv_reduce(
   vv_destructor(72,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2678 "parser.c"
+// 2800 "parser.c"
         break;
-      case 75:
-// 1073 "parser.lemon"
+      case 78:
+// 1124 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_autoescape_statement(1, vvmsp[-3].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_autoescape_statement(1, vvmsp[-3].minor.vv158, status->scanner_state);
   vv_destructor(1,&vvmsp[-7].minor);
   vv_destructor(71,&vvmsp[-6].minor);
   vv_destructor(55,&vvmsp[-5].minor);
@@ -2688,506 +2810,506 @@ static void vv_reduce(
   vv_destructor(72,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2692 "parser.c"
+// 2814 "parser.c"
         break;
-      case 76:
-// 1079 "parser.lemon"
+      case 79:
+// 1130 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_break_statement(status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_break_statement(status->scanner_state);
   vv_destructor(1,&vvmsp[-2].minor);
   vv_destructor(73,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2702 "parser.c"
+// 2824 "parser.c"
         break;
-      case 77:
-// 1085 "parser.lemon"
+      case 80:
+// 1136 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_continue_statement(status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_continue_statement(status->scanner_state);
   vv_destructor(1,&vvmsp[-2].minor);
   vv_destructor(74,&vvmsp[-1].minor);
   vv_destructor(32,&vvmsp[0].minor);
 }
-// 2712 "parser.c"
+// 2834 "parser.c"
         break;
-      case 78:
-// 1091 "parser.lemon"
+      case 81:
+// 1142 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_literal_zval(PHVOLT_T_RAW_FRAGMENT, vvmsp[0].minor.vv0, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_literal_zval(PHVOLT_T_RAW_FRAGMENT, vvmsp[0].minor.vv0, status->scanner_state);
 }
-// 2719 "parser.c"
+// 2841 "parser.c"
         break;
-      case 79:
-// 1097 "parser.lemon"
+      case 82:
+// 1148 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_MINUS, NULL, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_MINUS, NULL, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(22,&vvmsp[-1].minor);
 }
-// 2727 "parser.c"
+// 2849 "parser.c"
         break;
-      case 80:
-// 1101 "parser.lemon"
+      case 83:
+// 1152 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_PLUS, NULL, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_PLUS, NULL, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(21,&vvmsp[-1].minor);
 }
-// 2735 "parser.c"
+// 2857 "parser.c"
         break;
-      case 81:
-// 1105 "parser.lemon"
+      case 84:
+// 1156 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_SUB, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_SUB, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(22,&vvmsp[-1].minor);
 }
-// 2743 "parser.c"
+// 2865 "parser.c"
         break;
-      case 82:
-// 1109 "parser.lemon"
+      case 85:
+// 1160 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ADD, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ADD, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(21,&vvmsp[-1].minor);
 }
-// 2751 "parser.c"
+// 2873 "parser.c"
         break;
-      case 83:
-// 1113 "parser.lemon"
+      case 86:
+// 1164 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_MUL, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_MUL, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(19,&vvmsp[-1].minor);
 }
-// 2759 "parser.c"
+// 2881 "parser.c"
         break;
-      case 84:
-// 1117 "parser.lemon"
+      case 87:
+// 1168 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_POW, vvmsp[-3].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_POW, vvmsp[-3].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(19,&vvmsp[-2].minor);
   vv_destructor(19,&vvmsp[-1].minor);
 }
-// 2768 "parser.c"
+// 2890 "parser.c"
         break;
-      case 85:
-// 1121 "parser.lemon"
+      case 88:
+// 1172 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_DIV, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_DIV, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(18,&vvmsp[-1].minor);
 }
-// 2776 "parser.c"
+// 2898 "parser.c"
         break;
-      case 86:
-// 1125 "parser.lemon"
+      case 89:
+// 1176 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_MOD, vvmsp[-3].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_MOD, vvmsp[-3].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(18,&vvmsp[-2].minor);
   vv_destructor(18,&vvmsp[-1].minor);
 }
-// 2785 "parser.c"
+// 2907 "parser.c"
         break;
-      case 87:
-// 1129 "parser.lemon"
+      case 90:
+// 1180 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_MOD, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_MOD, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(20,&vvmsp[-1].minor);
 }
-// 2793 "parser.c"
+// 2915 "parser.c"
         break;
-      case 88:
-// 1133 "parser.lemon"
+      case 91:
+// 1184 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_AND, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_AND, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(7,&vvmsp[-1].minor);
 }
-// 2801 "parser.c"
+// 2923 "parser.c"
         break;
-      case 89:
-// 1137 "parser.lemon"
+      case 92:
+// 1188 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_OR, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_OR, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(8,&vvmsp[-1].minor);
 }
-// 2809 "parser.c"
+// 2931 "parser.c"
         break;
-      case 90:
-// 1141 "parser.lemon"
+      case 93:
+// 1192 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_CONCAT, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_CONCAT, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(23,&vvmsp[-1].minor);
 }
-// 2817 "parser.c"
+// 2939 "parser.c"
         break;
-      case 91:
-// 1145 "parser.lemon"
+      case 94:
+// 1196 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_PIPE, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_PIPE, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(25,&vvmsp[-1].minor);
 }
-// 2825 "parser.c"
+// 2947 "parser.c"
         break;
-      case 92:
-// 1149 "parser.lemon"
+      case 95:
+// 1200 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_RANGE, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_RANGE, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(6,&vvmsp[-1].minor);
 }
-// 2833 "parser.c"
+// 2955 "parser.c"
         break;
-      case 93:
-// 1153 "parser.lemon"
+      case 96:
+// 1204 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_EQUALS, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_EQUALS, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(10,&vvmsp[-1].minor);
 }
-// 2841 "parser.c"
+// 2963 "parser.c"
         break;
-      case 94:
-// 1157 "parser.lemon"
+      case 97:
+// 1208 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISSET, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISSET, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(76,&vvmsp[0].minor);
 }
-// 2850 "parser.c"
+// 2972 "parser.c"
         break;
-      case 95:
-// 1161 "parser.lemon"
+      case 98:
+// 1212 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISSET, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISSET, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(76,&vvmsp[0].minor);
 }
-// 2859 "parser.c"
+// 2981 "parser.c"
         break;
-      case 96:
-// 1165 "parser.lemon"
+      case 99:
+// 1216 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISEMPTY, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISEMPTY, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(77,&vvmsp[0].minor);
 }
-// 2868 "parser.c"
+// 2990 "parser.c"
         break;
-      case 97:
-// 1169 "parser.lemon"
+      case 100:
+// 1220 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISEMPTY, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISEMPTY, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(77,&vvmsp[0].minor);
 }
-// 2877 "parser.c"
+// 2999 "parser.c"
         break;
-      case 98:
-// 1173 "parser.lemon"
+      case 101:
+// 1224 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISEVEN, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISEVEN, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(78,&vvmsp[0].minor);
 }
-// 2886 "parser.c"
+// 3008 "parser.c"
         break;
-      case 99:
-// 1177 "parser.lemon"
+      case 102:
+// 1228 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISEVEN, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISEVEN, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(78,&vvmsp[0].minor);
 }
-// 2895 "parser.c"
+// 3017 "parser.c"
         break;
-      case 100:
-// 1181 "parser.lemon"
+      case 103:
+// 1232 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISODD, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISODD, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(79,&vvmsp[0].minor);
 }
-// 2904 "parser.c"
+// 3026 "parser.c"
         break;
-      case 101:
-// 1185 "parser.lemon"
+      case 104:
+// 1236 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISODD, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISODD, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(79,&vvmsp[0].minor);
 }
-// 2913 "parser.c"
+// 3035 "parser.c"
         break;
-      case 102:
-// 1189 "parser.lemon"
+      case 105:
+// 1240 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISNUMERIC, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISNUMERIC, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(80,&vvmsp[0].minor);
 }
-// 2922 "parser.c"
+// 3044 "parser.c"
         break;
-      case 103:
-// 1193 "parser.lemon"
+      case 106:
+// 1244 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISNUMERIC, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISNUMERIC, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(80,&vvmsp[0].minor);
 }
-// 2931 "parser.c"
+// 3053 "parser.c"
         break;
-      case 104:
-// 1197 "parser.lemon"
+      case 107:
+// 1248 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISSCALAR, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISSCALAR, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(81,&vvmsp[0].minor);
 }
-// 2940 "parser.c"
+// 3062 "parser.c"
         break;
-      case 105:
-// 1201 "parser.lemon"
+      case 108:
+// 1252 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISSCALAR, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISSCALAR, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(81,&vvmsp[0].minor);
 }
-// 2949 "parser.c"
+// 3071 "parser.c"
         break;
-      case 106:
-// 1205 "parser.lemon"
+      case 109:
+// 1256 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_ISITERABLE, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_ISITERABLE, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
   vv_destructor(82,&vvmsp[0].minor);
 }
-// 2958 "parser.c"
+// 3080 "parser.c"
         break;
-      case 107:
-// 1209 "parser.lemon"
+      case 110:
+// 1260 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ISITERABLE, vvmsp[-2].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ISITERABLE, vvmsp[-2].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
   vv_destructor(82,&vvmsp[0].minor);
 }
-// 2967 "parser.c"
+// 3089 "parser.c"
         break;
-      case 108:
-// 1213 "parser.lemon"
+      case 111:
+// 1264 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_IS, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_IS, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(9,&vvmsp[-1].minor);
 }
-// 2975 "parser.c"
+// 3097 "parser.c"
         break;
-      case 109:
-// 1217 "parser.lemon"
+      case 112:
+// 1268 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOTEQUALS, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOTEQUALS, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(11,&vvmsp[-1].minor);
 }
-// 2983 "parser.c"
+// 3105 "parser.c"
         break;
-      case 110:
-// 1221 "parser.lemon"
+      case 113:
+// 1272 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_IDENTICAL, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_IDENTICAL, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(16,&vvmsp[-1].minor);
 }
-// 2991 "parser.c"
+// 3113 "parser.c"
         break;
-      case 111:
-// 1225 "parser.lemon"
+      case 114:
+// 1276 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOTIDENTICAL, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOTIDENTICAL, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(17,&vvmsp[-1].minor);
 }
-// 2999 "parser.c"
+// 3121 "parser.c"
         break;
-      case 112:
-// 1229 "parser.lemon"
+      case 115:
+// 1280 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_LESS, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_LESS, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(12,&vvmsp[-1].minor);
 }
-// 3007 "parser.c"
+// 3129 "parser.c"
         break;
-      case 113:
-// 1233 "parser.lemon"
+      case 116:
+// 1284 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_GREATER, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_GREATER, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(13,&vvmsp[-1].minor);
 }
-// 3015 "parser.c"
+// 3137 "parser.c"
         break;
-      case 114:
-// 1237 "parser.lemon"
+      case 117:
+// 1288 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_GREATEREQUAL, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_GREATEREQUAL, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(14,&vvmsp[-1].minor);
 }
-// 3023 "parser.c"
+// 3145 "parser.c"
         break;
-      case 115:
-// 1241 "parser.lemon"
+      case 118:
+// 1292 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_LESSEQUAL, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_LESSEQUAL, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(15,&vvmsp[-1].minor);
 }
-// 3031 "parser.c"
+// 3153 "parser.c"
         break;
-      case 117:
-// 1249 "parser.lemon"
+      case 120:
+// 1300 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_IN, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_IN, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(3,&vvmsp[-1].minor);
 }
-// 3039 "parser.c"
+// 3161 "parser.c"
         break;
-      case 118:
-// 1253 "parser.lemon"
+      case 121:
+// 1304 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT_IN, vvmsp[-3].minor.vv40, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT_IN, vvmsp[-3].minor.vv158, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(26,&vvmsp[-2].minor);
   vv_destructor(3,&vvmsp[-1].minor);
 }
-// 3048 "parser.c"
+// 3170 "parser.c"
         break;
-      case 119:
-// 1257 "parser.lemon"
+      case 122:
+// 1308 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_NOT, NULL, vvmsp[0].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_NOT, NULL, vvmsp[0].minor.vv158, NULL, status->scanner_state);
   vv_destructor(26,&vvmsp[-1].minor);
 }
-// 3056 "parser.c"
+// 3178 "parser.c"
         break;
-      case 120:
-// 1261 "parser.lemon"
+      case 123:
+// 1312 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_INCR, vvmsp[-1].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_INCR, vvmsp[-1].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(27,&vvmsp[0].minor);
 }
-// 3064 "parser.c"
+// 3186 "parser.c"
         break;
-      case 121:
-// 1265 "parser.lemon"
+      case 124:
+// 1316 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_DECR, vvmsp[-1].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_DECR, vvmsp[-1].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(28,&vvmsp[0].minor);
 }
-// 3072 "parser.c"
+// 3194 "parser.c"
         break;
-      case 122:
-// 1269 "parser.lemon"
+      case 125:
+// 1320 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ENCLOSED, vvmsp[-1].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ENCLOSED, vvmsp[-1].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(29,&vvmsp[-2].minor);
   vv_destructor(48,&vvmsp[0].minor);
 }
-// 3081 "parser.c"
+// 3203 "parser.c"
         break;
-      case 123:
-// 1273 "parser.lemon"
+      case 126:
+// 1324 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
   vv_destructor(24,&vvmsp[-1].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 3090 "parser.c"
+// 3212 "parser.c"
         break;
-      case 124:
-// 1277 "parser.lemon"
+      case 127:
+// 1328 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ARRAY, vvmsp[-1].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ARRAY, vvmsp[-1].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(24,&vvmsp[-2].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 3099 "parser.c"
+// 3221 "parser.c"
         break;
-      case 125:
-// 1281 "parser.lemon"
+      case 128:
+// 1332 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
   vv_destructor(83,&vvmsp[-1].minor);
   vv_destructor(84,&vvmsp[0].minor);
 }
-// 3108 "parser.c"
+// 3230 "parser.c"
         break;
-      case 126:
-// 1285 "parser.lemon"
+      case 129:
+// 1336 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_ARRAY, vvmsp[-1].minor.vv40, NULL, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_ARRAY, vvmsp[-1].minor.vv158, NULL, NULL, status->scanner_state);
   vv_destructor(83,&vvmsp[-2].minor);
   vv_destructor(84,&vvmsp[0].minor);
 }
-// 3117 "parser.c"
+// 3239 "parser.c"
         break;
-      case 128:
-// 1293 "parser.lemon"
+      case 131:
+// 1344 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_expr(PHVOLT_T_TERNARY, vvmsp[-2].minor.vv40, vvmsp[0].minor.vv40, vvmsp[-4].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_expr(PHVOLT_T_TERNARY, vvmsp[-2].minor.vv158, vvmsp[0].minor.vv158, vvmsp[-4].minor.vv158, status->scanner_state);
   vv_destructor(4,&vvmsp[-3].minor);
   vv_destructor(5,&vvmsp[-1].minor);
 }
-// 3126 "parser.c"
+// 3248 "parser.c"
         break;
-      case 129:
-// 1297 "parser.lemon"
+      case 132:
+// 1348 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_slice(vvmsp[-4].minor.vv40, NULL, vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_slice(vvmsp[-4].minor.vv158, NULL, vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(24,&vvmsp[-3].minor);
   vv_destructor(5,&vvmsp[-2].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 3136 "parser.c"
+// 3258 "parser.c"
         break;
-      case 130:
-// 1301 "parser.lemon"
+      case 133:
+// 1352 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_slice(vvmsp[-4].minor.vv40, vvmsp[-2].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_slice(vvmsp[-4].minor.vv158, vvmsp[-2].minor.vv158, NULL, status->scanner_state);
   vv_destructor(24,&vvmsp[-3].minor);
   vv_destructor(5,&vvmsp[-1].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 3146 "parser.c"
+// 3268 "parser.c"
         break;
-      case 131:
-// 1305 "parser.lemon"
+      case 134:
+// 1356 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_slice(vvmsp[-5].minor.vv40, vvmsp[-3].minor.vv40, vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_slice(vvmsp[-5].minor.vv158, vvmsp[-3].minor.vv158, vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(24,&vvmsp[-4].minor);
   vv_destructor(5,&vvmsp[-2].minor);
   vv_destructor(46,&vvmsp[0].minor);
 }
-// 3156 "parser.c"
+// 3278 "parser.c"
         break;
-      case 136:
-      case 144:
-// 1331 "parser.lemon"
+      case 139:
+      case 147:
+// 1382 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_named_item(vvmsp[-2].minor.vv0, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_named_item(vvmsp[-2].minor.vv0, vvmsp[0].minor.vv158, status->scanner_state);
   vv_destructor(5,&vvmsp[-1].minor);
 }
-// 3165 "parser.c"
+// 3287 "parser.c"
         break;
-      case 137:
-      case 143:
-// 1335 "parser.lemon"
+      case 140:
+      case 146:
+// 1386 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_named_item(NULL, vvmsp[0].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_named_item(NULL, vvmsp[0].minor.vv158, status->scanner_state);
 }
-// 3173 "parser.c"
+// 3295 "parser.c"
         break;
-      case 139:
-// 1345 "parser.lemon"
+      case 142:
+// 1396 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_func_call(vvmsp[-3].minor.vv40, vvmsp[-1].minor.vv40, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_func_call(vvmsp[-3].minor.vv158, vvmsp[-1].minor.vv158, status->scanner_state);
   vv_destructor(29,&vvmsp[-2].minor);
   vv_destructor(48,&vvmsp[0].minor);
 }
-// 3182 "parser.c"
+// 3304 "parser.c"
         break;
-      case 140:
-// 1349 "parser.lemon"
+      case 143:
+// 1400 "parser.lemon"
 {
-	vvgotominor.vv40 = phvolt_ret_func_call(vvmsp[-2].minor.vv40, NULL, status->scanner_state);
+	vvgotominor.vv158 = phvolt_ret_func_call(vvmsp[-2].minor.vv158, NULL, status->scanner_state);
   vv_destructor(29,&vvmsp[-1].minor);
   vv_destructor(48,&vvmsp[0].minor);
 }
-// 3191 "parser.c"
+// 3313 "parser.c"
         break;
   };
   vvgoto = vvRuleInfo[vvruleno].lhs;
@@ -3229,7 +3351,7 @@ static void vv_syntax_error(
 ){
   phvolt_ARG_FETCH;
 #define VTOKEN (vvminor.vv0)
-// 618 "parser.lemon"
+// 655 "parser.lemon"
 
 	{
 
@@ -3327,7 +3449,7 @@ static void vv_syntax_error(
 
 	status->status = PHVOLT_PARSING_FAILED;
 
-// 3331 "parser.c"
+// 3453 "parser.c"
   phvolt_ARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
 
@@ -100,6 +100,22 @@ abstract class Backend
 		return existingCache;
 	}
 
+	/**
+	 * Starts capturing a content already known to be missing, e.g. read with getMultiple(),
+	 * without reading it again as start() does
+	 */
+	public function startCapture(lifetime = null) -> void
+	{
+		this->_frontend->start();
+
+		let this->_fresh = true,
+			this->_started = true;
+
+		if typeof lifetime != "null" {
+			let this->_lastLifetime = lifetime;
+		}
+	}
+
 	/**
 	 * Stops the frontend without store any cached content
 	 */
@@ -136,4 +152,105 @@ abstract class Backend
 	{
 		return this->_lastLifetime;
 	}
+
+	/**
+	 * Returns the content of several keys, the keys that don't exist or expired are returned as null.
+	 * Adapters able to read several keys in a single request override this method
+	 *
+	 *<code>
+	 * $contents = $cache->getMultiple(array('sidebar', 'footer'));
+	 *</code>
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var keyName, contents;
+
+		let contents = [];
+		for keyName in keyNames {
+			let contents[keyName] = this->{"get"}(keyName, lifetime);
+		}
+
+		return contents;
+	}
+
+	/**
+	 * Returns the current version of every tag, tags without a version get a new one.
+	 * The versions are read with a single request
+	 *
+	 *<code>
+	 * $versions = $cache->getTagVersions(array('user:42', 'posts'));
+	 *</code>
+	 */
+	public function getTagVersions(array! tags) -> array
+	{
+		var tag, keys, contents, versions, version, key, lastKey;
+
+		let keys = [];
+		for tag in tags {
+			let keys[tag] = "tag_version_" . md5(tag);
+		}
+
+		/**
+		 * A content being captured is still saved with the key it was started with
+		 */
+		let lastKey = this->_lastKey,
+			contents = this->getMultiple(array_values(keys)),
+			versions = [],
+			this->_lastKey = lastKey;
+
+		for tag, key in keys {
+			let version = contents[key];
+			if typeof version != "string" || version === "" {
+				let version = uniqid("", true);
+				this->_saveTagVersion(key, version);
+			}
+			let versions[tag] = version;
+		}
+
+		return versions;
+	}
+
+	/**
+	 * Replaces the version of the tags, every content stored with any of them is no longer served
+	 *
+	 *<code>
+	 * $cache->invalidateTags(array('user:42'));
+	 *</code>
+	 */
+	public function invalidateTags(array! tags) -> void
+	{
+		var tag;
+
+		for tag in tags {
+			this->_saveTagVersion("tag_version_" . md5(tag), uniqid("", true));
+		}
+	}
+
+	/**
+	 * Stores the version of a tag without disturbing a fragment being captured, save() echoes
+	 * the stored content while the frontend is buffering and marks the cache as stopped
+	 */
+	protected function _saveTagVersion(string! key, string! version) -> void
+	{
+		var started, e;
+
+		if !this->_frontend->isBuffering() {
+			this->{"save"}(key, version, null, false);
+			return;
+		}
+
+		let started = this->_started;
+
+		ob_start();
+		try {
+			this->{"save"}(key, version, null, false);
+		} catch \Exception, e {
+			ob_end_clean();
+			let this->_started = started;
+			throw e;
+		}
+		ob_end_clean();
+
+		let this->_started = started;
+	}
 }
@@ -149,6 +149,52 @@ class Memcache extends Backend implements BackendInterface
 		return retrieve;
 	}
 
+	/**
+	 * Returns the content of several keys with a single request
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var memcache, prefix, prefixedKeys, keyName, cachedContents, cachedContent, contents;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keyNames {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		/**
+		 * Memcache::get() only returns the keys that were found when it receives an array
+		 */
+		let cachedContents = memcache->get(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		let contents = [];
+		for keyName in keyNames {
+			if fetch cachedContent, cachedContents[prefix . keyName] {
+				if cachedContent !== false {
+					if is_numeric(cachedContent) {
+						let contents[keyName] = cachedContent;
+					} else {
+						let contents[keyName] = this->_frontend->afterRetrieve(cachedContent);
+					}
+					continue;
+				}
+			}
+			let contents[keyName] = null;
+		}
+
+		return contents;
+	}
+
 	/**
 	 * Stores cached content into the file backend and stops the frontend
 	 *
@@ -171,6 +171,52 @@ class Redis extends Backend implements BackendInterface
 		return frontend->afterRetrieve(cachedContent);
 	}
 
+	/**
+	 * Returns the content of several keys with a single mget() request
+	 */
+	public function getMultiple(array! keyNames, lifetime = null) -> array
+	{
+		var redis, prefix, prefixedKeys, keyName, cachedContents, cachedContent, contents, position;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keyNames {
+			let prefixedKeys[] = "_PHCR" . prefix . keyName;
+		}
+
+		/**
+		 * mget() returns the values in the order of the keys
+		 */
+		let cachedContents = redis->mget(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		let contents = [];
+		for position, keyName in array_values(keyNames) {
+			if fetch cachedContent, cachedContents[position] {
+				if cachedContent {
+					if is_numeric(cachedContent) {
+						let contents[keyName] = cachedContent;
+					} else {
+						let contents[keyName] = this->_frontend->afterRetrieve(cachedContent);
+					}
+					continue;
+				}
+			}
+			let contents[keyName] = null;
+		}
+
+		return contents;
+	}
+
 	/**
 	 * Stores cached content into the file backend and stops the frontend
 	 *
@@ -37,6 +37,17 @@ use Phalcon\Crypt\Exception;
  *
  *	echo $crypt->decrypt($encrypted, $key);
  *</code>
+ *
+ * The AEAD ciphers "chacha20-poly1305" and "aes-256-gcm" authenticate the encrypted text. They're
+ * implemented by libsodium, either the libsodium-php extension (\Sodium\ functions) or the sodium
+ * extension bundled with PHP 7.2, "aes-256-gcm" also needs a CPU with AES-NI. setCipher() throws an
+ * exception if they aren't available, other GCM ciphers aren't supported
+ *
+ *<code>
+ *	$crypt->setCipher('aes-256-gcm');
+ *
+ *	$encrypted = $crypt->encryptBase64($text, $key);
+ *</code>
  */
 class Crypt implements CryptInterface
 {
@@ -49,6 +60,8 @@ class Crypt implements CryptInterface
 
 	protected _cipher = "rijndael-256";
 
+	protected _aeadKey;
+
 	const PADDING_DEFAULT = 0;
 
 	const PADDING_ANSI_X_923 = 1;
@@ -79,6 +92,14 @@ class Crypt implements CryptInterface
 	 */
 	public function setCipher(string! cipher) -> <Crypt>
 	{
+		if cipher == "aes-128-gcm" || cipher == "aes-192-gcm" {
+			throw new Exception("The cipher '" . cipher . "' is not supported, use 'aes-256-gcm' or 'chacha20-poly1305'");
+		}
+
+		if typeof this->_getAeadParameters(cipher) == "array" && this->_getSodiumPrefix(cipher) === false {
+			throw new Exception("The cipher '" . cipher . "' requires libsodium");
+		}
+
 		let this->_cipher = cipher;
 		return this;
 	}
@@ -295,11 +316,7 @@ class Crypt implements CryptInterface
 	 */
 	public function encrypt(string! text, string! key = null) -> string
 	{
-		var encryptKey, ivSize, iv, cipher, mode, blockSize, paddingType, padded;
-
-		if !function_exists("mcrypt_get_iv_size") {
-			throw new Exception("mcrypt extension is required");
-		}
+		var encryptKey, ivSize, iv, cipher, mode, blockSize, paddingType, padded, aead;
 
 		if key === null {
 			let encryptKey = this->_key;
@@ -313,6 +330,15 @@ class Crypt implements CryptInterface
 
 		let cipher = this->_cipher, mode = this->_mode;
 
+		let aead = this->_getAeadParameters(cipher);
+		if typeof aead == "array" {
+			return this->_encryptAead(text, encryptKey, aead);
+		}
+
+		if !function_exists("mcrypt_get_iv_size") {
+			throw new Exception("mcrypt extension is required");
+		}
+
 		let ivSize = mcrypt_get_iv_size(cipher, mode);
 
 		if strlen(encryptKey) > ivSize {
@@ -349,11 +375,7 @@ class Crypt implements CryptInterface
 	 */
 	public function decrypt(string! text, key = null) -> string
 	{
-		var decryptKey, ivSize, cipher, mode, keySize, length, blockSize, paddingType, decrypted;
-
-		if !function_exists("mcrypt_get_iv_size") {
-			throw new Exception("mcrypt extension is required");
-		}
+		var decryptKey, ivSize, cipher, mode, keySize, length, blockSize, paddingType, decrypted, aead;
 
 		if key === null {
 			let decryptKey = this->_key;
@@ -367,6 +389,15 @@ class Crypt implements CryptInterface
 
 		let cipher = this->_cipher, mode = this->_mode;
 
+		let aead = this->_getAeadParameters(cipher);
+		if typeof aead == "array" {
+			return this->_decryptAead(text, decryptKey, aead);
+		}
+
+		if !function_exists("mcrypt_get_iv_size") {
+			throw new Exception("mcrypt extension is required");
+		}
+
 		let ivSize = mcrypt_get_iv_size(cipher, mode);
 
 		let keySize = strlen(decryptKey);
@@ -413,6 +444,171 @@ class Crypt implements CryptInterface
 		return this->decrypt(base64_decode(text), key);
 	}
 
+	/**
+	 * Encrypts several texts returning the results as base64 strings with the same keys
+	 *
+	 *<code>
+	 *	$sealed = $crypt->encryptBase64Many(['session' => $session, 'remember' => $token]);
+	 *</code>
+	 */
+	public function encryptBase64Many(array! texts, key = null, boolean! safe = false) -> array
+	{
+		var name, text, encrypted;
+
+		let encrypted = [];
+		for name, text in texts {
+			let encrypted[name] = this->encryptBase64((string) text, key, safe);
+		}
+
+		return encrypted;
+	}
+
+	/**
+	 * Decrypts several texts coded as base64 strings keeping their keys
+	 */
+	public function decryptBase64Many(array! texts, key = null, boolean! safe = false) -> array
+	{
+		var name, text, decrypted;
+
+		let decrypted = [];
+		for name, text in texts {
+			let decrypted[name] = this->decryptBase64((string) text, key, safe);
+		}
+
+		return decrypted;
+	}
+
+	/**
+	 * Returns the key and nonce sizes of an AEAD cipher or false for the mcrypt ciphers
+	 */
+	protected function _getAeadParameters(string! cipher) -> array | boolean
+	{
+		switch cipher {
+
+			case "aes-256-gcm":
+			case "chacha20-poly1305":
+				return [32, 12];
+		}
+
+		return false;
+	}
+
+	/**
+	 * Returns a key of the size the AEAD cipher requires, keys of other sizes are derived with SHA-256.
+	 * The last key is kept so encrypting many texts with the same key only derives it once
+	 */
+	protected function _getAeadKey(string! key, int keySize) -> string
+	{
+		var aeadKey, derived;
+
+		let aeadKey = this->_aeadKey;
+		if typeof aeadKey == "array" {
+			if aeadKey[0] === key && aeadKey[1] == keySize {
+				return aeadKey[2];
+			}
+		}
+
+		if strlen(key) == keySize {
+			let derived = key;
+		} else {
+			let derived = substr(hash("sha256", key, true), 0, keySize);
+		}
+
+		let this->_aeadKey = [key, keySize, derived];
+
+		return derived;
+	}
+
+	/**
+	 * Returns the prefix of the libsodium functions implementing the current AEAD cipher or false
+	 * if libsodium isn't available. libsodium-php 1.x declares them in the Sodium namespace while
+	 * the extension bundled with PHP 7.2 prefixes them with "sodium_"
+	 */
+	protected function _getSodiumPrefix(string! cipher) -> string | boolean
+	{
+		var prefix;
+
+		for prefix in ["sodium_", "Sodium\\"] {
+
+			if cipher == "chacha20-poly1305" {
+				if function_exists(prefix . "crypto_aead_chacha20poly1305_ietf_encrypt") {
+					return prefix;
+				}
+				continue;
+			}
+
+			if cipher == "aes-256-gcm" && function_exists(prefix . "crypto_aead_aes256gcm_is_available") {
+				if call_user_func(prefix . "crypto_aead_aes256gcm_is_available") {
+					return prefix;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Encrypts and authenticates a text, the result is the nonce followed by the encrypted text and the tag
+	 */
+	protected function _encryptAead(string! text, string! key, array! parameters) -> string
+	{
+		var cipher, aeadKey, nonce, prefix;
+
+		let cipher = this->_cipher,
+			aeadKey = this->_getAeadKey(key, parameters[0]);
+
+		let prefix = this->_getSodiumPrefix(cipher);
+		if typeof prefix != "string" {
+			throw new Exception("The cipher '" . cipher . "' requires libsodium");
+		}
+
+		if function_exists("random_bytes") {
+			let nonce = random_bytes(parameters[1]);
+		} else {
+			let nonce = call_user_func(prefix . "randombytes_buf", parameters[1]);
+		}
+
+		if cipher == "chacha20-poly1305" {
+			return nonce . call_user_func(prefix . "crypto_aead_chacha20poly1305_ietf_encrypt", text, "", nonce, aeadKey);
+		}
+
+		return nonce . call_user_func(prefix . "crypto_aead_aes256gcm_encrypt", text, "", nonce, aeadKey);
+	}
+
+	/**
+	 * Decrypts a text encrypted with an AEAD cipher checking that it wasn't modified
+	 */
+	protected function _decryptAead(string! text, string! key, array! parameters) -> string
+	{
+		var cipher, aeadKey, nonce, encrypted, decrypted, prefix;
+
+		if strlen(text) < parameters[1] + 16 {
+			throw new Exception("The text to decrypt is not valid");
+		}
+
+		let cipher = this->_cipher,
+			aeadKey = this->_getAeadKey(key, parameters[0]),
+			nonce = substr(text, 0, parameters[1]),
+			encrypted = substr(text, parameters[1]);
+
+		let prefix = this->_getSodiumPrefix(cipher);
+		if typeof prefix != "string" {
+			throw new Exception("The cipher '" . cipher . "' requires libsodium");
+		}
+
+		if cipher == "chacha20-poly1305" {
+			let decrypted = call_user_func(prefix . "crypto_aead_chacha20poly1305_ietf_decrypt", encrypted, "", nonce, aeadKey);
+		} else {
+			let decrypted = call_user_func(prefix . "crypto_aead_aes256gcm_decrypt", encrypted, "", nonce, aeadKey);
+		}
+
+		if decrypted === false {
+			throw new Exception("The text to decrypt was modified or the key is not valid");
+		}
+
+		return decrypted;
+	}
+
 	/**
 	 * Returns a list of available cyphers
 	 */
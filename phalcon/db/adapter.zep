@@ -375,6 +375,111 @@ abstract class Adapter implements EventsAwareInterface
 		return this->{"execute"}(insertSql, insertValues, bindDataTypes);
 	}
 
+	/**
+	 * Inserts several rows into a table using a single multi-row INSERT statement
+	 *
+	 * <code>
+	 * // Inserting two robots
+	 * $success = $connection->insertMultiple(
+	 *	 "robots",
+	 *	 array(
+	 *		 array("Astro Boy", 1952),
+	 *		 array("Terminator", 1984)
+	 *	 ),
+	 *	 array("name", "year")
+	 * );
+	 *
+	 * // Next SQL sentence is sent to the database system
+	 * INSERT INTO `robots` (`name`, `year`) VALUES ("Astro boy", 1952), ("Terminator", 1984);
+	 * </code>
+	 *
+	 * @param   string|array table
+	 * @param 	array rows
+	 * @param 	array fields
+	 * @param 	array dataTypes bind types applied to every row
+	 * @return 	boolean
+	 */
+	public function insertMultiple(var table, array! rows, var fields = null, var dataTypes = null) -> boolean
+	{
+		var placeholders, rowsPlaceholders, insertValues, bindDataTypes, bindType,
+			position, value, escapedTable, escapedFields, field, insertSql, values;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		let rowsPlaceholders = [],
+			insertValues = [],
+			bindDataTypes = [];
+
+		/**
+		 * Every row is handled as in insert(): objects are casted using __toString, null values
+		 * are converted to string "null", everything else is passed as "?"
+		 */
+		for values in rows {
+
+			if typeof values != "array" || !count(values) {
+				throw new Exception("Unable to insert into " . table . " without data");
+			}
+
+			let placeholders = [];
+			for position, value in values {
+				if typeof value == "object" {
+					let placeholders[] = (string) value;
+				} else {
+					if typeof value == "null" {
+						let placeholders[] = "null";
+					} else {
+						let placeholders[] = "?";
+						let insertValues[] = value;
+						if typeof dataTypes == "array" {
+							if !fetch bindType, dataTypes[position] {
+								throw new Exception("Incomplete number of bind types");
+							}
+							let bindDataTypes[] = bindType;
+						}
+					}
+				}
+			}
+
+			let rowsPlaceholders[] = "(" . join(", ", placeholders) . ")";
+		}
+
+		if globals_get("db.escape_identifiers") {
+			let escapedTable = this->{"escapeIdentifier"}(table);
+		} else {
+			let escapedTable = table;
+		}
+
+		/**
+		 * Build the final SQL INSERT statement
+		 */
+		if typeof fields == "array" {
+
+			if globals_get("db.escape_identifiers") {
+				let escapedFields = [];
+				for field in fields {
+					let escapedFields[] = this->{"escapeIdentifier"}(field);
+				}
+			} else {
+				let escapedFields = fields;
+			}
+
+			let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES " . join(", ", rowsPlaceholders);
+		} else {
+			let insertSql = "INSERT INTO " . escapedTable . " VALUES " . join(", ", rowsPlaceholders);
+		}
+
+		/**
+		 * Perform the execution via PDO::execute
+		 */
+		if !count(bindDataTypes) {
+			return this->{"execute"}(insertSql, insertValues);
+		}
+
+		return this->{"execute"}(insertSql, insertValues, bindDataTypes);
+	}
+
 	/**
 	 * Inserts data into a table using custom RBDM SQL syntax
 	 *
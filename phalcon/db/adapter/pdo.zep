@@ -54,6 +54,26 @@ abstract class Pdo extends Adapter
 	 */
 	protected _affectedRows;
 
+	/**
+	 * Rows returned or affected by the active SQL statement
+	 */
+	protected _sqlRowCount;
+
+	/**
+	 * Maximum number of prepared statements kept per connection, 0 disables the cache
+	 */
+	protected _statementsCacheSize = 0;
+
+	/**
+	 * Prepared statements indexed by SQL text, from least to most recently used
+	 */
+	protected _preparedStatements;
+
+	/**
+	 * SQL texts whose cached statement is being used by a live Phalcon\Db\Result\Pdo
+	 */
+	protected _leasedStatements;
+
 	/**
 	 * Constructor for Phalcon\Db\Adapter\Pdo
 	 */
@@ -80,13 +100,16 @@ abstract class Pdo extends Adapter
 	 * $connection->connect();
 	 * </code>
 	 *
+	 * Prepared statements can be reused by query() and execute() with the "statementsCache" option,
+	 * which sets the maximum number of statements kept in the connection
+	 *
 	 * @param 	array descriptor
 	 * @return 	boolean
 	 */
 	public function connect(descriptor = null)
 	{
 		var username, password, dsnParts, dsnAttributes,
-			persistent, options, key, value;
+			persistent, options, key, value, statementsCacheSize;
 
 		if descriptor === null {
 			let descriptor = this->_descriptor;
@@ -136,6 +159,20 @@ abstract class Pdo extends Adapter
 			unset descriptor["dialectClass"];
 		}
 
+		/**
+		 * Check if prepared statements must be reused
+		 */
+		if fetch statementsCacheSize, descriptor["statementsCache"] {
+			let this->_statementsCacheSize = (int) statementsCacheSize;
+			unset descriptor["statementsCache"];
+		}
+
+		/**
+		 * Statements prepared in a previous connection can't be reused
+		 */
+		let this->_preparedStatements = [],
+			this->_leasedStatements = [];
+
 		/**
 		 * Check if the user has defined a custom dsn
 		 */
@@ -286,7 +323,8 @@ abstract class Pdo extends Adapter
 	 */
 	public function query(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
 	{
-		var eventsManager, pdo, statement;
+		var eventsManager, pdo, statement, e;
+		boolean leased;
 
 		let eventsManager = <ManagerInterface> this->_eventsManager;
 
@@ -302,11 +340,33 @@ abstract class Pdo extends Adapter
 			}
 		}
 
-		let pdo = <\Pdo> this->_pdo;
+		let pdo = <\Pdo> this->_pdo,
+			leased = false;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+
+			/**
+			 * The cached statement is leased to the result until it's released
+			 */
+			let statement = this->_leaseStatement(sqlStatement, true);
+			if typeof statement == "object" {
+				let leased = true;
+			} else {
+				let statement = pdo->prepare(sqlStatement);
+			}
+
 			if typeof statement == "object" {
-				let statement = this->executePrepared(statement, bindParams, bindTypes);
+
+				/**
+				 * A statement that failed to execute is given back so it isn't leased forever
+				 */
+				try {
+					let statement = this->executePrepared(statement, bindParams, bindTypes);
+				} catch \Exception, e {
+					if leased {
+						this->releaseStatement(sqlStatement, statement);
+					}
+					throw e;
+				}
 			}
 		} else {
 			let statement = pdo->query(sqlStatement);
@@ -317,9 +377,10 @@ abstract class Pdo extends Adapter
 		 */
 		if typeof statement == "object" {
 			if typeof eventsManager == "object" {
+				let this->_sqlRowCount = statement->rowCount();
 				eventsManager->fire("db:afterQuery", this, bindParams);
 			}
-			return new ResultPdo(this, statement, sqlStatement, bindParams, bindTypes);
+			return new ResultPdo(this, statement, sqlStatement, bindParams, bindTypes, leased);
 		}
 
 		return statement;
@@ -359,10 +420,17 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->_leaseStatement(sqlStatement, false);
 			if typeof statement == "object" {
 				let newStatement = this->executePrepared(statement, bindParams, bindTypes),
 					affectedRows = newStatement->rowCount();
+				newStatement->closeCursor();
+			} else {
+				let statement = pdo->prepare(sqlStatement);
+				if typeof statement == "object" {
+					let newStatement = this->executePrepared(statement, bindParams, bindTypes),
+						affectedRows = newStatement->rowCount();
+				}
 			}
 		} else {
 			let affectedRows = pdo->exec(sqlStatement);
@@ -374,6 +442,7 @@ abstract class Pdo extends Adapter
 		if typeof affectedRows == "integer" {
 			let this->_affectedRows = affectedRows;
 			if typeof eventsManager == "object" {
+				let this->_sqlRowCount = affectedRows;
 				eventsManager->fire("db:afterQuery", this, bindParams);
 			}
 		}
@@ -394,6 +463,19 @@ abstract class Pdo extends Adapter
 		return this->_affectedRows;
 	}
 
+	/**
+	 * Returns the number of rows returned or affected by the active SQL statement, it's available
+	 * to the listeners of db:afterQuery to be passed to Phalcon\Db\Profiler::stopProfile()
+	 *
+	 *<code>
+	 *	$profiler->stopProfile($connection->getSQLRowCount());
+	 *</code>
+	 */
+	public function getSQLRowCount() -> int | null
+	{
+		return this->_sqlRowCount;
+	}
+
 	/**
 	 * Closes the active connection returning success. Phalcon automatically closes and destroys
 	 * active connections when the request ends
@@ -405,9 +487,80 @@ abstract class Pdo extends Adapter
 		if typeof pdo == "object" {
 			let this->_pdo = null;
 		}
+		let this->_preparedStatements = [],
+			this->_leasedStatements = [];
 		return true;
 	}
 
+	/**
+	 * Returns the cached prepared statement for a SQL text, preparing and caching it if needed.
+	 * Returns false if the cache is disabled or the cached statement is leased to a live result,
+	 * in that case the caller must prepare its own statement
+	 */
+	protected function _leaseStatement(string sqlStatement, boolean lease) -> <\PDOStatement> | boolean
+	{
+		var statement, pdo, evictSqlStatement;
+
+		if this->_statementsCacheSize <= 0 {
+			return false;
+		}
+
+		if fetch statement, this->_preparedStatements[sqlStatement] {
+
+			if isset this->_leasedStatements[sqlStatement] {
+				return false;
+			}
+
+			/**
+			 * Move the statement to the most recently used position
+			 */
+			unset this->_preparedStatements[sqlStatement];
+
+		} else {
+
+			let pdo = <\Pdo> this->_pdo,
+				statement = pdo->prepare(sqlStatement);
+			if typeof statement != "object" {
+				return false;
+			}
+
+			/**
+			 * Drop the least recently used statement, a live result keeps its own reference to it
+			 */
+			if count(this->_preparedStatements) >= this->_statementsCacheSize {
+				for evictSqlStatement, _ in this->_preparedStatements {
+					unset this->_preparedStatements[evictSqlStatement];
+					unset this->_leasedStatements[evictSqlStatement];
+					break;
+				}
+			}
+		}
+
+		let this->_preparedStatements[sqlStatement] = statement;
+
+		if lease {
+			let this->_leasedStatements[sqlStatement] = true;
+		}
+
+		return statement;
+	}
+
+	/**
+	 * Gives back a prepared statement leased to a Phalcon\Db\Result\Pdo, so it can be reused by
+	 * the following queries
+	 */
+	public function releaseStatement(string! sqlStatement, <\PDOStatement> statement) -> void
+	{
+		var cachedStatement;
+
+		if fetch cachedStatement, this->_preparedStatements[sqlStatement] {
+			if cachedStatement === statement {
+				unset this->_leasedStatements[sqlStatement];
+				statement->closeCursor();
+			}
+		}
+	}
+
 	/**
 	 * Escapes a column/table/schema name
 	 *
@@ -21,6 +21,7 @@
 namespace Phalcon\Db\Adapter\Pdo;
 
 use Phalcon\Db\Column;
+use Phalcon\Db\Exception;
 use Phalcon\Db\RawValue;
 use Phalcon\Db\AdapterInterface;
 use Phalcon\Db\Adapter\Pdo as PdoAdapter;
@@ -48,6 +49,32 @@ class Oracle extends PdoAdapter implements AdapterInterface
 
 	protected _dialectType = "oracle";
 
+	/**
+	 * Oracle doesn't support multi-row VALUES lists, rows are inserted one by one
+	 *
+	 * @param   string|array table
+	 * @param 	array rows
+	 * @param 	array fields
+	 * @param 	array dataTypes
+	 * @return 	boolean
+	 */
+	public function insertMultiple(var table, array! rows, var fields = null, var dataTypes = null) -> boolean
+	{
+		var values;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		for values in rows {
+			if !this->insert(table, values, fields, dataTypes) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	/**
 	 * This method is automatically called in Phalcon\Db\Adapter\Pdo constructor.
 	 * Call it when you need to restore a database connection.
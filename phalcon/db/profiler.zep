@@ -20,6 +20,7 @@
 namespace Phalcon\Db;
 
 use Phalcon\Db\Profiler\Item;
+use Phalcon\Db\Exception;
 
 /**
  * Phalcon\Db\Profiler
@@ -78,6 +79,137 @@ class Profiler
 	 */
 	protected _totalSeconds = 0;
 
+	/**
+	 * Fraction of the statements that are profiled (0..1)
+	 *
+	 * @var double
+	 */
+	protected _samplingRate = 1.0;
+
+	/**
+	 * Whether the statements are aggregated by fingerprint instead of storing every item
+	 *
+	 * @var boolean
+	 */
+	protected _aggregated = false;
+
+	/**
+	 * Maximum number of distinct fingerprints kept in aggregated mode
+	 *
+	 * @var int
+	 */
+	protected _maxAggregates = 1000;
+
+	/**
+	 * Statistics per SQL fingerprint in aggregated mode
+	 *
+	 * @var array
+	 */
+	protected _aggregates;
+
+	/**
+	 * Elapsed times kept per SQL fingerprint to estimate percentiles
+	 *
+	 * @var array
+	 */
+	protected _aggregateSamples;
+
+	/**
+	 * Number of aggregated statements whose fingerprint did not fit in the table
+	 *
+	 * @var int
+	 */
+	protected _overflowStatements = 0;
+
+	/**
+	 * Number of statements profiled
+	 *
+	 * @var int
+	 */
+	protected _numberStatements = 0;
+
+	/**
+	 * Whether the statement being executed is profiled
+	 *
+	 * @var boolean
+	 */
+	protected _sampled = false;
+
+	/**
+	 * SQL statement and monotonic start time of the active statement in aggregated mode
+	 */
+	protected _activeStatement;
+
+	protected _activeStart;
+
+	/**
+	 * Bitmask of the profiling hooks implemented by the class (1: beforeStartProfile, 2: afterEndProfile)
+	 *
+	 * @var int
+	 */
+	protected _hooks;
+
+	/**
+	 * Sets the fraction (between 0 and 1) of statements that must be profiled
+	 *
+	 *<code>
+	 *	//Profile one of every hundred statements
+	 *	$profiler->setSamplingRate(0.01);
+	 *</code>
+	 */
+	public function setSamplingRate(double samplingRate) -> <Profiler>
+	{
+		if samplingRate < 0 || samplingRate > 1 {
+			throw new Exception("The sampling rate must be between 0 and 1");
+		}
+
+		let this->_samplingRate = samplingRate;
+		return this;
+	}
+
+	/**
+	 * Returns the fraction of statements that are profiled
+	 */
+	public function getSamplingRate() -> double
+	{
+		return this->_samplingRate;
+	}
+
+	/**
+	 * Enables or disables the aggregated mode. In this mode no Phalcon\Db\Profiler\Item
+	 * is created, statements are grouped by their normalized SQL and timed using a monotonic
+	 * clock, keeping at most maxAggregates distinct statements. The beforeStartProfile/afterEndProfile
+	 * hooks are not called in this mode
+	 *
+	 *<code>
+	 *	$profiler = new \Phalcon\Db\Profiler();
+	 *	$profiler->setAggregated(true)->setSamplingRate(0.1);
+	 *
+	 *	//At the end of the request
+	 *	foreach ($profiler->getAggregates() as $aggregate) {
+	 *		echo $aggregate["statement"], " ", $aggregate["count"], " ", $aggregate["p95Time"], "\n";
+	 *	}
+	 *</code>
+	 */
+	public function setAggregated(boolean aggregated, int maxAggregates = 1000) -> <Profiler>
+	{
+		if maxAggregates < 1 {
+			throw new Exception("The maximum number of aggregates must be greater than zero");
+		}
+
+		let this->_aggregated = aggregated,
+			this->_maxAggregates = maxAggregates;
+		return this;
+	}
+
+	/**
+	 * Checks whether the profiler is aggregating statements
+	 */
+	public function isAggregated() -> boolean
+	{
+		return this->_aggregated;
+	}
+
 	/**
 	 * Starts the profile of a SQL sentence
 	 *
@@ -86,7 +218,27 @@ class Profiler
 	 */
 	public function startProfile(var sqlStatement, var sqlVariables = null, var sqlBindTypes = null) -> <Profiler>
 	{
-		var activeProfile;
+		var activeProfile, samplingRate;
+		int hooks;
+
+		/**
+		 * Decide whether the statement is part of the sample
+		 */
+		let samplingRate = this->_samplingRate;
+		if samplingRate < 1 {
+			if samplingRate <= 0 || (mt_rand() / mt_getrandmax()) >= samplingRate {
+				let this->_sampled = false;
+				return this;
+			}
+		}
+
+		let this->_sampled = true;
+
+		if this->_aggregated {
+			let this->_activeStatement = sqlStatement,
+				this->_activeStart = phalcon_monotonic_time();
+			return this;
+		}
 
 		let activeProfile = new Item();
 
@@ -102,7 +254,8 @@ class Profiler
 
 		activeProfile->setInitialTime(microtime(true));
 
-		if method_exists(this, "beforeStartProfile") {
+		let hooks = this->_getHooks();
+		if hooks & 1 {
 			this->{"beforeStartProfile"}(activeProfile);
 		}
 
@@ -112,11 +265,31 @@ class Profiler
 	}
 
 	/**
-	 * Stops the active profile
+	 * Stops the active profile. The number of rows returned or affected by the statement
+	 * is accumulated in aggregated mode, the PDO adapters expose it to the db:afterQuery
+	 * listeners through getSQLRowCount()
+	 *
+	 *<code>
+	 *	$profiler->stopProfile($connection->getSQLRowCount());
+	 *</code>
 	 */
-	public function stopProfile() -> <Profiler>
+	public function stopProfile(var rowCount = null) -> <Profiler>
 	{
 		var finalTime, initialTime, activeProfile;
+		int hooks;
+
+		if !this->_sampled {
+			return this;
+		}
+
+		let this->_sampled = false,
+			this->_numberStatements = this->_numberStatements + 1;
+
+		if this->_aggregated {
+			let finalTime = phalcon_monotonic_time();
+			this->_aggregate(this->_activeStatement, finalTime - this->_activeStart, rowCount);
+			return this;
+		}
 
 		let finalTime = microtime(true),
 			activeProfile = <Item> this->_activeProfile;
@@ -127,18 +300,158 @@ class Profiler
 			this->_totalSeconds = this->_totalSeconds + (finalTime - initialTime),
 			this->_allProfiles[] = activeProfile;
 
-		if method_exists(this, "afterEndProfile") {
+		let hooks = this->_getHooks();
+		if hooks & 2 {
 			this->{"afterEndProfile"}(activeProfile);
 		}
 
 		return this;
 	}
 
+	/**
+	 * Returns which profiling hooks are implemented, they are only looked up once
+	 */
+	protected function _getHooks() -> int
+	{
+		var hooks;
+
+		let hooks = this->_hooks;
+		if typeof hooks != "int" {
+			let hooks = 0;
+			if method_exists(this, "beforeStartProfile") {
+				let hooks = hooks | 1;
+			}
+			if method_exists(this, "afterEndProfile") {
+				let hooks = hooks | 2;
+			}
+			let this->_hooks = hooks;
+		}
+
+		return hooks;
+	}
+
+	/**
+	 * Accumulates the statistics of a finished statement under its fingerprint
+	 */
+	protected function _aggregate(var sqlStatement, double elapsed, var rowCount) -> void
+	{
+		var fingerprint, aggregate;
+		int count, position;
+
+		let this->_totalSeconds = this->_totalSeconds + elapsed;
+
+		let fingerprint = this->getFingerprint(sqlStatement);
+
+		if !fetch aggregate, this->_aggregates[fingerprint] {
+
+			if typeof this->_aggregates == "array" && count(this->_aggregates) >= this->_maxAggregates {
+				let this->_overflowStatements = this->_overflowStatements + 1;
+				return;
+			}
+
+			let this->_aggregates[fingerprint] = [
+				"statement": fingerprint,
+				"count":     1,
+				"totalTime": elapsed,
+				"minTime":   elapsed,
+				"maxTime":   elapsed,
+				"rows":      (int) rowCount
+			];
+			let this->_aggregateSamples[fingerprint] = [elapsed];
+			return;
+		}
+
+		let count = aggregate["count"] + 1,
+			aggregate["count"] = count,
+			aggregate["totalTime"] = aggregate["totalTime"] + elapsed,
+			aggregate["rows"] = aggregate["rows"] + (int) rowCount;
+
+		if elapsed < aggregate["minTime"] {
+			let aggregate["minTime"] = elapsed;
+		}
+
+		if elapsed > aggregate["maxTime"] {
+			let aggregate["maxTime"] = elapsed;
+		}
+
+		let this->_aggregates[fingerprint] = aggregate;
+
+		/**
+		 * Keep a bounded uniform sample of the elapsed times (reservoir sampling)
+		 */
+		if count <= 128 {
+			let this->_aggregateSamples[fingerprint][] = elapsed;
+		} else {
+			let position = mt_rand(0, count - 1);
+			if position < 128 {
+				let this->_aggregateSamples[fingerprint][position] = elapsed;
+			}
+		}
+	}
+
+	/**
+	 * Returns the normalized form of a SQL statement, literals are replaced by placeholders
+	 * so statements only differing in their values share the same fingerprint
+	 *
+	 *<code>
+	 *	//SELECT * FROM robots WHERE id = ? AND name IN (?+)
+	 *	echo $profiler->getFingerprint("SELECT * FROM robots WHERE id = 10 AND name IN ('a', 'b')");
+	 *</code>
+	 */
+	public function getFingerprint(string sqlStatement) -> string
+	{
+		return trim(preg_replace([
+			"/'(?:[^'\\\\]|\\\\.|'')*'/s",
+			"/\\b\\d+(?:\\.\\d+)?\\b/",
+			"/\\(\\s*\\?(?:\\s*,\\s*\\?)+\\s*\\)/",
+			"/\\s+/"
+		], ["?", "?", "(?+)", " "], sqlStatement));
+	}
+
+	/**
+	 * Returns the statistics of the aggregated statements indexed by fingerprint, every entry contains
+	 * statement, count, totalTime, minTime, maxTime, p95Time (in seconds) and rows
+	 */
+	public function getAggregates() -> array
+	{
+		var aggregates, fingerprint, aggregate, samples;
+		int position;
+
+		let aggregates = this->_aggregates;
+		if typeof aggregates != "array" {
+			return [];
+		}
+
+		for fingerprint, aggregate in aggregates {
+			let samples = this->_aggregateSamples[fingerprint];
+			sort(samples);
+			let position = (int) ceil(count(samples) * 0.95) - 1;
+			if position < 0 {
+				let position = 0;
+			}
+			let aggregate["p95Time"] = samples[position],
+				aggregates[fingerprint] = aggregate;
+		}
+
+		return aggregates;
+	}
+
+	/**
+	 * Returns the number of aggregated statements that were not tracked because the table was full
+	 */
+	public function getNumberOverflowStatements() -> int
+	{
+		return this->_overflowStatements;
+	}
+
 	/**
 	 * Returns the total number of SQL statements processed
 	 */
 	public function getNumberTotalStatements() -> int
 	{
+		if this->_aggregated {
+			return this->_numberStatements;
+		}
 		return count(this->_allProfiles);
 	}
 
@@ -163,7 +476,11 @@ class Profiler
 	 */
 	public function reset() -> <Profiler>
 	{
-		let this->_allProfiles = [];
+		let this->_allProfiles = [],
+			this->_aggregates = [],
+			this->_aggregateSamples = [],
+			this->_overflowStatements = 0,
+			this->_numberStatements = 0;
 		return this;
 	}
 
@@ -66,6 +66,11 @@ class Pdo implements ResultInterface
 
 	protected _rowCount = false;
 
+	/**
+	 * Whether the statement belongs to the prepared statements cache of the connection
+	 */
+	protected _leased = false;
+
 	/**
 	 * Phalcon\Db\Result\Pdo constructor
 	 *
@@ -74,9 +79,10 @@ class Pdo implements ResultInterface
 	 * @param string sqlStatement
 	 * @param array bindParams
 	 * @param array bindTypes
+	 * @param boolean leased
 	 */
 	public function __construct(<Db\AdapterInterface> connection, <\PDOStatement> result,
-		sqlStatement = null, bindParams = null, bindTypes = null)
+		sqlStatement = null, bindParams = null, bindTypes = null, boolean leased = false)
 	{
 
 		let this->_connection = connection,
@@ -91,6 +97,27 @@ class Pdo implements ResultInterface
 		if bindTypes !== null {
 			let this->_bindTypes = bindTypes;
 		}
+
+		let this->_leased = leased;
+	}
+
+	/**
+	 * Gives back the statement to the prepared statements cache of the connection
+	 */
+	public function __destruct()
+	{
+		this->_releaseStatement();
+	}
+
+	/**
+	 * Releases the statement if it was leased from the connection
+	 */
+	protected function _releaseStatement() -> void
+	{
+		if this->_leased {
+			let this->_leased = false;
+			this->_connection->releaseStatement(this->_sqlStatement, this->_pdoStatement);
+		}
 	}
 
 	/**
@@ -253,7 +280,10 @@ class Pdo implements ResultInterface
 
 		/**
 		 * PDO doesn't support scrollable cursors, so we need to re-execute the statement
+		 * The cached statement isn't used anymore by this result
 		 */
+		this->_releaseStatement();
+
 		if typeof bindParams == "array" {
 			let statement = pdo->prepare(sqlStatement);
 			if typeof statement == "object" {
@@ -289,6 +289,37 @@ class Debug
 		return parts[0];
 	}
 
+	/**
+	 * Returns the calls made through the kernel in the current request, indexed by "Class::method",
+	 * with their number of calls, inclusive time in seconds and allocated memory frames.
+	 * Returns false unless the extension was compiled with ZEPHIR_KERNEL_STATS defined, e.g. CFLAGS="-DZEPHIR_KERNEL_STATS" ./configure,
+	 * the hooks must also be added to the generated kernel running build/kernel-stats before compiling it
+	 *
+	 *<code>
+	 *	$stats = \Phalcon\Debug::getKernelStats();
+	 *	uasort($stats, function ($a, $b) { return $b['time'] > $a['time'] ? 1 : -1; });
+	 *</code>
+	 */
+	public static function getKernelStats() -> array | boolean
+	{
+		var stats;
+
+		let stats = phalcon_kernel_stats();
+		if stats === null {
+			throw new Exception("The kernel doesn't call the counters, run build/kernel-stats after generating the extension");
+		}
+
+		return stats;
+	}
+
+	/**
+	 * Clears the kernel call counters, they are also cleared at the beginning of every request
+	 */
+	public static function resetKernelStats() -> void
+	{
+		phalcon_kernel_stats_reset();
+	}
+
 	/**
 	 * Generates a link to the current version documentation
 	 */
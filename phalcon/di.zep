@@ -320,6 +320,26 @@ class Di implements DiInterface
 		return isset this->_services[name];
 	}
 
+	/**
+	 * Check whether a service was already resolved as a shared instance, so getShared() returns it without building it again
+	 */
+	public function hasSharedInstance(string! name) -> boolean
+	{
+		var service;
+
+		if isset this->_sharedInstances[name] {
+			return true;
+		}
+
+		if fetch service, this->_services[name] {
+			if service instanceof Service {
+				return service->isShared() && service->isResolved();
+			}
+		}
+
+		return false;
+	}
+
 	/**
 	 * Check whether the last service obtained via getShared produced a fresh instance or an existing one
 	 */
@@ -52,6 +52,8 @@ abstract class Element implements ElementInterface
 
 	protected _messages;
 
+	protected static _skeletons;
+
 	/**
 	 * Phalcon\Forms\Element constructor
 	 *
@@ -253,6 +255,60 @@ abstract class Element implements ElementInterface
 		return mergedAttributes;
 	}
 
+	/**
+	 * Renders the element through a Phalcon\Tag input helper. The markup around the value only depends
+	 * on the attributes, so it is rendered once with a placeholder value and reused afterwards,
+	 * later renders only escape and inject the current value
+	 */
+	protected function _renderCompiled(string! helper, var attributes = null) -> string
+	{
+		var mergedAttributes, value, escaper, key, skeletons, skeleton;
+
+		let mergedAttributes = this->prepareAttributes(attributes);
+
+		if !fetch value, mergedAttributes["value"] {
+			return call_user_func("Phalcon\\Tag::" . helper, mergedAttributes);
+		}
+
+		if typeof value != "string" && typeof value != "int" {
+			return call_user_func("Phalcon\\Tag::" . helper, mergedAttributes);
+		}
+
+		let escaper = Tag::getEscaper(mergedAttributes),
+			mergedAttributes["value"] = "PhalconFormsElementValue",
+			key = helper . ":" . typeof escaper . ":" . Tag::getDocType() . serialize(mergedAttributes);
+
+		let skeletons = self::_skeletons;
+		if !fetch skeleton, skeletons[key] {
+
+			let skeleton = explode("PhalconFormsElementValue", call_user_func("Phalcon\\Tag::" . helper, mergedAttributes));
+			if count(skeleton) != 2 {
+				let skeleton = false;
+			}
+
+			/**
+			 * Attributes that change on every render would make the cache grow without limit
+			 */
+			if typeof skeletons != "array" || count(skeletons) >= 1024 {
+				let skeletons = [];
+			}
+
+			let skeletons[key] = skeleton,
+				self::_skeletons = skeletons;
+		}
+
+		if typeof skeleton != "array" {
+			let mergedAttributes["value"] = value;
+			return call_user_func("Phalcon\\Tag::" . helper, mergedAttributes);
+		}
+
+		if typeof escaper == "object" {
+			return skeleton[0] . escaper->escapeHtmlAttr(value) . skeleton[1];
+		}
+
+		return skeleton[0] . value . skeleton[1];
+	}
+
 	/**
 	 * Sets a default attribute for the element
 	 *
@@ -19,7 +19,6 @@
 
 namespace Phalcon\Forms\Element;
 
-use Phalcon\Tag;
 use Phalcon\Forms\Element;
 use Phalcon\Forms\ElementInterface;
 
@@ -39,6 +38,6 @@ class Numeric extends Element implements ElementInterface
 	 */
 	public function render(attributes = null) -> string
 	{
-		return Tag::numericField(this->prepareAttributes(attributes));
+		return this->_renderCompiled("numericField", attributes);
 	}
 }
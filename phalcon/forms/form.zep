@@ -52,6 +52,8 @@ class Form extends Injectable implements \Countable, \Iterator
 
 	protected _validation { set, get };
 
+	protected _validationPlan;
+
 	/**
 	 * Phalcon\Forms\Form constructor
 	 *
@@ -268,7 +270,7 @@ class Form extends Injectable implements \Countable, \Iterator
 	{
 		var elements, notFailed, messages, element,
 			validators, name, preparedValidators, filters,
-			validator, validation, elementMessages;
+			validator, validation, elementMessages, plan, step;
 
 		let elements = this->_elements;
 		if typeof elements != "array" {
@@ -303,64 +305,125 @@ class Form extends Injectable implements \Countable, \Iterator
 		let notFailed = true,
 			messages = [];
 
-		for element in elements {
+		/**
+		 * Without a user validation every element is validated by an implicit validation,
+		 * those are prepared once and reused while the element's validators and filters don't change
+		 */
+		if typeof this->getValidation() != "object" && typeof data == "array" {
 
-			let validators = element->getValidators();
-			if typeof validators == "array" {
-				if count(validators) {
+			let plan = this->_validationPlan;
+			if typeof plan != "array" {
+				let plan = [];
+			}
 
-					/**
-					 * Element's name
-					 */
-					let name = element->getName();
+			for element in elements {
 
-					/**
-					 * Prepare the validators
-					 */
-					let preparedValidators = [];
+				let validators = element->getValidators();
+				if typeof validators != "array" {
+					continue;
+				}
+
+				if !count(validators) {
+					continue;
+				}
+
+				let name = element->getName(),
+					filters = element->getFilters(),
+					step = null;
 
+				if fetch step, plan[name] {
+					if step[0] !== validators || step[1] !== filters {
+						let step = null;
+					}
+				}
+
+				if typeof step != "array" {
+
+					let preparedValidators = [];
 					for validator in validators {
 						let preparedValidators[] = [name, validator];
 					}
 
-					let validation = this->getValidation();
-					if typeof validation == "object" {
-						if validation instanceof \Phalcon\Validation {
+					let validation = new \Phalcon\Validation(preparedValidators);
+					if typeof filters == "array" {
+						validation->setFilters(name, filters);
+					}
+
+					let step = [validators, filters, validation],
+						plan[name] = step;
+				}
+
+				let validation = step[2],
+					elementMessages = validation->validate(data, entity);
+				if count(elementMessages) {
+					let messages[name] = elementMessages,
+						notFailed = false;
+				}
+			}
+
+			let this->_validationPlan = plan;
+
+		} else {
+
+			for element in elements {
+
+				let validators = element->getValidators();
+				if typeof validators == "array" {
+					if count(validators) {
+
+						/**
+						 * Element's name
+						 */
+						let name = element->getName();
+
+						/**
+						 * Prepare the validators
+						 */
+						let preparedValidators = [];
+
+						for validator in validators {
+							let preparedValidators[] = [name, validator];
+						}
+
+						let validation = this->getValidation();
+						if typeof validation == "object" {
+							if validation instanceof \Phalcon\Validation {
+								/**
+								 * Set the validators to the validation
+								 */
+								validation->setValidators(preparedValidators);
+							}
+						} else {
 							/**
-							 * Set the validators to the validation
+							 * Create an implicit validation
 							 */
-							validation->setValidators(preparedValidators);
+							let validation = new \Phalcon\Validation(preparedValidators);
 						}
-					} else {
+
 						/**
-						 * Create an implicit validation
+						 * Get filters in the element
 						 */
-						let validation = new \Phalcon\Validation(preparedValidators);
-					}
+						let filters = element->getFilters();
 
-					/**
-					 * Get filters in the element
-					 */
-					let filters = element->getFilters();
+						/**
+						 * Assign the filters to the validation
+						 */
+						if typeof filters == "array" {
+							validation->setFilters(element->getName(), filters);
+						}
 
-					/**
-					 * Assign the filters to the validation
-					 */
-					if typeof filters == "array" {
-						validation->setFilters(element->getName(), filters);
-					}
+						/**
+						 * Perform the validation
+						 */
+						let elementMessages = validation->validate(data, entity);
+						if count(elementMessages) {
+							let messages[element->getName()] = elementMessages,
+								notFailed = false;
+						}
 
-					/**
-					 * Perform the validation
-					 */
-					let elementMessages = validation->validate(data, entity);
-					if count(elementMessages) {
-						let messages[element->getName()] = elementMessages,
-							notFailed = false;
 					}
 
 				}
-
 			}
 		}
 
@@ -456,6 +519,8 @@ class Form extends Injectable implements \Countable, \Iterator
 		 */
 		let name = element->getName();
 
+		unset this->_validationPlan[name];
+
 		/**
 		 * Link the element to the form
 		 */
@@ -651,6 +716,7 @@ class Form extends Injectable implements \Countable, \Iterator
 		 */
 		if isset elements[name] {
 			unset this->_elements[name];
+			unset this->_validationPlan[name];
 			return true;
 		}
 
@@ -197,11 +197,22 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 		return this->_value;
 	}
 
+	/**
+	 * Returns the value that will be sent, without reading the request or the session
+	 */
+	public function getRawValue()
+	{
+		return this->_value;
+	}
+
 	/**
 	 * Sends the cookie to the HTTP client
 	 * Stores the cookie definition in session
+	 * The value can be passed already encrypted, Phalcon\Http\Response\Cookies encrypts all the cookies at once
+	 *
+	 * @param string encryptedValue
 	 */
-	public function send() -> <CookieInterface>
+	public function send(var encryptedValue = null) -> <CookieInterface>
 	{
 		var name, value, expire, domain, path, secure, httpOnly,
 			dependencyInjector, definition, session, crypt, encryptValue;
@@ -254,7 +265,9 @@ class Cookie implements CookieInterface, InjectionAwareInterface
 
 		if this->_useEncryption {
 
-			if !empty value {
+			if encryptedValue !== null {
+				let encryptValue = encryptedValue;
+			} elseif !empty value {
 
 				if typeof dependencyInjector != "object" {
 					throw new Exception("A dependency injection object is required to access the 'filter' service");
@@ -54,6 +54,10 @@ class Request implements RequestInterface, InjectionAwareInterface
 
 	protected _putCache;
 
+	protected _headersCache;
+
+	protected _qualityCache;
+
 	/**
 	 * Sets the dependency injector
 	 */
@@ -469,7 +473,7 @@ class Request implements RequestInterface, InjectionAwareInterface
 				/**
 				 * The client address has multiples parts, only return the first part
 				 */
-				return explode(",", address)[0];
+				return substr(address, 0, strpos(address, ","));
 			}
 			return address;
 		}
@@ -763,13 +767,24 @@ class Request implements RequestInterface, InjectionAwareInterface
 	 */
 	public function getHeaders() -> array
 	{
-		var name, value, contentHeaders;
+		var name, value, contentHeaders, server, cache;
 		array headers;
 
+		/**
+		 * The headers are normalized once while _SERVER doesn't change
+		 */
+		let server = _SERVER,
+			cache = this->_headersCache;
+		if typeof cache == "array" {
+			if cache[0] === server {
+				return cache[1];
+			}
+		}
+
 		let headers = [];
 		let contentHeaders = ["CONTENT_TYPE": true, "CONTENT_LENGTH": true];
 
-		for name, value in _SERVER {
+		for name, value in server {
 			if starts_with(name, "HTTP_") {
 				let name = ucwords(strtolower(str_replace("_", " ", substr(name, 5)))),
 					name = str_replace(" ", "-", name);
@@ -781,6 +796,8 @@ class Request implements RequestInterface, InjectionAwareInterface
 			}
 		}
 
+		let this->_headersCache = [server, headers];
+
 		return headers;
 	}
 
@@ -797,23 +814,39 @@ class Request implements RequestInterface, InjectionAwareInterface
 	}
 
 	/**
-	 * Process a request header and return an array of values with their qualities
+	 * Process a request header and return an array of values with their qualities.
+	 * Every header is parsed once while its value doesn't change
 	 */
 	protected final function _getQualityHeader(string! serverIndex, string! name) -> array
 	{
-		var returnedParts, part, headerParts, headerPart, split;
+		var header, cached, returnedParts, part, headerParts, headerPart, position, key;
+
+		let header = (string) this->getServer(serverIndex);
+
+		if fetch cached, this->_qualityCache[serverIndex] {
+			if cached[0] === header {
+				return cached[1];
+			}
+		}
 
 		let returnedParts = [];
-		for part in preg_split("/,\\s*/", this->getServer(serverIndex), -1, PREG_SPLIT_NO_EMPTY) {
+		for part in explode(",", header) {
 
 			let headerParts = [];
-			for headerPart in preg_split("/\s*;\s*/", trim(part), -1, PREG_SPLIT_NO_EMPTY) {
-				if strpos(headerPart, "=") !== false {
-					let split = explode("=", headerPart, 2);
-					if split[0] === "q" {
-						let headerParts["quality"] = (double) split[1];
+			for headerPart in explode(";", part) {
+
+				let headerPart = trim(headerPart);
+				if headerPart === "" {
+					continue;
+				}
+
+				let position = strpos(headerPart, "=");
+				if position !== false {
+					let key = rtrim(substr(headerPart, 0, position));
+					if key === "q" {
+						let headerParts["quality"] = (double) ltrim(substr(headerPart, position + 1));
 					} else {
-						let headerParts[split[0]] = split[1];
+						let headerParts[key] = ltrim(substr(headerPart, position + 1));
 					}
 				} else {
 					let headerParts[name] = headerPart;
@@ -821,41 +854,98 @@ class Request implements RequestInterface, InjectionAwareInterface
 				}
 			}
 
-			let returnedParts[] = headerParts;
+			if count(headerParts) {
+				let returnedParts[] = headerParts;
+			}
 		}
 
+		let this->_qualityCache[serverIndex] = [header, returnedParts];
+
 		return returnedParts;
 	}
 
 	/**
-	 * Process a request header and return the one with best quality
+	 * Process a request header and return the one with best quality.
+	 * On equal qualities the most specific value wins, full media types are preferred over wildcards
 	 */
 	protected final function _getBestQuality(array qualityParts, string! name) -> string
 	{
-		int i;
+		int i, specificity, acceptSpecificity;
 		double quality, acceptQuality;
-		var selectedName, accept;
+		var selectedName, accept, value;
 
 		let i = 0,
 			quality = 0.0,
+			specificity = 0,
 			selectedName = "";
 
 		for accept in qualityParts {
-			if i == 0 {
-				let quality = (double) accept["quality"],
-					selectedName = accept[name];
-			} else {
-				let acceptQuality = (double) accept["quality"];
-				if acceptQuality > quality {
-					let quality = acceptQuality,
-						selectedName = accept[name];
-				}
+
+			if !fetch value, accept[name] {
+				continue;
+			}
+
+			let acceptQuality = (double) accept["quality"],
+				acceptSpecificity = this->_getSpecificity(value, count(accept));
+
+			if i == 0 || acceptQuality > quality || (acceptQuality == quality && acceptSpecificity > specificity) {
+				let quality = acceptQuality,
+					specificity = acceptSpecificity,
+					selectedName = value;
 			}
+
 			let i++;
 		}
 		return selectedName;
 	}
 
+	/**
+	 * Returns the best value of a request header, it's only calculated once per header value
+	 */
+	protected final function _getBestQualityHeader(string! serverIndex, string! name) -> string
+	{
+		var qualityParts, cached, best;
+
+		let qualityParts = this->_getQualityHeader(serverIndex, name);
+
+		let cached = this->_qualityCache[serverIndex];
+		if fetch best, cached[2] {
+			return best;
+		}
+
+		let best = this->_getBestQuality(qualityParts, name),
+			cached[2] = best,
+			this->_qualityCache[serverIndex] = cached;
+
+		return best;
+	}
+
+	/**
+	 * Returns how specific a value of a quality header is, wildcards are the less specific values
+	 * and media ranges with extra parameters are more specific than the ones without them
+	 */
+	protected final function _getSpecificity(string! value, int numberParts) -> int
+	{
+		var parts;
+
+		if value == "*" || value == "*/*" {
+			return 0;
+		}
+
+		if memstr(value, "/") {
+			let parts = explode("/", value, 2);
+			if parts[1] == "*" {
+				return 1;
+			}
+			/**
+			 * The value and the quality are always present, anything else is a parameter
+			 */
+			return numberParts;
+		}
+
+		return 1;
+	}
+
 	/**
 	 * Gets content type which request has been made
 	 */
@@ -890,7 +980,7 @@ class Request implements RequestInterface, InjectionAwareInterface
 	 */
 	public function getBestAccept() -> string
 	{
-		return this->_getBestQuality(this->getAcceptableContent(), "accept");
+		return this->_getBestQualityHeader("HTTP_ACCEPT", "accept");
 	}
 
 	/**
@@ -906,7 +996,7 @@ class Request implements RequestInterface, InjectionAwareInterface
 	 */
 	public function getBestCharset() -> string
 	{
-		return this->_getBestQuality(this->getClientCharsets(), "charset");
+		return this->_getBestQualityHeader("HTTP_ACCEPT_CHARSET", "charset");
 	}
 
 	/**
@@ -922,7 +1012,7 @@ class Request implements RequestInterface, InjectionAwareInterface
 	 */
 	public function getBestLanguage() -> string
 	{
-		return this->_getBestQuality(this->getLanguages(), "language");
+		return this->_getBestQualityHeader("HTTP_ACCEPT_LANGUAGE", "language");
 	}
 
 
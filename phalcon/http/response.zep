@@ -55,6 +55,8 @@ class Response implements ResponseInterface, InjectionAwareInterface
 
 	protected _file;
 
+	protected _fileOffload;
+
 	protected _dependencyInjector;
 
 	/**
@@ -571,12 +573,23 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	 */
 	public function send() -> <Response>
 	{
-		var headers, cookies, content, file;
+		var content, file, range = null, handle, output;
 
 		if this->_sent {
 			throw new Exception("Response was already sent");
 		}
 
+		/**
+		 * Files are checked against conditional and range requests before sending the headers
+		 */
+		let content = this->_content;
+		if content == null {
+			let file = this->_file;
+			if typeof file == "string" && strlen(file) {
+				let range = this->_prepareFile(file);
+			}
+		}
+
 		this->sendHeaders();
 
 		this->sendCookies();
@@ -584,14 +597,21 @@ class Response implements ResponseInterface, InjectionAwareInterface
 		/**
 		 * Output the response body
 		 */
-		let content = this->_content;
 		if content != null {
 			echo content;
 		} else {
-			let file = this->_file;
-
-			if typeof file == "string" && strlen(file) {
-				readfile(file);
+			if typeof range == "array" {
+				if range[0] == 0 && range[1] === null {
+					readfile(file);
+				} else {
+					let handle = fopen(file, "rb");
+					if typeof handle == "resource" {
+						let output = fopen("php://output", "wb");
+						stream_copy_to_stream(handle, output, range[1], range[0]);
+						fclose(output);
+						fclose(handle);
+					}
+				}
 			}
 		}
 
@@ -627,4 +647,176 @@ class Response implements ResponseInterface, InjectionAwareInterface
 
 		return this;
 	}
+
+	/**
+	 * Lets the web server send the file, only the header with its path is emitted.
+	 * When the file is under pathPrefix that part of the path is replaced by location,
+	 * which is what nginx expects in X-Accel-Redirect
+	 *
+	 *<code>
+	 *	$response->setFileOffload("X-Sendfile");
+	 *	$response->setFileOffload("X-Accel-Redirect", "/var/www/files/", "/protected/");
+	 *</code>
+	 */
+	public function setFileOffload(string! header = "X-Sendfile", var pathPrefix = null, var location = null) -> <Response>
+	{
+		let this->_fileOffload = [header, pathPrefix, location];
+		return this;
+	}
+
+	/**
+	 * Sets the validation, length and range headers of the file to send according to the request.
+	 * Returns the offset and the length to stream or false when the body must not be sent
+	 */
+	protected function _prepareFile(string! file) -> array | boolean
+	{
+		var headers, server, size, modified, etag, lastModified, match, tag, since,
+			range, ifRange, offload, pathPrefix, location, bytes, start, end;
+		boolean notModified = false;
+
+		if !is_file(file) {
+			return [0, null];
+		}
+
+		let headers = this->getHeaders(),
+			server = _SERVER,
+			size = filesize(file),
+			modified = filemtime(file);
+
+		let etag = headers->get("Etag");
+		if !etag {
+			let etag = "\"" . dechex(modified) . "-" . dechex(size) . "\"";
+			headers->set("Etag", etag);
+		}
+
+		let lastModified = headers->get("Last-Modified");
+		if !lastModified {
+			let lastModified = gmdate("D, d M Y H:i:s", modified) . " GMT";
+			headers->set("Last-Modified", lastModified);
+		}
+
+		/**
+		 * If-None-Match takes precedence over If-Modified-Since
+		 */
+		if fetch match, server["HTTP_IF_NONE_MATCH"] {
+			for tag in explode(",", match) {
+				let tag = trim(tag);
+				if starts_with(tag, "W/") {
+					let tag = substr(tag, 2);
+				}
+				if tag == etag || tag == "*" {
+					let notModified = true;
+					break;
+				}
+			}
+		} else {
+			if fetch since, server["HTTP_IF_MODIFIED_SINCE"] {
+				let since = strtotime(since);
+				if since !== false && since >= modified {
+					let notModified = true;
+				}
+			}
+		}
+
+		if notModified {
+			this->setNotModified();
+			return false;
+		}
+
+		/**
+		 * The web server sends the file and handles the ranges by itself
+		 */
+		let offload = this->_fileOffload;
+		if typeof offload == "array" {
+			let pathPrefix = offload[1],
+				location = offload[2];
+			if typeof pathPrefix == "string" && typeof location == "string" && starts_with(file, pathPrefix) {
+				headers->set(offload[0], location . substr(file, strlen(pathPrefix)));
+			} else {
+				headers->set(offload[0], file);
+			}
+			return false;
+		}
+
+		headers->set("Accept-Ranges", "bytes");
+
+		if fetch range, server["HTTP_RANGE"] {
+
+			/**
+			 * A range for another version of the file is ignored and the whole file is sent
+			 */
+			if fetch ifRange, server["HTTP_IF_RANGE"] {
+				if ifRange != etag && ifRange != lastModified {
+					let range = null;
+				}
+			}
+
+			/**
+			 * Only single byte ranges are supported, the whole file is sent for multiple ranges
+			 */
+			if typeof range == "string" && starts_with(range, "bytes=") && !memstr(range, ",") {
+
+				let bytes = explode("-", trim(substr(range, 6)), 2);
+
+				if count(bytes) == 2 && (bytes[0] !== "" || bytes[1] !== "") && ctype_digit(bytes[0] . bytes[1]) {
+
+					if bytes[0] === "" {
+						/**
+						 * Suffix range, the last N bytes
+						 */
+						let end = size - 1,
+							start = size - (int) bytes[1];
+						if start < 0 {
+							let start = 0;
+						}
+					} else {
+						let start = (int) bytes[0];
+						if bytes[1] === "" || (int) bytes[1] >= size {
+							let end = size - 1;
+						} else {
+							let end = (int) bytes[1];
+						}
+					}
+
+					if start >= size || start > end {
+						this->setStatusCode(416);
+						headers->set("Content-Range", "bytes */" . size);
+						return false;
+					}
+
+					this->setStatusCode(206);
+					headers->set("Content-Range", "bytes " . start . "-" . end . "/" . size);
+					headers->set("Content-Length", end - start + 1);
+
+					if this->_isHeadRequest(server) {
+						return false;
+					}
+
+					return [start, end - start + 1];
+				}
+			}
+		}
+
+		headers->set("Content-Length", size);
+
+		if this->_isHeadRequest(server) {
+			return false;
+		}
+
+		return [0, null];
+	}
+
+	/**
+	 * Checks if the current request only asks for the headers
+	 */
+	protected function _isHeadRequest(array! server) -> boolean
+	{
+		var method;
+
+		if fetch method, server["REQUEST_METHOD"] {
+			return method == "HEAD";
+		}
+
+		return false;
+	}
 }
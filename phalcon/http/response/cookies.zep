@@ -231,11 +231,45 @@ class Cookies implements CookiesInterface, InjectionAwareInterface
 	 */
 	public function send() -> boolean
 	{
-		var cookie;
+		var cookies, name, cookie, value, values, encrypted, dependencyInjector, crypt;
 
 		if !headers_sent() {
-			for cookie in this->_cookies {
-				cookie->send();
+
+			let cookies = this->_cookies,
+				encrypted = [];
+
+			/**
+			 * The values of the encrypted cookies are encrypted in a single call
+			 */
+			if typeof cookies == "array" && count(cookies) > 1 {
+				let dependencyInjector = this->_dependencyInjector;
+				if typeof dependencyInjector == "object" {
+
+					let values = [];
+					for name, cookie in cookies {
+						if cookie instanceof \Phalcon\Http\Cookie && cookie->isUsingEncryption() {
+							let value = cookie->getRawValue();
+							if !empty value {
+								let values[name] = (string) value;
+							}
+						}
+					}
+
+					if count(values) > 1 {
+						let crypt = dependencyInjector->getShared("crypt");
+						if method_exists(crypt, "encryptBase64Many") {
+							let encrypted = crypt->encryptBase64Many(values);
+						}
+					}
+				}
+			}
+
+			for name, cookie in cookies {
+				if fetch value, encrypted[name] {
+					cookie->send(value);
+				} else {
+					cookie->send();
+				}
 			}
 
 			return true;
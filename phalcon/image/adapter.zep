@@ -25,11 +25,20 @@ use Phalcon\Image;
  * Phalcon\Image\Adapter
  *
  * All image adapters must use this class
+ *
+ * Adapters opened in lazy mode only read the image header. Resizes and crops are recorded and fused
+ * into a single resample that runs when the image is needed (any other operation, save or render),
+ * letting the adapter decode the file at a reduced size when the result is much smaller than the source
+ *
+ *<code>
+ * $image = new Phalcon\Image\Adapter\Imagick("upload/photo.jpg", null, null, true);
+ * $image->resize(400, 300)->crop(200, 200)->save("upload/thumb.jpg");
+ *</code>
  */
 abstract class Adapter
 {
 
-	protected _image { get };
+	protected _image;
 
 	protected _file;
 
@@ -68,7 +77,146 @@ abstract class Adapter
 	protected static _checked = false;
 
 	/**
- 	 * Resize the image to the given size
+	 * Whether operations are recorded instead of executed immediately
+	 *
+	 * @var boolean
+	 */
+	protected _lazy = false;
+
+	/**
+	 * Pending source rectangle of the fused geometric transforms, the target size is the current width and height
+	 *
+	 * @var array
+	 */
+	protected _pending;
+
+	/**
+	 * Size of the image the pending transforms apply to
+	 */
+	protected _sourceWidth;
+
+	protected _sourceHeight;
+
+	/**
+	 * Returns the internal image, executing the pending operations in lazy mode
+	 */
+	public function getImage()
+	{
+		this->_realize();
+		return this->_image;
+	}
+
+	/**
+	 * Checks whether the adapter records the operations instead of executing them immediately
+	 */
+	public function isLazy() -> boolean
+	{
+		return this->_lazy;
+	}
+
+	/**
+	 * Records a resize as part of the pending fused transform
+	 */
+	protected function _pushResize(int width, int height) -> void
+	{
+		if typeof this->_pending != "array" {
+			let this->_pending = ["x": 0, "y": 0, "width": this->_width, "height": this->_height];
+		}
+
+		let this->_width = width,
+			this->_height = height;
+	}
+
+	/**
+	 * Records a crop as part of the pending fused transform, the crop is mapped back to the source rectangle
+	 */
+	protected function _pushCrop(int width, int height, int offsetX, int offsetY) -> void
+	{
+		var pending;
+		double scaleX, scaleY;
+
+		let pending = this->_pending;
+		if typeof pending != "array" {
+			let pending = ["x": 0, "y": 0, "width": this->_width, "height": this->_height];
+		}
+
+		let scaleX = pending["width"] / this->_width,
+			scaleY = pending["height"] / this->_height;
+
+		let pending["x"] = pending["x"] + offsetX * scaleX,
+			pending["y"] = pending["y"] + offsetY * scaleY,
+			pending["width"] = width * scaleX,
+			pending["height"] = height * scaleY;
+
+		let this->_pending = pending,
+			this->_width = width,
+			this->_height = height;
+	}
+
+	/**
+	 * Decodes the image if needed and executes the pending fused transform as a single resample
+	 */
+	protected function _realize() -> void
+	{
+		var pending, decoded;
+		double factorX, factorY;
+		int hintWidth, hintHeight, x, y, width, height;
+
+		if !this->_lazy {
+			return;
+		}
+
+		let pending = this->_pending;
+
+		if this->_image === null {
+
+			/**
+			 * Ask the decoder for the smallest size the pending transform needs
+			 */
+			let hintWidth = 0, hintHeight = 0;
+			if typeof pending == "array" {
+				let hintWidth = (int) ceil(this->_sourceWidth * this->_width / pending["width"]),
+					hintHeight = (int) ceil(this->_sourceHeight * this->_height / pending["height"]);
+			}
+
+			let decoded = this->{"_decode"}(hintWidth, hintHeight);
+
+			/**
+			 * The decoder may have reduced the image, scale the source rectangle accordingly
+			 */
+			if typeof pending == "array" {
+				let factorX = decoded[0] / this->_sourceWidth,
+					factorY = decoded[1] / this->_sourceHeight;
+				let pending["x"] = pending["x"] * factorX,
+					pending["y"] = pending["y"] * factorY,
+					pending["width"] = pending["width"] * factorX,
+					pending["height"] = pending["height"] * factorY;
+			} else {
+				let this->_width = decoded[0],
+					this->_height = decoded[1];
+			}
+
+			let this->_sourceWidth = decoded[0],
+				this->_sourceHeight = decoded[1];
+		}
+
+		if typeof pending == "array" {
+
+			let x = (int) round(pending["x"]),
+				y = (int) round(pending["y"]),
+				width = (int) max(round(pending["width"]), 1),
+				height = (int) max(round(pending["height"]), 1);
+
+			if x != 0 || y != 0 || width != this->_sourceWidth || height != this->_sourceHeight || this->_width != width || this->_height != height {
+				this->{"_resample"}(x, y, width, height, this->_width, this->_height);
+			}
+
+			let this->_pending = null,
+				this->_sourceWidth = this->_width,
+				this->_sourceHeight = this->_height;
+		}
+	}
+
  	 */
 	public function resize(int width = null, int height = null, int master = Image::AUTO) -> <Adapter>
 	{
@@ -144,6 +292,11 @@ abstract class Adapter
 		let width  = (int) max(round(width), 1);
 		let height = (int) max(round(height), 1);
 
+		if this->_lazy {
+			this->_pushResize(width, height);
+			return this;
+		}
+
 		this->{"_resize"}(width, height);
 
 		return this;
@@ -159,6 +312,8 @@ abstract class Adapter
 	 */
 	public function liquidRescale(int width, int height, int deltaX = 0, int rigidity = 0) -> <Adapter>
 	{
+		this->_realize();
+
 		this->{"_liquidRescale"}(width, height, deltaX, rigidity);
 		return this;
 	}
@@ -200,6 +355,11 @@ abstract class Adapter
 			let height = this->_height - offsetY;
 		}
 
+		if this->_lazy {
+			this->_pushCrop(width, height, offsetX, offsetY);
+			return this;
+		}
+
 		this->{"_crop"}(width, height, offsetX, offsetY);
 
 		return this;
@@ -210,6 +370,8 @@ abstract class Adapter
  	 */
 	public function rotate(int degrees) -> <Adapter>
 	{
+		this->_realize();
+
 		if degrees > 180 {
 			let degrees %= 360;
 			if degrees > 180 {
@@ -230,6 +392,8 @@ abstract class Adapter
  	 */
 	public function flip(int direction) -> <Adapter>
 	{
+		this->_realize();
+
 		if direction != Image::HORIZONTAL && direction != Image::VERTICAL {
 			let direction = Image::HORIZONTAL;
 		}
@@ -243,6 +407,8 @@ abstract class Adapter
  	 */
 	public function sharpen(int amount) -> <Adapter>
 	{
+		this->_realize();
+
 		if amount > 100 {
 			let amount = 100;
 		} elseif amount < 1 {
@@ -258,6 +424,8 @@ abstract class Adapter
  	 */
 	public function reflection(int height, int opacity = 100, boolean fadeIn = false) -> <Adapter>
 	{
+		this->_realize();
+
 		if height <= 0 || height > this->_height {
 			let height = (int) this->_height;
 		}
@@ -280,6 +448,8 @@ abstract class Adapter
 	{
 		int tmp;
 
+		this->_realize();
+
 		let tmp = this->_width - watermark->getWidth();
 
 		if offsetX < 0 {
@@ -314,6 +484,8 @@ abstract class Adapter
 	{
 		var colors;
 
+		this->_realize();
+
 		if opacity < 0 {
 			let opacity = 0;
 		} else {
@@ -342,6 +514,8 @@ abstract class Adapter
  	 */
 	public function mask(<Adapter> watermark) -> <Adapter>
 	{
+		this->_realize();
+
 		this->{"_mask"}(watermark);
 		return this;
 	}
@@ -353,6 +527,8 @@ abstract class Adapter
 	{
 		var colors;
 
+		this->_realize();
+
 		if strlen(color) > 1 && substr(color, 0, 1) === "#" {
 			let color = substr(color, 1);
 		}
@@ -372,6 +548,8 @@ abstract class Adapter
  	 */
 	public function blur(int radius) -> <Adapter>
 	{
+		this->_realize();
+
 		if radius < 1 {
 			let radius = 1;
 		} elseif radius > 100 {
@@ -387,6 +565,8 @@ abstract class Adapter
  	 */
 	public function pixelate(int amount) -> <Adapter>
 	{
+		this->_realize();
+
 		if amount < 2 {
 			let amount = 2;
 		}
@@ -400,6 +580,8 @@ abstract class Adapter
  	 */
 	public function save(string file = null, int quality = 100) -> <Adapter>
 	{
+		this->_realize();
+
 		if !file {
 			let file = (string) this->_realpath;
 		}
@@ -419,6 +601,8 @@ abstract class Adapter
  	 */
 	public function render(string ext = null, int quality = 100) -> string
 	{
+		this->_realize();
+
 		if !ext {
 			let ext = (string) pathinfo(this->_file, PATHINFO_EXTENSION);
 		}
@@ -58,7 +58,12 @@ class Gd extends Adapter implements AdapterInterface
 		return self::_checked;
 	}
 
-	public function __construct(string! file, int width = null, int height = null)
+	/**
+	 * Phalcon\Image\Adapter\Gd constructor
+	 *
+	 * In lazy mode only the image header is read, the image is decoded when it's needed
+	 */
+	public function __construct(string! file, int width = null, int height = null, boolean lazy = false)
 	{
 		var imageinfo;
 
@@ -80,33 +85,14 @@ class Gd extends Adapter implements AdapterInterface
 				let this->_mime = imageinfo["mime"];
 			}
 
-			switch this->_type {
-				case 1:
-					let this->_image = imagecreatefromgif(this->_file);
-					break;
-				case 2:
-					let this->_image = imagecreatefromjpeg(this->_file);
-					break;
-				case 3:
-					let this->_image = imagecreatefrompng(this->_file);
-					break;
-				case 15:
-					let this->_image = imagecreatefromwbmp(this->_file);
-					break;
-				case 16:
-					let this->_image = imagecreatefromxbm(this->_file);
-					break;
-				default:
-					if this->_mime {
-						throw new Exception("Installed GD does not support " . this->_mime . " images");
-					} else {
-						throw new Exception("Installed GD does not support such images");
-					}
-					break;
+			if lazy && imageinfo {
+				let this->_lazy = true,
+					this->_sourceWidth = this->_width,
+					this->_sourceHeight = this->_height;
+			} else {
+				this->_decode(0, 0);
 			}
 
-			imagesavealpha(this->_image, true);
-
 		} else {
 			if !width || !height {
 				throw new Exception("Failed to create image from file " . this->_file);
@@ -124,6 +110,58 @@ class Gd extends Adapter implements AdapterInterface
 		}
 	}
 
+	/**
+	 * Decodes the image file. GD always decodes at full size so the size hint is ignored
+	 */
+	protected function _decode(int width, int height) -> array
+	{
+		switch this->_type {
+			case 1:
+				let this->_image = imagecreatefromgif(this->_file);
+				break;
+			case 2:
+				let this->_image = imagecreatefromjpeg(this->_file);
+				break;
+			case 3:
+				let this->_image = imagecreatefrompng(this->_file);
+				break;
+			case 15:
+				let this->_image = imagecreatefromwbmp(this->_file);
+				break;
+			case 16:
+				let this->_image = imagecreatefromxbm(this->_file);
+				break;
+			default:
+				if this->_mime {
+					throw new Exception("Installed GD does not support " . this->_mime . " images");
+				} else {
+					throw new Exception("Installed GD does not support such images");
+				}
+				break;
+		}
+
+		imagesavealpha(this->_image, true);
+
+		return [imagesx(this->_image), imagesy(this->_image)];
+	}
+
+	/**
+	 * Executes a fused crop and resize with a single resample
+	 */
+	protected function _resample(int x, int y, int sourceWidth, int sourceHeight, int width, int height)
+	{
+		var image;
+
+		let image = this->_create(width, height);
+
+		if imagecopyresampled(image, this->_image, 0, 0, x, y, width, height, sourceWidth, sourceHeight) {
+			imagedestroy(this->_image);
+			let this->_image = image;
+			let this->_width  = imagesx(image);
+			let this->_height = imagesy(image);
+		}
+	}
+
 	protected function _resize(int width, int height)
 	{
 		var image, pre_width, pre_height, reduction_width, reduction_height;
@@ -65,8 +65,10 @@ class Imagick extends Adapter implements AdapterInterface
 
 	/**
 	 * \Phalcon\Image\Adapter\Imagick constructor
+	 *
+	 * In lazy mode the image is only pinged, it's decoded when it's needed
 	 */
-	public function __construct(string! file, int width = null, int height = null)
+	public function __construct(string! file, int width = null, int height = null, boolean lazy = false)
 	{
 		var image;
 
@@ -81,6 +83,23 @@ class Imagick extends Adapter implements AdapterInterface
 		if file_exists(this->_file) {
 			let this->_realpath = realpath(this->_file);
 
+			if lazy && this->_image->pingImage(this->_realpath) {
+
+				let this->_width = this->_image->getImageWidth(),
+					this->_height = this->_image->getImageHeight(),
+					this->_type = this->_image->getImageType(),
+					this->_mime = "image/" . this->_image->getImageFormat();
+
+				this->_image->clear();
+				this->_image->destroy();
+
+				let this->_image = null,
+					this->_lazy = true,
+					this->_sourceWidth = this->_width,
+					this->_sourceHeight = this->_height;
+				return;
+			}
+
 			if !this->_image->readImage(this->_realpath) {
 				 throw new Exception("Imagick::readImage ".this->_file." failed");
 			}
@@ -114,6 +133,66 @@ class Imagick extends Adapter implements AdapterInterface
 		let this->_mime = "image/" . this->_image->getImageFormat();
 	}
 
+	/**
+	 * Decodes the image file. JPEG images are decoded at a reduced size (DCT scaling)
+	 * when the size hint is much smaller than the image
+	 */
+	protected function _decode(int width, int height) -> array
+	{
+		var image, frames;
+
+		let image = new \Imagick();
+
+		if width > 0 && height > 0 && this->_mime == "image/JPEG" {
+			image->setOption("jpeg:size", width . "x" . height);
+		}
+
+		if !image->readImage(this->_realpath) {
+			throw new Exception("Imagick::readImage " . this->_file . " failed");
+		}
+
+		if !image->getImageAlphaChannel() {
+			image->setImageAlphaChannel(constant("Imagick::ALPHACHANNEL_SET"));
+		}
+
+		if image->getNumberImages() > 1 {
+			let frames = image->coalesceImages();
+			image->clear();
+			image->destroy();
+			let image = frames;
+		}
+
+		let this->_image = image;
+
+		return [image->getImageWidth(), image->getImageHeight()];
+	}
+
+	/**
+	 * Executes a fused crop and resize with a single resample
+	 */
+	protected function _resample(int x, int y, int sourceWidth, int sourceHeight, int width, int height)
+	{
+		var image;
+
+		let image = this->_image;
+
+		image->setIteratorIndex(0);
+
+		loop {
+
+			image->cropImage(sourceWidth, sourceHeight, x, y);
+			image->setImagePage(sourceWidth, sourceHeight, 0, 0);
+			image->scaleImage(width, height);
+
+			if !image->nextImage() {
+				break;
+			}
+		}
+
+		let this->_width  = image->getImageWidth();
+		let this->_height = image->getImageHeight();
+	}
+
 	/**
 	 * Execute a resize.
 	 */
@@ -693,6 +772,7 @@ class Imagick extends Adapter implements AdapterInterface
 	 */
 	public function getInternalImInstance() -> <\Imagick>
 	{
+		this->_realize();
 		return this->_image;
 	}
 
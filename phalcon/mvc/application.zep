@@ -25,6 +25,8 @@ use Phalcon\Mvc\Application\Exception;
 use Phalcon\Mvc\ModuleDefinitionInterface;
 use Phalcon\Mvc\RouterInterface;
 use Phalcon\DiInterface;
+use Phalcon\Di;
+use Phalcon\Mvc\Model\Manager as ModelsManager;
 use Phalcon\Http\ResponseInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\DispatcherInterface;
@@ -189,13 +191,27 @@ class Application extends Injectable
 	{
 		var dependencyInjector, eventsManager, router, dispatcher, response, view,
 			module, moduleObject, moduleName, className, path,
-			implicitView, returnedResponse, controller, possibleResponse, renderStatus;
+			implicitView, returnedResponse, controller, possibleResponse, renderStatus,
+			di, modelsManager;
 
 		let dependencyInjector = this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
 			throw new Exception("A dependency injection object is required to access internal services");
 		}
 
+		/**
+		 * The connection routing of the models is kept for a single request
+		 */
+		if dependencyInjector instanceof Di {
+			let di = <Di> dependencyInjector;
+			if di->hasSharedInstance("modelsManager") {
+				let modelsManager = di->getShared("modelsManager");
+				if modelsManager instanceof ModelsManager {
+					modelsManager->clearConnectionRouting();
+				}
+			}
+		}
+
 		let eventsManager = <ManagerInterface> this->_eventsManager;
 
 		/**
@@ -336,12 +336,12 @@ abstract class Collection implements EntityInterface, CollectionInterface, Injec
 	 * @param \Phalcon\Mvc\Collection collection
 	 * @param \MongoDb connection
 	 * @param boolean unique
-	 * @return array
+	 * @return array|\Phalcon\Mvc\Collection\Resultset
 	 */
 	protected static function _getResultset(var params, <CollectionInterface> collection, connection, boolean unique)
 	{
 		var source, mongoCollection, conditions, base, documentsCursor,
-			fields, skip, limit, sort, document, collections, className;
+			fields, skip, limit, sort, document, collections, className, batchSize;
 
 		/**
 		 * Check if "class" clause was defined
@@ -410,6 +410,13 @@ abstract class Collection implements EntityInterface, CollectionInterface, Injec
 			documentsCursor->skip(skip);
 		}
 
+		/**
+		 * Check if a "batchSize" hint was defined
+		 */
+		if fetch batchSize, params["batchSize"] {
+			documentsCursor->batchSize(batchSize);
+		}
+
 		if unique === true {
 
 			/**
@@ -429,6 +436,13 @@ abstract class Collection implements EntityInterface, CollectionInterface, Injec
 			return static::cloneResult(base, document);
 		}
 
+		/**
+		 * Requesting a lazy resultset, documents are hydrated while iterating the cursor
+		 */
+		if isset params["lazy"] && params["lazy"] {
+			return new Collection\Resultset(documentsCursor, base, get_called_class());
+		}
+
 		/**
 		 * Requesting a complete resultset
 		 */
@@ -1016,9 +1030,20 @@ abstract class Collection implements EntityInterface, CollectionInterface, Injec
 	 * foreach ($robots as $robot) {
 	 *	   echo $robot->name, "\n";
 	 * }
+	 *
+	 * //Iterate over all the robots without loading them in memory
+	 * $robots = Robots::find(array(
+	 *     "lazy"      => true,
+	 *     "batchSize" => 1000
+	 * ));
+	 * foreach ($robots as $robot) {
+	 *	   echo $robot->name, "\n";
+	 * }
 	 * </code>
+	 *
+	 * @return array|\Phalcon\Mvc\Collection\Resultset
 	 */
-	public static function find(array parameters = null) -> array
+	public static function find(array parameters = null)
 	{
 		var className, collection;
 
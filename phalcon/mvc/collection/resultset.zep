@@ -0,0 +1,143 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Collection;
+
+/**
+ * Phalcon\Mvc\Collection\Resultset
+ *
+ * Lazy resultset returned by Phalcon\Mvc\Collection::find() when the "lazy" option is passed.
+ * It wraps the driver cursor, so documents are fetched in batches and hydrated one at a time
+ * while iterating, keeping the memory usage flat regardless of the size of the result
+ *
+ *<code>
+ * $robots = Robots::find(array(
+ *     array("type" => "virtual"),
+ *     "lazy"      => true,
+ *     "batchSize" => 500
+ * ));
+ * foreach ($robots as $robot) {
+ *	   echo $robot->name, "\n";
+ * }
+ *</code>
+ */
+class Resultset implements \Iterator, \Countable
+{
+
+	protected _cursor;
+
+	protected _base;
+
+	protected _className;
+
+	protected _position = 0;
+
+	/**
+	 * Phalcon\Mvc\Collection\Resultset constructor
+	 *
+	 * @param \MongoCursor cursor
+	 * @param \Phalcon\Mvc\CollectionInterface|\Phalcon\Mvc\Collection\Document base
+	 * @param string className class used to hydrate the documents
+	 */
+	public function __construct(var cursor, var base, string! className)
+	{
+		let this->_cursor = cursor,
+			this->_base = base,
+			this->_className = className;
+	}
+
+	/**
+	 * Rewinds the resultset re-executing the query if needed
+	 */
+	public function rewind() -> void
+	{
+		let this->_position = 0;
+		this->_cursor->rewind();
+	}
+
+	/**
+	 * Check whether the internal cursor has more documents
+	 */
+	public function valid() -> boolean
+	{
+		return this->_cursor->valid();
+	}
+
+	/**
+	 * Returns the position of the current document
+	 */
+	public function key() -> int
+	{
+		return this->_position;
+	}
+
+	/**
+	 * Moves the cursor to the next document
+	 */
+	public function next() -> void
+	{
+		let this->_position++;
+		this->_cursor->next();
+	}
+
+	/**
+	 * Returns the current document hydrated into a copy of the base object
+	 *
+	 * @return \Phalcon\Mvc\CollectionInterface|boolean
+	 */
+	public function current()
+	{
+		var document, className;
+
+		let document = this->_cursor->current();
+		if typeof document != "array" {
+			return false;
+		}
+
+		let className = this->_className;
+		return {className}::cloneResult(this->_base, document);
+	}
+
+	/**
+	 * Returns the number of documents matched by the query taking limit and skip into account
+	 */
+	public function count() -> int
+	{
+		return this->_cursor->count(true);
+	}
+
+	/**
+	 * Returns the documents as plain arrays without hydrating them into objects
+	 */
+	public function toArray() -> array
+	{
+		let this->_position = 0;
+		return iterator_to_array(this->_cursor, false);
+	}
+
+	/**
+	 * Returns the internal driver cursor
+	 *
+	 * @return \MongoCursor
+	 */
+	public function getCursor()
+	{
+		return this->_cursor;
+	}
+}
@@ -20,6 +20,8 @@
 namespace Phalcon\Mvc;
 
 use Phalcon\DiInterface;
+use Phalcon\Di;
+use Phalcon\Mvc\Model\Manager as ModelsManager;
 use Phalcon\Mvc\Micro\Exception;
 use Phalcon\Mvc\Router\RouteInterface;
 use Phalcon\Mvc\Micro\MiddlewareInterface;
@@ -579,13 +581,27 @@ class Micro extends Injectable implements \ArrayAccess
 	{
 		var dependencyInjector, eventsManager, status = null, router, matchedRoute,
 			handler, beforeHandlers, params, returnedValue, e, errorHandler,
-			afterHandlers, notFoundHandler, finishHandlers, finish, before, after;
+			afterHandlers, notFoundHandler, finishHandlers, finish, before, after,
+			di, modelsManager;
 
 		let dependencyInjector = this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
 			throw new Exception("A dependency injection container is required to access required micro services");
 		}
 
+		/**
+		 * The connection routing of the models is kept for a single request
+		 */
+		if dependencyInjector instanceof Di {
+			let di = <Di> dependencyInjector;
+			if di->hasSharedInstance("modelsManager") {
+				let modelsManager = di->getShared("modelsManager");
+				if modelsManager instanceof ModelsManager {
+					modelsManager->clearConnectionRouting();
+				}
+			}
+		}
+
 		try {
 
 			let returnedValue = null;
@@ -26,12 +26,14 @@ use Phalcon\DiInterface;
 use Phalcon\Mvc\Model\Message;
 use Phalcon\Mvc\Model\ResultInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\MetaDataInterface;
 use Phalcon\Mvc\Model\Criteria;
 use Phalcon\Db\AdapterInterface;
 use Phalcon\Db\DialectInterface;
 use Phalcon\Mvc\Model\CriteriaInterface;
+use Phalcon\Mvc\Model\Transaction;
 use Phalcon\Mvc\Model\TransactionInterface;
 use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Mvc\Model\Query;
@@ -42,6 +44,7 @@ use Phalcon\Mvc\Model\BehaviorInterface;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\Model\MessageInterface;
 use Phalcon\Mvc\Model\ValidationFailed;
+use Phalcon\Mvc\Model\Validator\Uniqueness;
 use Phalcon\Events\ManagerInterface as EventsManagerInterface;
 
 /**
@@ -104,6 +107,14 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 
 	protected _snapshot;
 
+	protected _verifiedForeignKeys;
+
+	protected _batchRecords;
+
+	protected _batchId;
+
+	protected static _batchNumber = 0;
+
 	const OP_NONE = 0;
 
 	const OP_CREATE = 1;
@@ -1121,11 +1132,19 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		let query = builder->getQuery();
 
 		/**
-		 * Check for bind parameters
+		 * Check for bind parameters, they're passed as defaults so array placeholders can be prepared
 		 */
-		let bindParams = null, bindTypes = null;
 		if fetch bindParams, params["bind"] {
-			fetch bindTypes, params["bindTypes"];
+
+			if typeof bindParams == "array" {
+				query->setBindParams(bindParams, true);
+			}
+
+			if fetch bindTypes, params["bindTypes"] {
+				if typeof bindTypes == "array" {
+					query->setBindTypes(bindTypes, true);
+				}
+			}
 		}
 
 		/**
@@ -1138,7 +1157,7 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		/**
 		 * Execute the query
 		 */
-		let resultset = query->execute(bindParams, bindTypes);
+		let resultset = query->execute();
 
 		/**
 		 * Return the full resultset if the query is grouped
@@ -1461,13 +1480,15 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 
 	/**
 	 * Reads "belongs to" relations and check the virtual foreign keys when inserting or updating records
-	 * to verify that inserted/updated values are present in the related entity
+	 * to verify that inserted/updated values are present in the related entity.
+	 * Relations pointing to the same referenced model are checked using a single query
 	 */
 	protected function _checkForeignKeysRestrict() -> boolean
 	{
-		var manager, belongsTo, foreignKey, relation, conditions,
-			position, bindParams, extraConditions, message, fields,
-			referencedFields, field, referencedModel, value, allowNulls;
+		var manager, belongsTo, foreignKey, relation, conditions, verified,
+			position, bindParams, extraConditions, message, fields, checks, check,
+			referencedFields, field, referencedModel, value, allowNulls, groups,
+			referencedClass, group, failed, relationKey;
 		int action, numberNull;
 		boolean error, validateWithNulls = false;
 
@@ -1482,7 +1503,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		let belongsTo = manager->getBelongsTo(this);
 		if count(belongsTo) {
 
-			let error = false;
+			/**
+			 * Relations already verified for this record by saveBatch() are skipped
+			 */
+			let verified = this->_verifiedForeignKeys,
+				this->_verifiedForeignKeys = null;
+
+			let checks = [], groups = [];
 			for relation in belongsTo {
 
 				let foreignKey = relation->getForeignKey();
@@ -1507,10 +1534,6 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 					 */
 					if action == Relation::ACTION_RESTRICT {
 
-						/**
-						 * Load the referenced model if needed
-						 */
-						let referencedModel = manager->load(relation->getReferencedModel());
 
 						/**
 						 * Since relations can have multiple columns or a single one, we need to build a condition for each of these cases
@@ -1518,6 +1541,7 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 						let conditions = [], bindParams = [];
 
 						let numberNull = 0,
+							validateWithNulls = false,
 							fields = relation->getFields(),
 							referencedFields = relation->getReferencedFields();
 
@@ -1547,11 +1571,11 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 							}
 						}
 
-						/**
-						 * Check if the virtual foreign key has extra conditions
-						 */
-						if fetch extraConditions, foreignKey["conditions"] {
-							let conditions[] = extraConditions;
+						if typeof verified == "array" && typeof fields != "array" {
+							let relationKey = spl_object_hash(relation);
+							if isset verified[relationKey] && verified[relationKey] === value {
+								continue;
+							}
 						}
 
 						/**
@@ -1565,33 +1589,99 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 							}
 						}
 
+						if validateWithNulls {
+							continue;
+						}
+
 						/**
-						 * We don't trust the actual values in the object and pass the values using bound parameters
-						 * Let's make the checking
+						 * Checks with extra conditions can't be merged with other ones
 						 */
-						if !validateWithNulls && !referencedModel->count([join(" AND ", conditions), "bind": bindParams]) {
+						let referencedClass = relation->getReferencedModel();
+						if fetch extraConditions, foreignKey["conditions"] {
+							let conditions[] = extraConditions,
+								referencedClass = null;
+						}
 
-							/**
-							 * Get the user message or produce a new one
-							 */
-							if !fetch message, foreignKey["message"] {
-								if typeof fields == "array" {
-									let message = "Value of fields \"" . join(", ", fields) . "\" does not exist on referenced table";
-								} else {
-									let message = "Value of field \"" . fields . "\" does not exist on referenced table";
-								}
-							}
+						if referencedClass !== null {
+							let referencedClass = strtolower(referencedClass);
+						}
 
-							/**
-							 * Create a message
-							 */
-							this->appendMessage(new Message(message, fields, "ConstraintViolation"));
-							let error = true;
-							break;
+						let checks[] = [relation, foreignKey, fields, referencedFields, conditions, bindParams, referencedClass];
+
+						if referencedClass !== null {
+							if !isset groups[referencedClass] {
+								let groups[referencedClass] = [];
+							}
+							let group = groups[referencedClass],
+								group[] = count(checks) - 1,
+								groups[referencedClass] = group;
 						}
+					}
+				}
+			}
+
+			/**
+			 * Find the checks failing when their referenced model is shared with other ones
+			 */
+			let failed = [];
+			for group in groups {
+				if count(group) > 1 {
+					let failed = array_merge(failed, this->_checkForeignKeysGroup(manager, checks, group));
+				}
+			}
+
+			let error = false;
+			for position, check in checks {
+
+				let relation = check[0],
+					referencedClass = check[6],
+					group = [];
+
+				if referencedClass !== null {
+					let group = groups[referencedClass];
+				}
+
+				/**
+				 * Values not matched by the grouped query are counted again, the database collation may
+				 * consider equal values that are different in PHP
+				 */
+				if count(group) > 1 && !in_array(position, failed) {
+					continue;
+				}
+
+				/**
+				 * Load the referenced model if needed
+				 */
+				let referencedModel = manager->load(relation->getReferencedModel());
+
+				/**
+				 * We don't trust the actual values in the object and pass the values using bound parameters
+				 * Let's make the checking
+				 */
+				if referencedModel->count([join(" AND ", check[4]), "bind": check[5]]) {
+					continue;
+				}
 
+				let foreignKey = check[1],
+					fields = check[2];
+
+				/**
+				 * Get the user message or produce a new one
+				 */
+				if !fetch message, foreignKey["message"] {
+					if typeof fields == "array" {
+						let message = "Value of fields \"" . join(", ", fields) . "\" does not exist on referenced table";
+					} else {
+						let message = "Value of field \"" . fields . "\" does not exist on referenced table";
 					}
 				}
+
+				/**
+				 * Create a message
+				 */
+				this->appendMessage(new Message(message, fields, "ConstraintViolation"));
+				let error = true;
+				break;
 			}
 
 			/**
@@ -1609,6 +1699,81 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return true;
 	}
 
+	/**
+	 * Checks several virtual foreign keys referencing the same model with a single query,
+	 * returns the positions of the checks whose values weren't found
+	 */
+	protected function _checkForeignKeysGroup(<ManagerInterface> manager, array! checks, array! group) -> array
+	{
+		var position, check, relation, referencedModel, conditions, bindParams, columns, referencedFields,
+			index, field, value, resultset, rows, row, failed, found, key;
+
+		let conditions = [], bindParams = [], columns = [];
+
+		for position in group {
+
+			let check = checks[position],
+				referencedFields = check[3];
+
+			if typeof referencedFields != "array" {
+				let referencedFields = [referencedFields];
+			}
+
+			let key = [];
+			for index, field in referencedFields {
+				let key[] = "[" . field . "] = :fk" . position . "_" . index . ":",
+					bindParams["fk" . position . "_" . index] = check[5][index],
+					columns[field] = "[" . field . "]";
+			}
+
+			let conditions[] = "(" . join(" AND ", key) . ")";
+		}
+
+		let check = checks[group[0]],
+			relation = check[0],
+			referencedModel = manager->load(relation->getReferencedModel());
+
+		let resultset = referencedModel->find([
+			join(" OR ", conditions),
+			"bind": bindParams,
+			"columns": join(", ", columns)
+		]);
+
+		let rows = resultset->toArray();
+
+		let failed = [];
+		for position in group {
+
+			let check = checks[position],
+				referencedFields = check[3];
+
+			if typeof referencedFields != "array" {
+				let referencedFields = [referencedFields];
+			}
+
+			let found = false;
+			for row in rows {
+				let found = true;
+				for index, field in referencedFields {
+					fetch value, row[field];
+					if (string) value !== (string) check[5][index] {
+						let found = false;
+						break;
+					}
+				}
+				if found {
+					break;
+				}
+			}
+
+			if !found {
+				let failed[] = position;
+			}
+		}
+
+		return failed;
+	}
+
 	/**
 	 * Reads both "hasMany" and "hasOne" relations and checks the virtual foreign keys (cascade) when deleting records
 	 */
@@ -2067,6 +2232,41 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return true;
 	}
 
+	/**
+	 * Invalidates the resultsets of this model stored by the automatic query cache. Inside a transaction
+	 * the version is replaced again on commit as other connections could cache the rows not committed yet
+	 */
+	protected function _touchQueryCache() -> void
+	{
+		var manager, transaction;
+
+		let manager = this->_modelsManager;
+		if manager instanceof Manager {
+			manager->bumpModelVersion(get_class(this));
+
+			let transaction = this->_transaction;
+			if transaction instanceof Transaction {
+				transaction->touchModel(manager, get_class(this));
+			}
+		}
+	}
+
+	/**
+	 * Invalidates the query cache of this model and pins its reads to the write connection
+	 * after a record was written
+	 */
+	protected function _registerWrite() -> void
+	{
+		var manager;
+
+		this->_touchQueryCache();
+
+		let manager = this->_modelsManager;
+		if manager instanceof Manager {
+			manager->registerWrite(this);
+		}
+	}
+
 	/**
 	 * Executes internal events after save a record
 	 */
@@ -2084,20 +2284,17 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	}
 
 	/**
-	 * Sends a pre-build INSERT SQL statement to the relational database system
+	 * Builds the fields, values and bind types of the INSERT statement for the current record
 	 *
 	 * @param \Phalcon\Mvc\Model\MetaDataInterface metaData
 	 * @param \Phalcon\Db\AdapterInterface connection
-	 * @param string|array table
 	 * @param boolean|string identityField
-	 * @return boolean
+	 * @return array
 	 */
-	protected function _doLowInsert(<MetaDataInterface> metaData, <AdapterInterface> connection,
-		table, identityField) -> boolean
+	protected function _getInsertRow(<MetaDataInterface> metaData, <AdapterInterface> connection, identityField) -> array
 	{
 		var bindSkip, fields, values, bindTypes, attributes, bindDataTypes, automaticAttributes,
-			field, columnMap, value, attributeField, success, bindType,
-			defaultValue, sequenceName, defaultValues, source, schema;
+			field, columnMap, value, attributeField, bindType, defaultValue, defaultValues;
 		boolean useExplicitIdentity;
 
 		let bindSkip = Column::BIND_SKIP;
@@ -2232,12 +2429,48 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			}
 		}
 
+		return [fields, values, bindTypes];
+	}
+
+	/**
+	 * Sends a pre-build INSERT SQL statement to the relational database system
+	 *
+	 * @param \Phalcon\Mvc\Model\MetaDataInterface metaData
+	 * @param \Phalcon\Db\AdapterInterface connection
+	 * @param string|array table
+	 * @param boolean|string identityField
+	 * @return boolean
+	 */
+	protected function _doLowInsert(<MetaDataInterface> metaData, <AdapterInterface> connection,
+		table, identityField) -> boolean
+	{
+		var row, columnMap, attributeField, success, sequenceName, source, schema;
+
+		let row = this->_getInsertRow(metaData, connection, identityField);
+
 		/**
 		 * The low level insert is performed
 		 */
-		let success = connection->insert(table, values, fields, bindTypes);
+		let success = connection->insert(table, row[1], row[0], row[2]);
 		if success && identityField !== false {
 
+			/**
+			 * Check if the model has a column map
+			 */
+			if globals_get("orm.column_renaming") {
+				let columnMap = metaData->getColumnMap(this);
+			} else {
+				let columnMap = null;
+			}
+
+			if typeof columnMap == "array" {
+				if !fetch attributeField, columnMap[identityField] {
+					throw new Exception("Identity column '" . identityField . "' isn't part of the column map");
+				}
+			} else {
+				let attributeField = identityField;
+			}
+
 			/**
 			 * We check if the model have sequences
 			 */
@@ -2920,6 +3153,7 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		if success === false {
 			this->_cancelOperation();
 		} else {
+			this->_registerWrite();
 			this->fireEvent("afterSave");
 		}
 
@@ -3141,6 +3375,10 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			}
 		}
 
+		if success {
+			this->_registerWrite();
+		}
+
 		if globals_get("orm.events") {
 			if success {
 				this->fireEvent("afterDelete");
@@ -3156,90 +3394,798 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	}
 
 	/**
-	 * Returns the type of the latest operation performed by the ORM
-	 * Returns one of the OP_* class constants
-	 */
-	public function getOperationMade() -> int
-	{
-		return this->_operationMade;
-	}
-
-	/**
-	 * Refreshes the model attributes re-querying the record from the database
+	 * Inserts or updates several model instances reducing the number of round trips to the database.
+	 * Records are grouped by class, their existence is checked using a single query per batch and new
+	 * records that don't need a generated identity are written using multi-row INSERT statements.
+	 * Validations and events are run for every record exactly as in save()
+	 *
+	 *<code>
+	 *	$robots = array();
+	 *	foreach ($data as $row) {
+	 *		$robot = new Robots();
+	 *		$robot->assign($row);
+	 *		$robots[] = $robot;
+	 *	}
+	 *	Robots::saveBatch($robots);
+	 *</code>
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface[] records
+	 * @param int batchSize
+	 * @return boolean
 	 */
-	public function refresh() -> <Model>
+	public static function saveBatch(array! records, int batchSize = 500) -> boolean
 	{
-		var metaData, readConnection, schema, source, table,
-			uniqueKey, tables, uniqueParams, dialect, row, fields, attribute;
+		var groups, record, group, first, metaData, writeConnection, readConnection,
+			schema, source, table, identityField, existing, exists, result, pending,
+			signature, insert, chunk, chunkRecords, chunkRows, success, related, batchId;
 
-		if this->_dirtyState != self::DIRTY_STATE_PERSISTENT {
-			throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
+		if batchSize < 1 {
+			throw new Exception("The batch size must be greater than zero");
 		}
 
-		let metaData = this->getModelsMetaData(),
-			readConnection = this->getReadConnection();
-
-		let schema = this->getSchema(),
-			source = this->getSource();
+		let groups = self::_groupRecords(records);
 
-		if schema {
-			let table = [schema, source];
-		} else {
-			let table = source;
-		}
+		for group in groups {
 
-		let uniqueKey = this->_uniqueKey;
-		if !uniqueKey {
+			let first = group[0],
+				metaData = first->getModelsMetaData(),
+				writeConnection = first->getWriteConnection(),
+				readConnection = first->getReadConnection();
 
 			/**
-			 * We need to check if the record exists
+			 * Every group is a different batch for the validators
 			 */
-			if !this->_exists(metaData, readConnection, table) {
-				throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
+			let self::_batchNumber = self::_batchNumber + 1,
+				batchId = self::_batchNumber;
+
+			let schema = first->getSchema(),
+				source = first->getSource();
+
+			if schema {
+				let table = [schema, source];
+			} else {
+				let table = source;
 			}
 
-			let uniqueKey = this->_uniqueKey;
-		}
+			let identityField = metaData->getIdentityField(first);
 
-		let uniqueParams = this->_uniqueParams;
-		if typeof uniqueParams != "array" {
-			throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
-		}
+			/**
+			 * Check the existence of the whole group in chunks
+			 */
+			let existing = first->_batchExists(metaData, readConnection, table, group, batchSize);
 
-		/**
-		 * We only refresh the attributes in the model's metadata
-		 */
-		let fields = [];
-		for attribute in metaData->getAttributes(this) {
-			let fields[] = [attribute];
-		}
+			/**
+			 * Virtual foreign keys of the whole group are verified in chunks too
+			 */
+			first->_batchForeignKeys(group, batchSize);
 
-		/**
-		 * We directly build the SELECT to save resources
-		 */
-		let dialect = readConnection->getDialect(),
-			tables = dialect->select([
-				"columns": fields,
-				"tables":  readConnection->escapeIdentifier(table),
-				"where":   uniqueKey
-			]),
-			row = readConnection->fetchOne(tables, \Phalcon\Db::FETCH_ASSOC, uniqueParams, this->_uniqueTypes);
+			let pending = [];
+			for record in group {
 
-		/**
-		 * Get a column map if any
-		 * Assign the resulting array to the this object
-		 */
-		if typeof row == "array" {
-			this->assign(row, metaData->getColumnMap(this));
-		}
+				/**
+				 * Records with related records are saved one by one since they need their own transaction
+				 */
+				let related = record->_related;
+				if typeof related == "array" && count(related) {
+					if record->save() === false {
+						first->_registerWrite();
+						return false;
+					}
+					continue;
+				}
 
-		return this;
-	}
+				if fetch exists, existing[spl_object_hash(record)] {
+					let exists = (boolean) exists;
+				} else {
+					let exists = record->_exists(metaData, readConnection, table);
+				}
 
-	/**
-	 * Skips the current operation forcing a success state
-	 */
-	public function skipOperation(boolean skip)
+				let record->_batchRecords = group,
+					record->_batchId = batchId;
+				let result = record->_preBatchSave(metaData, writeConnection, table, identityField, exists);
+				let record->_batchRecords = null,
+					record->_batchId = null;
+				if result === false {
+					Uniqueness::clearBatch();
+					first->_registerWrite();
+					return false;
+				}
+
+				/**
+				 * Rows with the same columns and bind types are inserted together
+				 */
+				if typeof result == "array" {
+					let signature = join(",", result[0]) . "|" . join(",", result[2]);
+					if !isset pending[signature] {
+						let pending[signature] = [result[0], result[2], [], []];
+					}
+					let insert = pending[signature],
+						insert[2][] = result[1],
+						insert[3][] = record,
+						pending[signature] = insert;
+				}
+			}
+
+			/**
+			 * The batch was validated, the values cached by the validators aren't needed anymore
+			 */
+			Uniqueness::clearBatch();
+
+			for insert in pending {
+				for chunk in array_chunk(array_keys(insert[2]), batchSize) {
+
+					let chunkRows = [],
+						chunkRecords = [];
+					for result in chunk {
+						let chunkRows[] = insert[2][result],
+							chunkRecords[] = insert[3][result];
+					}
+
+					let success = writeConnection->insertMultiple(table, chunkRows, insert[0], insert[1]);
+					for record in chunkRecords {
+						if record->_postBatchSave(success, false) === false {
+							let success = false;
+						}
+					}
+
+					if !success {
+						first->_registerWrite();
+						return false;
+					}
+				}
+			}
+
+			/**
+			 * The query cache is invalidated once per group instead of once per record
+			 */
+			first->_registerWrite();
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several model instances using a single DELETE statement per batch when the model
+	 * has a single column primary key. Virtual foreign keys and events are checked for every record
+	 * exactly as in delete()
+	 *
+	 *<code>
+	 *	$robots = array();
+	 *	foreach (Robots::find("type = 'mechanical'") as $robot) {
+	 *		$robots[] = $robot;
+	 *	}
+	 *	Robots::deleteBatch($robots);
+	 *</code>
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface[] records
+	 * @param int batchSize
+	 * @return boolean
+	 */
+	public static function deleteBatch(array! records, int batchSize = 500) -> boolean
+	{
+		var groups, group, first, metaData, writeConnection, primaryKeys, primaryKey,
+			bindDataTypes, bindType, columnMap, attributeField, schema, source, table,
+			chunk, record, value, values, bindTypes, placeholders, deleted, success;
+
+		if batchSize < 1 {
+			throw new Exception("The batch size must be greater than zero");
+		}
+
+		let groups = self::_groupRecords(records);
+
+		for group in groups {
+
+			let first = group[0],
+				metaData = first->getModelsMetaData(),
+				primaryKeys = metaData->getPrimaryKeyAttributes(first);
+
+			/**
+			 * Models with composite primary keys are deleted one by one
+			 */
+			if count(primaryKeys) != 1 {
+				for record in group {
+					if record->delete() === false {
+						return false;
+					}
+				}
+				continue;
+			}
+
+			let primaryKey = primaryKeys[0],
+				bindDataTypes = metaData->getBindTypes(first),
+				writeConnection = first->getWriteConnection();
+
+			if !fetch bindType, bindDataTypes[primaryKey] {
+				throw new Exception("Column '" . primaryKey . "' have not defined a bind data type");
+			}
+
+			if globals_get("orm.column_renaming") {
+				let columnMap = metaData->getColumnMap(first);
+			} else {
+				let columnMap = null;
+			}
+
+			if typeof columnMap == "array" {
+				if !fetch attributeField, columnMap[primaryKey] {
+					throw new Exception("Column '" . primaryKey . "' isn't part of the column map");
+				}
+			} else {
+				let attributeField = primaryKey;
+			}
+
+			let schema = first->getSchema(),
+				source = first->getSource();
+
+			if schema {
+				let table = [schema, source];
+			} else {
+				let table = source;
+			}
+
+			for chunk in array_chunk(group, batchSize) {
+
+				let values = [],
+					bindTypes = [],
+					placeholders = [],
+					deleted = [];
+
+				for record in chunk {
+
+					if !fetch value, record->{attributeField} {
+						throw new Exception("Cannot delete the record because the primary key attribute: '" . attributeField . "' wasn't set");
+					}
+
+					/**
+					 * Records whose checks or events cancel the operation stop the batch, skipped records aren't deleted
+					 */
+					let success = record->_preBatchDelete();
+					if success === false {
+						first->_registerWrite();
+						return false;
+					}
+
+					if success === null {
+						continue;
+					}
+
+					let values[] = value,
+						bindTypes[] = bindType,
+						placeholders[] = "?",
+						deleted[] = record;
+				}
+
+				if !count(deleted) {
+					continue;
+				}
+
+				let success = writeConnection->delete(
+					table,
+					writeConnection->escapeIdentifier(primaryKey) . " IN (" . join(", ", placeholders) . ")",
+					values,
+					bindTypes
+				);
+
+				for record in deleted {
+					if record->_postBatchDelete(success) === false {
+						let success = false;
+					}
+				}
+
+				if !success {
+					first->_registerWrite();
+					return false;
+				}
+			}
+
+			/**
+			 * The query cache is invalidated once per group instead of once per record
+			 */
+			first->_registerWrite();
+		}
+
+		return true;
+	}
+
+	/**
+	 * Groups a list of records by class and transaction keeping the order in which they were first found
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface[] records
+	 * @return array
+	 */
+	protected static function _groupRecords(array! records) -> array
+	{
+		var groups, record, groupKey, transaction;
+
+		let groups = [];
+		for record in records {
+
+			if typeof record != "object" || !(record instanceof ModelInterface) {
+				throw new Exception("Only model instances can be processed in a batch");
+			}
+
+			/**
+			 * Records under different transactions are written through different connections
+			 */
+			let groupKey = get_class(record),
+				transaction = record->_transaction;
+			if typeof transaction == "object" {
+				let groupKey .= ":" . spl_object_hash(transaction);
+			}
+
+			if !isset groups[groupKey] {
+				let groups[groupKey] = [];
+			}
+			let groups[groupKey][] = record;
+		}
+
+		return groups;
+	}
+
+	/**
+	 * Verifies the single column virtual foreign keys of several records of the same model using
+	 * an IN query per relation and chunk. Records whose value was found are marked so
+	 * _checkForeignKeysRestrict() doesn't query it again, the rest are checked one by one
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface[] records
+	 * @param int batchSize
+	 */
+	protected function _batchForeignKeys(array! records, int batchSize) -> void
+	{
+		var manager, relation, foreignKey, field, referencedField, referencedModel, relationKey,
+			values, value, record, chunk, resultset, row, found, verified;
+
+		if !globals_get("orm.virtual_foreign_keys") || count(records) < 2 {
+			return;
+		}
+
+		let manager = <ManagerInterface> this->_modelsManager;
+
+		for relation in manager->getBelongsTo(this) {
+
+			let foreignKey = relation->getForeignKey();
+			if foreignKey === false {
+				continue;
+			}
+
+			/**
+			 * Only restrict actions on a single column without extra conditions are checked in bulk
+			 */
+			if typeof foreignKey == "array" {
+				if isset foreignKey["action"] && (int) foreignKey["action"] != Relation::ACTION_RESTRICT {
+					continue;
+				}
+				if isset foreignKey["conditions"] {
+					continue;
+				}
+			}
+
+			let field = relation->getFields();
+			if typeof field == "array" {
+				continue;
+			}
+
+			let values = [];
+			for record in records {
+				if fetch value, record->{field} {
+					if value !== null && (typeof value == "string" || typeof value == "int") {
+						let values[value] = value;
+					}
+				}
+			}
+
+			if !count(values) {
+				continue;
+			}
+
+			let referencedField = relation->getReferencedFields(),
+				referencedModel = manager->load(relation->getReferencedModel()),
+				found = [];
+
+			for chunk in array_chunk(array_values(values), batchSize) {
+
+				let resultset = referencedModel->find([
+					"[" . referencedField . "] IN ({values:array})",
+					"bind": ["values": chunk],
+					"columns": "[" . referencedField . "]"
+				]);
+
+				for row in resultset->toArray() {
+					let found[row[referencedField]] = true;
+				}
+			}
+
+			/**
+			 * Values are matched exactly, anything else is left to the regular check
+			 */
+			let relationKey = spl_object_hash(relation);
+			for record in records {
+				if fetch value, record->{field} {
+					if (typeof value == "string" || typeof value == "int") && isset found[value] {
+						let verified = record->_verifiedForeignKeys;
+						if typeof verified != "array" {
+							let verified = [];
+						}
+						let verified[relationKey] = value,
+							record->_verifiedForeignKeys = verified;
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Checks the existence of several records of the same model using a single query per chunk.
+	 * Returns the existence of every checked record indexed by its object hash, records that
+	 * can't be checked this way are left to _exists()
+	 *
+	 * @param \Phalcon\Mvc\Model\MetaDataInterface metaData
+	 * @param \Phalcon\Db\AdapterInterface connection
+	 * @param string|array table
+	 * @param \Phalcon\Mvc\ModelInterface[] records
+	 * @param int batchSize
+	 * @return array
+	 */
+	protected function _batchExists(<MetaDataInterface> metaData, <AdapterInterface> connection, var table,
+		array! records, int batchSize) -> array
+	{
+		var primaryKeys, primaryKey, bindDataTypes, bindType, columnMap, attributeField,
+			existing, candidates, chunk, record, value, values, bindTypes, placeholders,
+			rows, row, found, escapedKey;
+
+		let existing = [],
+			primaryKeys = metaData->getPrimaryKeyAttributes(this);
+
+		if count(primaryKeys) != 1 {
+			return existing;
+		}
+
+		let primaryKey = primaryKeys[0],
+			bindDataTypes = metaData->getBindTypes(this);
+
+		if !fetch bindType, bindDataTypes[primaryKey] {
+			return existing;
+		}
+
+		if globals_get("orm.column_renaming") {
+			let columnMap = metaData->getColumnMap(this);
+		} else {
+			let columnMap = null;
+		}
+
+		if typeof columnMap == "array" {
+			if !fetch attributeField, columnMap[primaryKey] {
+				throw new Exception("Column '" . primaryKey . "' isn't part of the column map");
+			}
+		} else {
+			let attributeField = primaryKey;
+		}
+
+		/**
+		 * Records already known as persistent don't need to be checked, records without
+		 * a primary key value don't exist
+		 */
+		let candidates = [];
+		for record in records {
+
+			if record->_dirtyState == self::DIRTY_STATE_PERSISTENT {
+				continue;
+			}
+
+			let value = null;
+			if !fetch value, record->{attributeField} {
+				let existing[spl_object_hash(record)] = false;
+				continue;
+			}
+
+			if value === null || value === "" {
+				let existing[spl_object_hash(record)] = false;
+				continue;
+			}
+
+			let candidates[] = [record, value];
+		}
+
+		if !count(candidates) {
+			return existing;
+		}
+
+		let escapedKey = connection->escapeIdentifier(primaryKey);
+
+		for chunk in array_chunk(candidates, batchSize) {
+
+			let values = [],
+				bindTypes = [],
+				placeholders = [];
+
+			for record in chunk {
+				let values[] = record[1],
+					bindTypes[] = bindType,
+					placeholders[] = "?";
+			}
+
+			let rows = connection->fetchAll(
+				"SELECT " . escapedKey . " FROM " . connection->escapeIdentifier(table) . " WHERE " . escapedKey . " IN (" . join(", ", placeholders) . ")",
+				\Phalcon\Db::FETCH_NUM,
+				values,
+				bindTypes
+			);
+
+			let found = [];
+			for row in rows {
+				let found[(string) row[0]] = true;
+			}
+
+			for row in chunk {
+				let record = row[0],
+					value = (string) row[1];
+				if isset found[value] {
+
+					/**
+					 * The unique key is set as _exists() does, so the record can be updated
+					 */
+					let record->_dirtyState = self::DIRTY_STATE_PERSISTENT,
+						record->_uniqueKey = escapedKey . " = ?",
+						record->_uniqueParams = [row[1]],
+						record->_uniqueTypes = [bindType],
+						existing[spl_object_hash(record)] = true;
+				} else {
+					let record->_dirtyState = self::DIRTY_STATE_TRANSIENT,
+						existing[spl_object_hash(record)] = false;
+				}
+			}
+		}
+
+		return existing;
+	}
+
+	/**
+	 * Runs the validations and events of save() for a record processed in a batch.
+	 * Updates and inserts that need a generated identity are executed immediately,
+	 * otherwise the INSERT row is returned to be written together with the rest of the batch
+	 *
+	 * @param \Phalcon\Mvc\Model\MetaDataInterface metaData
+	 * @param \Phalcon\Db\AdapterInterface connection
+	 * @param string|array table
+	 * @param boolean|string identityField
+	 * @param boolean exists
+	 * @return boolean|array
+	 */
+	protected function _preBatchSave(<MetaDataInterface> metaData, <AdapterInterface> connection, var table,
+		identityField, boolean exists)
+	{
+		var columnMap, attributeField, value;
+		boolean needsIdentity;
+
+		this->fireEvent("prepareSave");
+
+		if exists {
+			let this->_operationMade = self::OP_UPDATE;
+		} else {
+			let this->_operationMade = self::OP_CREATE;
+		}
+
+		let this->_errorMessages = [];
+
+		/**
+		 * _preSave() makes all the validations
+		 */
+		if this->_preSave(metaData, exists, identityField) === false {
+
+			if globals_get("orm.exception_on_failed_save") {
+				throw new ValidationFailed(this, this->getMessages());
+			}
+
+			return false;
+		}
+
+		if exists {
+			return this->_postBatchSave(this->_doLowUpdate(metaData, connection, table), true);
+		}
+
+		/**
+		 * Records without an explicit identity value need the generated one, they're inserted alone
+		 */
+		let needsIdentity = false;
+		if identityField !== false {
+
+			if globals_get("orm.column_renaming") {
+				let columnMap = metaData->getColumnMap(this);
+			} else {
+				let columnMap = null;
+			}
+
+			if typeof columnMap == "array" {
+				if !fetch attributeField, columnMap[identityField] {
+					throw new Exception("Identity column '" . identityField . "' isn't part of the column map");
+				}
+			} else {
+				let attributeField = identityField;
+			}
+
+			let needsIdentity = true;
+			if fetch value, this->{attributeField} {
+				if value !== null && value !== "" {
+					let needsIdentity = false;
+				}
+			}
+		}
+
+		if needsIdentity {
+			return this->_postBatchSave(this->_doLowInsert(metaData, connection, table, identityField), false);
+		}
+
+		return this->_getInsertRow(metaData, connection, identityField);
+	}
+
+	/**
+	 * Completes the save of a record processed in a batch invoking the after* events
+	 *
+	 * @param boolean success
+	 * @param boolean exists
+	 * @return boolean
+	 */
+	protected function _postBatchSave(boolean success, boolean exists) -> boolean
+	{
+		if success {
+			let this->_dirtyState = self::DIRTY_STATE_PERSISTENT;
+		}
+
+		if globals_get("orm.events") {
+			let success = this->_postSave(success, exists);
+		}
+
+		if success === false {
+			this->_cancelOperation();
+		} else {
+			this->fireEvent("afterSave");
+		}
+
+		return success;
+	}
+
+	/**
+	 * Runs the checks and events of delete() for a record processed in a batch.
+	 * Returns null if the operation must be skipped
+	 *
+	 * @return boolean|null
+	 */
+	protected function _preBatchDelete()
+	{
+		let this->_operationMade = self::OP_DELETE,
+			this->_errorMessages = [];
+
+		if globals_get("orm.virtual_foreign_keys") {
+			if this->_checkForeignKeysReverseRestrict() === false {
+				return false;
+			}
+		}
+
+		if globals_get("orm.events") {
+
+			let this->_skipped = false;
+
+			if this->fireEventCancel("beforeDelete") === false {
+				return false;
+			}
+
+			if this->_skipped === true {
+				return null;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Completes the deletion of a record processed in a batch
+	 *
+	 * @param boolean success
+	 * @return boolean
+	 */
+	protected function _postBatchDelete(boolean success) -> boolean
+	{
+		if globals_get("orm.virtual_foreign_keys") {
+			if this->_checkForeignKeysReverseCascade() === false {
+				return false;
+			}
+		}
+
+		if globals_get("orm.events") {
+			if success {
+				this->fireEvent("afterDelete");
+			}
+		}
+
+		let this->_dirtyState = self::DIRTY_STATE_DETACHED;
+
+		return success;
+	}
+
+	/**
+	 * Returns the type of the latest operation performed by the ORM
+	 * Returns one of the OP_* class constants
+	 */
+	public function getOperationMade() -> int
+	{
+		return this->_operationMade;
+	}
+
+	/**
+	 * Refreshes the model attributes re-querying the record from the database
+	 */
+	public function refresh() -> <Model>
+	{
+		var metaData, readConnection, schema, source, table,
+			uniqueKey, tables, uniqueParams, dialect, row, fields, attribute;
+
+		if this->_dirtyState != self::DIRTY_STATE_PERSISTENT {
+			throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
+		}
+
+		let metaData = this->getModelsMetaData(),
+			readConnection = this->getReadConnection();
+
+		let schema = this->getSchema(),
+			source = this->getSource();
+
+		if schema {
+			let table = [schema, source];
+		} else {
+			let table = source;
+		}
+
+		let uniqueKey = this->_uniqueKey;
+		if !uniqueKey {
+
+			/**
+			 * We need to check if the record exists
+			 */
+			if !this->_exists(metaData, readConnection, table) {
+				throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
+			}
+
+			let uniqueKey = this->_uniqueKey;
+		}
+
+		let uniqueParams = this->_uniqueParams;
+		if typeof uniqueParams != "array" {
+			throw new Exception("The record cannot be refreshed because it does not exist or is deleted");
+		}
+
+		/**
+		 * We only refresh the attributes in the model's metadata
+		 */
+		let fields = [];
+		for attribute in metaData->getAttributes(this) {
+			let fields[] = [attribute];
+		}
+
+		/**
+		 * We directly build the SELECT to save resources
+		 */
+		let dialect = readConnection->getDialect(),
+			tables = dialect->select([
+				"columns": fields,
+				"tables":  readConnection->escapeIdentifier(table),
+				"where":   uniqueKey
+			]),
+			row = readConnection->fetchOne(tables, \Phalcon\Db::FETCH_ASSOC, uniqueParams, this->_uniqueTypes);
+
+		/**
+		 * Get a column map if any
+		 * Assign the resulting array to the this object
+		 */
+		if typeof row == "array" {
+			this->assign(row, metaData->getColumnMap(this));
+		}
+
+		return this;
+	}
+
+	/**
+	 * Skips the current operation forcing a success state
+	 */
+	public function skipOperation(boolean skip)
 	{
 		let this->_skipped = skip;
 	}
@@ -3531,6 +4477,28 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		(<ManagerInterface> this->_modelsManager)->addBehavior(this, behavior);
 	}
 
+	/**
+	 * Returns the records being saved by Phalcon\Mvc\Model::saveBatch() together with this one,
+	 * validators use it to check the whole batch at once. Returns null outside a batch
+	 *
+	 * @return \Phalcon\Mvc\ModelInterface[]|null
+	 */
+	public function getBatchRecords()
+	{
+		return this->_batchRecords;
+	}
+
+	/**
+	 * Returns a number identifying the batch of Phalcon\Mvc\Model::saveBatch() the record is being saved in,
+	 * validators use it to cache the data of a batch. Returns null outside a batch
+	 *
+	 * @return int|null
+	 */
+	public function getBatchId()
+	{
+		return this->_batchId;
+	}
+
 	/**
 	 * Sets if the model must keep the original record snapshot in memory
 	 *
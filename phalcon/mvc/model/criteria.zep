@@ -435,37 +435,29 @@ class Criteria implements CriteriaInterface, InjectionAwareInterface
 	 *<code>
 	 *	$criteria->inWhere('id', [1, 2, 3]);
 	 *</code>
+	 *
+	 * @see \Phalcon\Mvc\Model\Query\Builder::inWhere()
 	 */
 	public function inWhere(string! expr, array! values) -> <Criteria>
 	{
-		var hiddenParam, bindParams, bindKeys, value, key, queryKey;
-
-		let hiddenParam = this->_hiddenParamNumber;
+		var hiddenParam, key;
 
-		let bindParams = [];
-		let bindKeys = [];
-
-		for value in values {
-
-			/**
-			 * Key with auto bind-params
-			 */
-			let key = "ACP" . hiddenParam;
-
-			let queryKey = ":" . key . ":";
+		if !count(values) {
+			this->andWhere(expr . " != " . expr);
+			return this;
+		}
 
-			let bindKeys[] = queryKey, bindParams[key] = value;
+		let hiddenParam = this->_hiddenParamNumber;
 
-			let hiddenParam++;
-		}
+		let key = "ACP" . hiddenParam . "_";
 
 		/**
 		 * Create a standard IN condition with bind params
 		 * Append the IN to the current conditions using and "and"
 		 */
-		this->andWhere(expr . " IN (" . join(", ", bindKeys) . ")", bindParams);
+		this->andWhere(expr . " IN ({" . key . ":array})", [key: array_values(values)]);
 
-		let this->_hiddenParamNumber = hiddenParam;
+		let this->_hiddenParamNumber = hiddenParam + 1;
 
 		return this;
 	}
@@ -476,32 +468,28 @@ class Criteria implements CriteriaInterface, InjectionAwareInterface
 	 *<code>
 	 *	$criteria->notInWhere('id', [1, 2, 3]);
 	 *</code>
+	 *
+	 * @see \Phalcon\Mvc\Model\Query\Builder::inWhere()
 	 */
 	public function notInWhere(string! expr, array! values) -> <Criteria>
 	{
-		var hiddenParam, bindParams, bindKeys, value, key;
-
-		let hiddenParam = this->_hiddenParamNumber;
+		var hiddenParam, key;
 
-		let bindParams = [], bindKeys = [];
-		for value in values {
+		if !count(values) {
+			this->andWhere(expr . " != " . expr);
+			return this;
+		}
 
-			/**
-			 * Key with auto bind-params
-			 */
-			let key = "ACP" . hiddenParam,
-				bindKeys[] = ":" . key . ":",
-				bindParams[key] = value;
+		let hiddenParam = this->_hiddenParamNumber;
 
-			let hiddenParam++;
-		}
+		let key = "ACP" . hiddenParam . "_";
 
 		/**
-		 * Create a standard IN condition with bind params
-		 * Append the IN to the current conditions using and "and"
+		 * Create a standard NOT IN condition with bind params
+		 * Append the NOT IN to the current conditions using and "and"
 		 */
-		this->andWhere(expr . " NOT IN (" . join(", ", bindKeys) . ")", bindParams);
-		let this->_hiddenParamNumber = hiddenParam;
+		this->andWhere(expr . " NOT IN ({" . key . ":array})", [key: array_values(values)]);
+		let this->_hiddenParamNumber = hiddenParam + 1;
 
 		return this;
 	}
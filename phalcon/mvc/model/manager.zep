@@ -19,6 +19,7 @@
 
 namespace Phalcon\Mvc\Model;
 
+use Phalcon\Di;
 use Phalcon\DiInterface;
 use Phalcon\Mvc\Model\Relation;
 use Phalcon\Mvc\Model\RelationInterface;
@@ -68,6 +69,31 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
 	protected _writeConnectionServices;
 
+	/**
+	 * Weighted read connection services per model
+	 */
+	protected _readConnectionPools;
+
+	/**
+	 * Read connection service chosen for each model pool
+	 */
+	protected _selectedReadServices;
+
+	/**
+	 * Write connection services that received writes, reads are pinned to them
+	 */
+	protected _stickyWriteServices;
+
+	/**
+	 * Time when a connection service failed to connect
+	 */
+	protected _failedConnectionServices;
+
+	/**
+	 * Seconds a failed connection service is skipped
+	 */
+	protected _failoverCooldown = 30;
+
 	protected _aliases;
 
 	/**
@@ -148,6 +174,11 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
 	protected _namespaceAliases;
 
+	/**
+	 * Cache service storing the automatic query cache and the version tags of the models
+	 */
+	protected _queryCacheService;
+
 	/**
 	 * Sets the DependencyInjector container
 	 */
@@ -374,11 +405,72 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		let this->_readConnectionServices[get_class_lower(model)] = connectionService;
 	}
 
+	/**
+	 * Sets a pool of weighted read connection services for a model. Reads are spread over the
+	 * pool, skipping services that failed to connect, and pinned to the write connection after
+	 * a record of the model was written or while it is under a transaction.
+	 * Use "persistent" in the descriptors of the replicas to reuse their connections between requests
+	 *
+	 *<code>
+	 * $this->getModelsManager()->setReadConnectionPool($this, array(
+	 *     "dbReplica1" => 3,
+	 *     "dbReplica2" => 1
+	 * ));
+	 *</code>
+	 */
+	public function setReadConnectionPool(<ModelInterface> model, array! connectionServices) -> void
+	{
+		var pool, service, weight;
+
+		let pool = [];
+		for service, weight in connectionServices {
+			if typeof service == "integer" {
+				let pool[weight] = 1;
+			} else {
+				if weight > 0 {
+					let pool[service] = (int) weight;
+				}
+			}
+		}
+
+		if !count(pool) {
+			throw new Exception("The read connection pool must contain at least one connection service");
+		}
+
+		let this->_readConnectionPools[get_class_lower(model)] = pool;
+	}
+
+	/**
+	 * Sets the number of seconds a connection service that failed to connect is skipped by the read connection pools
+	 */
+	public function setFailoverCooldown(int cooldown) -> void
+	{
+		let this->_failoverCooldown = cooldown;
+	}
+
+	/**
+	 * Forgets the read connections chosen and the write connections that received writes.
+	 * The applications call it when they start handling a request
+	 */
+	public function clearConnectionRouting() -> void
+	{
+		let this->_selectedReadServices = [],
+			this->_stickyWriteServices = [];
+	}
+
 	/**
 	 * Returns the connection to read data related to a model
 	 */
 	public function getReadConnection(<ModelInterface> model) -> <AdapterInterface>
 	{
+		var pool;
+
+		if typeof this->_readConnectionPools == "array" {
+			if fetch pool, this->_readConnectionPools[get_class_lower(model)] {
+				return this->_getPooledReadConnection(model, pool);
+			}
+		}
+
 		return this->_getConnection(model, this->_readConnectionServices);
 	}
 
@@ -390,6 +482,114 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		return this->_getConnection(model, this->_writeConnectionServices);
 	}
 
+	/**
+	 * Registers that a record of the model was written, reads of the models sharing its
+	 * write connection are pinned to it until the connection routing is cleared
+	 */
+	public function registerWrite(<ModelInterface> model) -> void
+	{
+		if typeof this->_readConnectionPools == "array" {
+			let this->_stickyWriteServices[this->_getConnectionService(model, this->_writeConnectionServices)] = true;
+		}
+	}
+
+	/**
+	 * Returns a read connection from the pool of a model, falling back to the write connection
+	 * if the model received writes, is under a transaction or every service in the pool is failing
+	 */
+	protected function _getPooledReadConnection(<ModelInterface> model, array! pool) -> <AdapterInterface>
+	{
+		var entityName, writeService, writeConnection, dependencyInjector, di, service,
+			connection, candidates, weight, failedTime, e, resolved;
+		int now, total, position;
+
+		let writeService = this->_getConnectionService(model, this->_writeConnectionServices);
+		if isset this->_stickyWriteServices[writeService] {
+			return this->_getConnection(model, this->_writeConnectionServices);
+		}
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+
+		/**
+		 * Only a write connection already resolved can be under a transaction, checking it must not connect to the primary
+		 */
+		let resolved = true;
+		if typeof dependencyInjector == "object" {
+			if dependencyInjector instanceof Di {
+				let di = <Di> dependencyInjector,
+					resolved = di->hasSharedInstance(writeService);
+			}
+		}
+
+		if resolved {
+			let writeConnection = this->_getConnection(model, this->_writeConnectionServices);
+			if writeConnection->isUnderTransaction() {
+				return writeConnection;
+			}
+		}
+
+		/**
+		 * Reads are pinned to the same replica during the request
+		 */
+		let entityName = get_class_lower(model);
+		if fetch service, this->_selectedReadServices[entityName] {
+			return dependencyInjector->getShared(service);
+		}
+
+		/**
+		 * Skip the services that failed recently
+		 */
+		let now = time(),
+			candidates = [],
+			total = 0;
+		for service, weight in pool {
+			if fetch failedTime, this->_failedConnectionServices[service] {
+				if now - failedTime < this->_failoverCooldown {
+					continue;
+				}
+			}
+			let candidates[service] = weight,
+				total += weight;
+		}
+
+		while total > 0 {
+
+			/**
+			 * Choose a service according to the weights
+			 */
+			let position = mt_rand(1, total);
+			for service, weight in candidates {
+				let position -= weight;
+				if position <= 0 {
+					break;
+				}
+			}
+
+			try {
+				let connection = dependencyInjector->getShared(service);
+			} catch \Exception, e {
+				let this->_failedConnectionServices[service] = now,
+					connection = null;
+			}
+
+			if typeof connection == "object" {
+				if isset this->_failedConnectionServices[service] {
+					unset this->_failedConnectionServices[service];
+				}
+				let this->_selectedReadServices[entityName] = service;
+				return connection;
+			}
+
+			/**
+			 * Fail over to the remaining services
+			 */
+			let total -= candidates[service];
+			unset candidates[service];
+		}
+
+		return this->_getConnection(model, this->_writeConnectionServices);
+	}
+
 	/**
 	 * Returns the connection to read or write data related to a model depending on the connection services.
 	 */
@@ -1739,4 +1939,87 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 	{
 		return this->_namespaceAliases;
 	}
+
+	/**
+	 * Sets the cache service used by queries with automatic caching. Saving or deleting a record
+	 * bumps the version tag of its model in this service so cached resultsets using it are not served again
+	 *
+	 *<code>
+	 * $modelsManager->setQueryCacheService('modelsCache');
+	 *
+	 * $robots = Robots::find(array(
+	 *     "type = 'mechanical'",
+	 *     "cache" => array("auto" => true, "lifetime" => 300)
+	 * ));
+	 *</code>
+	 */
+	public function setQueryCacheService(string! cacheService) -> void
+	{
+		let this->_queryCacheService = cacheService;
+	}
+
+	/**
+	 * Returns the cache service used by queries with automatic caching
+	 */
+	public function getQueryCacheService() -> string | null
+	{
+		return this->_queryCacheService;
+	}
+
+	/**
+	 * Returns the cache backend used by queries with automatic caching
+	 */
+	public function getQueryCache() -> <\Phalcon\Cache\BackendInterface>
+	{
+		var cacheService, dependencyInjector, cache;
+
+		let cacheService = this->_queryCacheService;
+		if cacheService === null {
+			throw new Exception("A query cache service must be set in the models manager to use automatic caching");
+		}
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injector container is required to obtain the services related to the ORM");
+		}
+
+		let cache = dependencyInjector->getShared(cacheService);
+		if typeof cache != "object" {
+			throw new Exception("Cache service must be an object");
+		}
+
+		return cache;
+	}
+
+	/**
+	 * Returns the version tag of a model in the query cache, a new tag is stored if there is none
+	 */
+	public function getModelVersion(string! modelName) -> string
+	{
+		var cache, key, version;
+
+		let cache = this->getQueryCache(),
+			key = "phql_version_" . str_replace("\\", "_", strtolower(modelName)),
+			version = cache->get(key);
+
+		if typeof version != "string" {
+			let version = uniqid("", true);
+			cache->save(key, version);
+		}
+
+		return version;
+	}
+
+	/**
+	 * Replaces the version tag of a model in the query cache invalidating every cached resultset
+	 * that reads from it. Does nothing if automatic caching isn't enabled
+	 */
+	public function bumpModelVersion(string! modelName) -> void
+	{
+		if this->_queryCacheService === null {
+			return;
+		}
+
+		this->getQueryCache()->save("phql_version_" . str_replace("\\", "_", strtolower(modelName)), uniqid("", true));
+	}
 }
@@ -20,6 +20,7 @@
 
 namespace Phalcon\Mvc\Model;
 
+use Phalcon\Db;
 use Phalcon\Db\Column;
 use Phalcon\Db\RawValue;
 use Phalcon\DiInterface;
@@ -104,6 +105,18 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 	static protected _irPhqlCache;
 
+	static protected _sqlCache;
+
+	static protected _sqlCacheStats;
+
+	static protected _sqlCacheLimit = 1024;
+
+	protected _irId;
+
+	protected _autoCacheEntry;
+
+	protected _dependencies;
+
 	const TYPE_SELECT = 309;
 
 	const TYPE_INSERT = 306;
@@ -1700,7 +1713,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			groupBy, order, limit, tempModels, tempModelsInstances, tempSqlAliases,
 			tempSqlModelsAliases, tempSqlAliasesModelsInstances, tempSqlAliasesModels,
 			with, withs, withItem, automaticJoins, number, relation, joinAlias,
-			relationModel, bestAlias, eagerType;
+			relationModel, bestAlias, eagerType, dependency;
 
 		if empty ast {
 			let ast = this->_ast;
@@ -2044,6 +2057,13 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let sqlSelect["forUpdate"] = true;
 		}
 
+		/**
+		 * Remember every model read by the statement, including joins and subqueries
+		 */
+		for dependency in this->_sqlAliasesModels {
+			let this->_dependencies[dependency] = true;
+		}
+
 		if merge {
 			let this->_models = tempModels,
 				this->_modelsInstances = tempModelsInstances,
@@ -2424,7 +2444,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 				if fetch irPhql, self::_irPhqlCache[uniqueId] {
 					if typeof irPhql == "array" {
 						//Assign the type to the query
-						let this->_type = ast["type"];
+						let this->_type = ast["type"],
+							this->_irId = uniqueId;
 						return irPhql;
 					}
 				}
@@ -2466,11 +2487,19 @@ class Query implements QueryInterface, InjectionAwareInterface
 			throw new Exception("Corrupted AST");
 		}
 
+		/**
+		 * Keep the models read by a SELECT, including joins and subqueries, to tag cached resultsets
+		 */
+		if this->_type == PHQL_T_SELECT && typeof this->_dependencies == "array" {
+			let irPhql["dependencies"] = array_keys(this->_dependencies);
+		}
+
 		/**
 		 * Store the prepared AST in the cache
 		 */
 		if typeof uniqueId == "int" {
-			let self::_irPhqlCache[uniqueId] = irPhql;
+			let self::_irPhqlCache[uniqueId] = irPhql,
+				this->_irId = uniqueId;
 		}
 
 		let this->_intermediate = irPhql;
@@ -2488,7 +2517,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 	/**
 	 * Executes the SELECT intermediate representation producing a Phalcon\Mvc\Model\Resultset
 	 */
-	protected final function _executeSelect(var intermediate, var bindParams, var bindTypes, boolean simulate = false) -> <ResultsetInterface> | array
+	protected final function _executeSelect(var intermediate, var bindParams, var bindTypes, boolean simulate = false, var rows = null) -> <ResultsetInterface> | array
 	{
 
 		var manager, modelName, models, model, connection, connectionTypes,
@@ -2496,7 +2525,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 			sqlColumn, attributes, instance, columnMap, attribute,
 			columnAlias, sqlAlias, dialect, sqlSelect, bindCounts,
 			processed, wildcard, value, processedTypes, typeWildcard, result,
-			resultData, cache, resultObject, columns1, typesColumnMap, wildcardValue;
+			resultData, cache, resultObject, columns1, typesColumnMap, wildcardValue,
+			irId, sqlCacheKey, plan, planColumns;
 		boolean haveObjects, haveScalars, isComplex, isSimpleStd, isKeepingSnapshots;
 		int numberObjects;
 
@@ -2534,184 +2564,325 @@ class Query implements QueryInterface, InjectionAwareInterface
 			}
 		}
 
-		let columns = intermediate["columns"];
+		let dialect = connection->getDialect();
 
-		let haveObjects = false,
-			haveScalars = false,
-			isComplex = false;
+		/**
+		 * Statements coming from the same prepared IR generate the same SQL for a given dialect
+		 * and number of elements in every array placeholder
+		 */
+		let irId = this->_irId, sqlCacheKey = null;
+		if irId !== null {
+			let sqlCacheKey = irId . ":" . get_class(dialect);
+			if this->_sharedLock {
+				let sqlCacheKey .= ":l";
+			}
+			if globals_get("orm.column_renaming") {
+				let sqlCacheKey .= ":r";
+			}
+			if globals_get("orm.cast_on_hydrate") {
+				let sqlCacheKey .= ":c";
+			}
+		}
 
-		// Check if the resultset have objects and how many of them have
-		let numberObjects = 0;
-		let columns1 = columns;
+		let bindCounts = [];
 
-		for column in columns {
+		/**
+		 * Replace the placeholders
+		 */
+		if typeof bindParams == "array" {
+			let processed = [];
+			for wildcard, value in bindParams {
 
-			if typeof column != "array" {
-				throw new Exception("Invalid column definition");
-			}
+				if typeof wildcard == "integer" {
+					let wildcardValue = ":" . wildcard;
+				} else {
+					let wildcardValue = wildcard;
+				}
 
-			if column["type"] == "scalar" {
-				if !isset column["balias"] {
-					let isComplex = true;
+				let processed[wildcardValue] = value;
+				if typeof value == "array" {
+					let bindCounts[wildcardValue] = count(value);
+					if sqlCacheKey !== null {
+						let sqlCacheKey .= ":" . wildcardValue . "=" . bindCounts[wildcardValue];
+					}
 				}
-				let haveScalars = true;
-			} else {
-				let haveObjects = true, numberObjects++;
 			}
+		} else {
+			let processed = bindParams;
 		}
 
-		// Check if the resultset to return is complex or simple
-		if isComplex === false {
-			if haveObjects === true {
-				if haveScalars === true {
-					let isComplex = true;
+		/**
+		 * Replace the bind Types
+		 */
+		if typeof bindTypes == "array" {
+			let processedTypes = [];
+			for typeWildcard, value in bindTypes {
+				if typeof typeWildcard == "integer" {
+					let processedTypes[":" . typeWildcard] = value;
 				} else {
-					if numberObjects == 1 {
-						let isSimpleStd = false;
-					} else {
-						let isComplex = true;
-					}
+					let processedTypes[typeWildcard] = value;
 				}
-			} else {
-				let isSimpleStd = true;
 			}
+		} else {
+			let processedTypes = bindTypes;
 		}
 
-		// Processing selected columns
-		let instance = null,
-			selectColumns = [],
-			simpleColumnMap = [],
+		let plan = null,
 			metaData = this->_metaData;
 
-		for aliasCopy, column in columns {
+		if sqlCacheKey !== null {
+			let plan = self::_getSqlCache(sqlCacheKey);
+		}
 
-			let sqlColumn = column["column"];
+		if typeof plan == "array" {
 
-			// Complete objects are treated in a different way
-			if column["type"] == "object" {
+			/**
+			 * The SQL and the hydration plan are already known, only the base instances must be resolved
+			 */
+			let sqlSelect = plan["sql"],
+				isComplex = plan["isComplex"],
+				isSimpleStd = plan["isSimpleStd"],
+				isKeepingSnapshots = plan["keepSnapshots"],
+				simpleColumnMap = plan["simpleColumnMap"],
+				columns1 = plan["columns"],
+				resultObject = null;
+
+			if isComplex === true {
+				let planColumns = plan["columns"];
+				for aliasCopy, column in planColumns {
+					if fetch modelName, column["instanceModel"] {
+						if !fetch instance, this->_modelsInstances[modelName] {
+							let instance = manager->load(modelName),
+								this->_modelsInstances[modelName] = instance;
+						}
+						let columns1[aliasCopy]["instance"] = instance;
+					}
+				}
+			} else {
+				if isSimpleStd === false {
+					let modelName = plan["model"];
+					if !fetch resultObject, this->_modelsInstances[modelName] {
+						let resultObject = manager->load(modelName),
+							this->_modelsInstances[modelName] = resultObject;
+					}
+				}
+			}
 
-				let modelName = column["model"];
+		} else {
 
-				/**
-				 * Base instance
-				 */
-				if !fetch instance, this->_modelsInstances[modelName] {
-					let instance = manager->load(modelName),
-						this->_modelsInstances[modelName] = instance;
+			let columns = intermediate["columns"];
+
+			let haveObjects = false,
+				haveScalars = false,
+				isComplex = false;
+
+			// Check if the resultset have objects and how many of them have
+			let numberObjects = 0;
+			let columns1 = columns;
+
+			for column in columns {
+
+				if typeof column != "array" {
+					throw new Exception("Invalid column definition");
 				}
 
-				let attributes = metaData->getAttributes(instance);
-				if isComplex === true {
+				if column["type"] == "scalar" {
+					if !isset column["balias"] {
+						let isComplex = true;
+					}
+					let haveScalars = true;
+				} else {
+					let haveObjects = true, numberObjects++;
+				}
+			}
 
-					// If the resultset is complex we open every model into their columns
-					if globals_get("orm.column_renaming") {
-						let columnMap = metaData->getColumnMap(instance);
+			// Check if the resultset to return is complex or simple
+			if isComplex === false {
+				if haveObjects === true {
+					if haveScalars === true {
+						let isComplex = true;
 					} else {
-						let columnMap = null;
+						if numberObjects == 1 {
+							let isSimpleStd = false;
+						} else {
+							let isComplex = true;
+						}
 					}
+				} else {
+					let isSimpleStd = true;
+				}
+			}
 
-					// Add every attribute in the model to the generated select
-					for attribute in attributes {
-						let selectColumns[] = [attribute, sqlColumn, "_" . sqlColumn . "_" . attribute];
-					}
+			// Processing selected columns
+			let instance = null,
+				selectColumns = [],
+				simpleColumnMap = [],
+				planColumns = columns;
+
+			for aliasCopy, column in columns {
+
+				let sqlColumn = column["column"];
 
-					// We cache required meta-data to make its future access faster
-					let columns1[aliasCopy]["instance"] = instance,
-						columns1[aliasCopy]["attributes"] = attributes,
-						columns1[aliasCopy]["columnMap"] = columnMap;
+				// Complete objects are treated in a different way
+				if column["type"] == "object" {
 
-					// Check if the model keeps snapshots
-					let isKeepingSnapshots = (boolean) manager->isKeepingSnapshots(instance);
-					if isKeepingSnapshots {
-						let columns1[aliasCopy]["keepSnapshots"] = isKeepingSnapshots;
+					let modelName = column["model"];
+
+					/**
+					 * Base instance
+					 */
+					if !fetch instance, this->_modelsInstances[modelName] {
+						let instance = manager->load(modelName),
+							this->_modelsInstances[modelName] = instance;
 					}
 
+					let attributes = metaData->getAttributes(instance);
+					if isComplex === true {
+
+						// If the resultset is complex we open every model into their columns
+						if globals_get("orm.column_renaming") {
+							let columnMap = metaData->getColumnMap(instance);
+						} else {
+							let columnMap = null;
+						}
+
+						// Add every attribute in the model to the generated select
+						for attribute in attributes {
+							let selectColumns[] = [attribute, sqlColumn, "_" . sqlColumn . "_" . attribute];
+						}
+
+						// We cache required meta-data to make its future access faster
+						let columns1[aliasCopy]["instance"] = instance,
+							columns1[aliasCopy]["attributes"] = attributes,
+							columns1[aliasCopy]["columnMap"] = columnMap;
+
+						// Cached plans keep the model name instead of the base instance
+						let planColumns[aliasCopy]["instanceModel"] = modelName,
+							planColumns[aliasCopy]["attributes"] = attributes,
+							planColumns[aliasCopy]["columnMap"] = columnMap;
+
+						// Check if the model keeps snapshots
+						let isKeepingSnapshots = (boolean) manager->isKeepingSnapshots(instance);
+						if isKeepingSnapshots {
+							let columns1[aliasCopy]["keepSnapshots"] = isKeepingSnapshots,
+								planColumns[aliasCopy]["keepSnapshots"] = isKeepingSnapshots;
+						}
+
+					} else {
+
+						/**
+						 * Query only the columns that are registered as attributes in the metaData
+						 */
+						for attribute in attributes {
+							let selectColumns[] = [attribute, sqlColumn];
+						}
+					}
 				} else {
 
 					/**
-					 * Query only the columns that are registered as attributes in the metaData
+					 * Create an alias if the column doesn't have one
 					 */
-					for attribute in attributes {
-						let selectColumns[] = [attribute, sqlColumn];
+					if typeof aliasCopy == "int" {
+						let columnAlias = [sqlColumn, null];
+					} else {
+						let columnAlias = [sqlColumn, null, aliasCopy];
 					}
+					let selectColumns[] = columnAlias;
 				}
-			} else {
 
 				/**
-				 * Create an alias if the column doesn't have one
+				 * Simulate a column map
 				 */
-				if typeof aliasCopy == "int" {
-					let columnAlias = [sqlColumn, null];
-				} else {
-					let columnAlias = [sqlColumn, null, aliasCopy];
+				if isComplex === false && isSimpleStd === true {
+					if fetch sqlAlias, column["sqlAlias"] {
+						let simpleColumnMap[sqlAlias] = aliasCopy;
+					} else {
+						let simpleColumnMap[aliasCopy] = aliasCopy;
+					}
 				}
-				let selectColumns[] = columnAlias;
+			}
+
+			let intermediate["columns"] = selectColumns;
+
+			if count(bindCounts) {
+				let intermediate["bindCounts"] = bindCounts;
 			}
 
 			/**
-			 * Simulate a column map
+			 * The corresponding SQL dialect generates the SQL statement based accordingly with the database system
 			 */
-			if isComplex === false && isSimpleStd === true {
-				if fetch sqlAlias, column["sqlAlias"] {
-					let simpleColumnMap[sqlAlias] = aliasCopy;
-				} else {
-					let simpleColumnMap[aliasCopy] = aliasCopy;
-				}
+			let sqlSelect = dialect->select(intermediate);
+			if this->_sharedLock {
+				let sqlSelect = dialect->sharedLock(sqlSelect);
 			}
-		}
 
-		let bindCounts = [],
-			intermediate["columns"] = selectColumns;
+			/**
+			 * Choose the base object and the column map of simple resultsets
+			 */
+			let resultObject = null;
+			if isComplex === false {
 
-		/**
-		 * Replace the placeholders
-		 */
-		if typeof bindParams == "array" {
-			let processed = [];
-			for wildcard, value in bindParams {
+				if isSimpleStd === true {
+
+					/**
+					 * Standard objects can't keep snapshots
+					 */
+					let isKeepingSnapshots = false;
 
-				if typeof wildcard == "integer" {
-					let wildcardValue = ":" . wildcard;
 				} else {
-					let wildcardValue = wildcard;
-				}
 
-				let processed[wildcardValue] = value;
-				if typeof value == "array" {
-					let bindCounts[wildcardValue] = count(value);
+					if typeof instance == "object" {
+						let resultObject = instance;
+					} else {
+						let resultObject = model;
+					}
+
+					/**
+					 * Get the column map
+					 */
+					if !globals_get("orm.cast_on_hydrate") {
+						let simpleColumnMap = metaData->getColumnMap(model);
+					} else {
+
+						let columnMap = metaData->getColumnMap(model),
+							typesColumnMap = metaData->getDataTypes(model);
+
+						if typeof columnMap === "null" {
+							let simpleColumnMap = [];
+							for attribute in metaData->getAttributes(model) {
+								let simpleColumnMap[attribute] = [attribute, typesColumnMap[attribute]];
+							}
+						} else {
+							let simpleColumnMap = [];
+							for column, attribute in columnMap {
+								let simpleColumnMap[column] = [attribute, typesColumnMap[column]];
+							}
+						}
+					}
+
+					/**
+					 * Check if the model keeps snapshots
+					 */
+					let isKeepingSnapshots = (boolean) manager->isKeepingSnapshots(model);
 				}
 			}
-		} else {
-			let processed = bindParams;
-		}
 
-		/**
-		 * Replace the bind Types
-		 */
-		if typeof bindTypes == "array" {
-			let processedTypes = [];
-			for typeWildcard, value in bindTypes {
-				if typeof typeWildcard == "integer" {
-					let processedTypes[":" . typeWildcard] = value;
+			if sqlCacheKey !== null {
+				if typeof resultObject == "object" {
+					let modelName = get_class(resultObject);
 				} else {
-					let processedTypes[typeWildcard] = value;
+					let modelName = null;
 				}
+				self::_setSqlCache(sqlCacheKey, [
+					"sql"             : sqlSelect,
+					"isComplex"       : isComplex,
+					"isSimpleStd"     : isSimpleStd,
+					"keepSnapshots"   : isKeepingSnapshots,
+					"simpleColumnMap" : simpleColumnMap,
+					"columns"         : planColumns,
+					"model"           : modelName
+				]);
 			}
-		} else {
-			let processedTypes = bindTypes;
-		}
-
-		if count(bindCounts) {
-			let intermediate["bindCounts"] = bindCounts;
-		}
-
-		/**
-		 * The corresponding SQL dialect generates the SQL statement based accordingly with the database system
-		 */
-		let dialect = connection->getDialect(),
-			sqlSelect = dialect->select(intermediate);
-		if this->_sharedLock {
-			let sqlSelect = dialect->sharedLock(sqlSelect);
 		}
 
 		/**
@@ -2725,76 +2896,67 @@ class Query implements QueryInterface, InjectionAwareInterface
 			];
 		}
 
-		/**
-		 * Execute the query
-		 */
-		let result = connection->query(sqlSelect, processed, processedTypes);
+		if typeof rows == "array" {
 
-		/**
-		 * Check if the query has data
-		 */
-		if result->numRows(result) {
-			let resultData = result;
-		} else {
-			let resultData = false;
-		}
+			/**
+			 * Rows restored from the automatic cache are hydrated without executing the query
+			 */
+			let resultData = rows;
 
-		/**
-		 * Choose a resultset type
-		 */
-		let cache = this->_cache;
-		if isComplex === false {
+		} else {
 
 			/**
-			 * Select the base object
+			 * Execute the query
 			 */
-			if isSimpleStd === true {
+			let result = connection->query(sqlSelect, processed, processedTypes);
 
-				/**
-				 * If the result is a simple standard object use an Phalcon\Mvc\Model\Row as base
-				 */
-				let resultObject = new Row();
+			if rows === true {
 
 				/**
-				 * Standard objects can't keep snapshots
+				 * The automatic cache stores the plain rows, so all of them are fetched at once
 				 */
-				let isKeepingSnapshots = false;
+				result->setFetchMode(Db::FETCH_ASSOC);
+				let resultData = result->fetchAll();
 
 			} else {
 
-				if typeof instance == "object" {
-					let resultObject = instance;
-				} else {
-					let resultObject = model;
-				}
-
 				/**
-				 * Get the column map
+				 * Check if the query has data
 				 */
-				if !globals_get("orm.cast_on_hydrate") {
-					let simpleColumnMap = metaData->getColumnMap(model);
+				if result->numRows(result) {
+					let resultData = result;
 				} else {
+					let resultData = false;
+				}
+			}
+		}
 
-					let columnMap = metaData->getColumnMap(model),
-						typesColumnMap = metaData->getDataTypes(model);
+		/**
+		 * Choose a resultset type
+		 */
+		let cache = this->_cache;
+		if isComplex === false {
 
-					if typeof columnMap === "null" {
-						let simpleColumnMap = [];
-						for attribute in metaData->getAttributes(model) {
-							let simpleColumnMap[attribute] = [attribute, typesColumnMap[attribute]];
-						}
-					} else {
-						let simpleColumnMap = [];
-						for column, attribute in columnMap {
-							let simpleColumnMap[column] = [attribute, typesColumnMap[column]];
-						}
-					}
-				}
+			/**
+			 * If the result is a simple standard object use an Phalcon\Mvc\Model\Row as base
+			 */
+			if isSimpleStd === true {
+				let resultObject = new Row();
+			}
 
-				/**
-				 * Check if the model keeps snapshots
-				 */
-				let isKeepingSnapshots = (boolean) manager->isKeepingSnapshots(model);
+			/**
+			 * Simple resultsets can be restored from the cache without generating the SQL again
+			 */
+			if rows === true {
+				if isSimpleStd === true {
+					let modelName = null;
+				} else {
+					let modelName = get_class(resultObject);
+				}
+				let this->_autoCacheEntry = [
+					"rows": resultData,
+					"simple": [modelName, simpleColumnMap, isKeepingSnapshots]
+				];
 			}
 
 			/**
@@ -2803,12 +2965,103 @@ class Query implements QueryInterface, InjectionAwareInterface
 			return new Simple(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots);
 		}
 
+		if rows === true {
+			let this->_autoCacheEntry = ["rows": resultData, "simple": null];
+		}
+
 		/**
 		 * Complex resultsets may contain complete objects and scalars
 		 */
 		return new Complex(columns1, resultData, cache);
 	}
 
+	/**
+	 * Returns the SQL and hydration plan stored for a prepared statement
+	 *
+	 * @param string key
+	 * @return array|null
+	 */
+	protected static function _getSqlCache(string! key)
+	{
+		var plan, stats;
+
+		let stats = self::_sqlCacheStats;
+		if typeof stats != "array" {
+			let stats = ["hits": 0, "misses": 0, "evictions": 0];
+		}
+
+		if fetch plan, self::_sqlCache[key] {
+			let stats["hits"] = stats["hits"] + 1,
+				self::_sqlCacheStats = stats;
+			return plan;
+		}
+
+		let stats["misses"] = stats["misses"] + 1,
+			self::_sqlCacheStats = stats;
+		return null;
+	}
+
+	/**
+	 * Stores the SQL and hydration plan of a prepared statement evicting the oldest entry if the cache is full
+	 *
+	 * @param string key
+	 * @param array plan
+	 */
+	protected static function _setSqlCache(string! key, array! plan) -> void
+	{
+		var sqlCache, stats;
+
+		let sqlCache = self::_sqlCache,
+			stats = self::_sqlCacheStats;
+
+		if typeof sqlCache != "array" {
+			let sqlCache = [];
+		}
+
+		if typeof stats != "array" {
+			let stats = ["hits": 0, "misses": 0, "evictions": 0];
+		}
+
+		if count(sqlCache) >= self::_sqlCacheLimit {
+			array_shift(sqlCache);
+			let stats["evictions"] = stats["evictions"] + 1;
+		}
+
+		let sqlCache[key] = plan,
+			self::_sqlCache = sqlCache,
+			self::_sqlCacheStats = stats;
+	}
+
+	/**
+	 * Returns the hits, misses, evictions and number of entries of the shared SQL cache
+	 */
+	public static function getSqlCacheStats() -> array
+	{
+		var stats;
+
+		let stats = self::_sqlCacheStats;
+		if typeof stats != "array" {
+			let stats = ["hits": 0, "misses": 0, "evictions": 0];
+		}
+
+		if typeof self::_sqlCache == "array" {
+			let stats["entries"] = count(self::_sqlCache);
+		} else {
+			let stats["entries"] = 0;
+		}
+
+		return stats;
+	}
+
+	/**
+	 * Removes every generated SQL statement and resets the statistics of the shared SQL cache
+	 */
+	public static function resetSqlCache() -> void
+	{
+		let self::_sqlCache = [],
+			self::_sqlCacheStats = ["hits": 0, "misses": 0, "evictions": 0];
+	}
+
 	/**
 	 * Executes the INSERT intermediate representation producing a Phalcon\Mvc\Model\Query\Status
 	 *
@@ -3229,6 +3482,13 @@ class Query implements QueryInterface, InjectionAwareInterface
 		query->setType(PHQL_T_SELECT);
 		query->setIntermediate(selectIr);
 
+		/**
+		 * The SELECT is derived from the prepared UPDATE/DELETE so its SQL can be cached too
+		 */
+		if this->_irId !== null {
+			let query->_irId = "related-" . this->_irId;
+		}
+
 		return query->execute(bindParams, bindTypes);
 	}
 
@@ -3244,11 +3504,19 @@ class Query implements QueryInterface, InjectionAwareInterface
 		var uniqueRow, cacheOptions, key, cacheService,
 			cache, result, preparedResult, defaultBindParams, mergedParams,
 			defaultBindTypes, mergedTypes, type, lifetime, intermediate;
+		boolean autoCache = false;
 
 		let uniqueRow = this->_uniqueRow;
 
+		/**
+		 * The automatic cache derives the key from the statement once it's parsed
+		 */
 		let cacheOptions = this->_cacheOptions;
-		if typeof cacheOptions != "null" {
+		if typeof cacheOptions == "array" && isset cacheOptions["auto"] {
+			let autoCache = (boolean) cacheOptions["auto"];
+		}
+
+		if typeof cacheOptions != "null" && !autoCache {
 
 			if typeof cacheOptions != "array" {
 				throw new Exception("Invalid caching options");
@@ -3345,6 +3613,14 @@ class Query implements QueryInterface, InjectionAwareInterface
 			throw new Exception("Bound parameter types must be an array");
 		}
 
+		if autoCache {
+			let result = this->_executeAutoCached(intermediate, mergedParams, mergedTypes, cacheOptions);
+			if uniqueRow {
+				return result->getFirst();
+			}
+			return result;
+		}
+
 		let type = this->_type;
 		switch type {
 
@@ -3371,7 +3647,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * We store the resultset in the cache if any
 		 */
-		if cacheOptions !== null {
+		if cacheOptions !== null && !autoCache {
 
 			/**
 			 * Only PHQL SELECTs can be cached
@@ -3395,6 +3671,97 @@ class Query implements QueryInterface, InjectionAwareInterface
 		return preparedResult;
 	}
 
+	/**
+	 * Executes a SELECT using the automatic cache. The key is derived from the statement and its
+	 * parameters and the entries store the plain rows tagged with the versions of the models read,
+	 * entries whose tags don't match the current ones are never served
+	 *
+	 * @param array intermediate
+	 * @param array bindParams
+	 * @param array bindTypes
+	 * @param array cacheOptions
+	 * @return \Phalcon\Mvc\Model\ResultsetInterface
+	 */
+	protected function _executeAutoCached(var intermediate, var bindParams, var bindTypes, array! cacheOptions) -> <ResultsetInterface>
+	{
+		var manager, cache, lifetime, statement, key, dependencies, versions, modelName,
+			entry, simple, resultObject, result;
+
+		if this->_type != PHQL_T_SELECT {
+			throw new Exception("Only PHQL statements that return resultsets can be cached");
+		}
+
+		let manager = <ManagerInterface> this->_manager,
+			cache = manager->getQueryCache();
+
+		if !fetch lifetime, cacheOptions["lifetime"] {
+			let lifetime = 3600;
+		}
+
+		/**
+		 * Statements built from an intermediate representation don't have a PHQL
+		 */
+		let statement = this->_phql;
+		if empty statement {
+			let statement = serialize(intermediate);
+		}
+
+		let key = "phql_" . md5(serialize([
+			statement,
+			bindParams,
+			bindTypes,
+			this->_sharedLock,
+			globals_get("orm.column_renaming")
+		]));
+
+		/**
+		 * Every model read by the statement tags the entry with its current version
+		 */
+		if !fetch dependencies, intermediate["dependencies"] {
+			let dependencies = intermediate["models"];
+		}
+
+		let versions = [];
+		for modelName in dependencies {
+			let versions[modelName] = manager->getModelVersion(modelName);
+		}
+
+		let entry = cache->get(key, lifetime);
+		if typeof entry == "array" && entry["versions"] === versions {
+
+			let simple = entry["simple"];
+			if typeof simple == "array" {
+
+				if simple[0] === null {
+					let resultObject = new Row();
+				} else {
+					let modelName = simple[0];
+					if !fetch resultObject, this->_modelsInstances[modelName] {
+						let resultObject = manager->load(modelName),
+							this->_modelsInstances[modelName] = resultObject;
+					}
+				}
+
+				let result = new Simple(simple[1], resultObject, entry["rows"], null, simple[2]);
+			} else {
+				let result = this->_executeSelect(intermediate, bindParams, bindTypes, false, entry["rows"]);
+			}
+
+			result->setIsFresh(false);
+			return result;
+		}
+
+		let this->_autoCacheEntry = null,
+			result = this->_executeSelect(intermediate, bindParams, bindTypes, false, true),
+			entry = this->_autoCacheEntry,
+			this->_autoCacheEntry = null;
+
+		let entry["versions"] = versions;
+		cache->save(key, entry, lifetime);
+
+		return result;
+	}
+
 	/**
 	 * Executes the query returning the first result
 	 *
@@ -3508,7 +3875,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	public function setIntermediate(array! intermediate) -> <Query>
 	{
-		let this->_intermediate = intermediate;
+		let this->_intermediate = intermediate,
+			this->_irId = null;
 		return this;
 	}
 
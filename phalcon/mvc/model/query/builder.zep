@@ -746,7 +746,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	 */
 	public function inWhere(string! expr, array! values) -> <Builder>
 	{
-		var key, queryKey, value, bindKeys, bindParams;
+		var key, bindParams;
 		int hiddenParam;
 
 		if !count(values) {
@@ -756,26 +756,22 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 
 		let hiddenParam = (int) this->_hiddenParamNumber;
 
-		let bindParams = [], bindKeys = [];
-		for value in values {
-
-			/**
-			 * Key with auto bind-params
-			 */
-			let key = "AP" . hiddenParam,
-				queryKey = ":" . key . ":",
-				bindKeys[] = queryKey,
-				bindParams[key] = value,
-				hiddenParam++;
-		}
+		/**
+		 * The whole list is bound to a single array placeholder so the PHQL
+		 * doesn't change with the number of values. The placeholder is expanded
+		 * appending the position of every value, the suffix keeps the expanded
+		 * names apart from the other hidden params
+		 */
+		let key = "AP" . hiddenParam . "_",
+			bindParams = [key: array_values(values)];
 
 		/**
 		 * Create a standard IN condition with bind params
 		 * Append the IN to the current conditions using and "and"
 		 */
-		this->andWhere(expr . " IN (" . join(", ", bindKeys) . ")", bindParams);
+		this->andWhere(expr . " IN ({" . key . ":array})", bindParams);
 
-		let this->_hiddenParamNumber = hiddenParam;
+		let this->_hiddenParamNumber = hiddenParam + 1;
 
 		return this;
 	}
@@ -786,10 +782,12 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	 *<code>
 	 *	$builder->notInWhere('id', [1, 2, 3]);
 	 *</code>
+	 *
+	 * @see \Phalcon\Mvc\Model\Query\Builder::inWhere()
 	 */
 	public function notInWhere(string! expr, array! values) -> <Builder>
 	{
-		var key, queryKey, value, bindKeys, bindParams;
+		var key, bindParams;
 		int hiddenParam;
 
 		if !count(values) {
@@ -799,26 +797,16 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 
 		let hiddenParam = (int) this->_hiddenParamNumber;
 
-		let bindParams = [], bindKeys = [];
-		for value in values {
-
-			/**
-			 * Key with auto bind-params
-			 */
-			let key = "AP" . hiddenParam,
-				queryKey = ":" . key . ":",
-				bindKeys[] = queryKey,
-				bindParams[key] = value,
-				hiddenParam++;
-		}
+		let key = "AP" . hiddenParam . "_",
+			bindParams = [key: array_values(values)];
 
 		/**
 		 * Create a standard NOT IN condition with bind params
 		 * Append the NOT IN to the current conditions using and "and"
 		 */
-		this->andWhere(expr . " NOT IN (" . join(", ", bindKeys) . ")", bindParams);
+		this->andWhere(expr . " NOT IN ({" . key . ":array})", bindParams);
 
-		let this->_hiddenParamNumber = hiddenParam;
+		let this->_hiddenParamNumber = hiddenParam + 1;
 
 		return this;
 	}
@@ -93,13 +93,25 @@ abstract class Resultset
 	 * Phalcon\Mvc\Model\Resultset constructor
 	 *
 	 * @param array columnTypes
-	 * @param \Phalcon\Db\ResultInterface|false result
+	 * @param \Phalcon\Db\ResultInterface|array|false result
 	 * @param \Phalcon\Cache\BackendInterface cache
 	 */
 	public function __construct(result, <BackendInterface> cache = null)
 	{
 		var rowCount, rows;
 
+		/**
+		 * Rows can be given already fetched, for example when they come from a cache
+		 */
+		if typeof result == "array" {
+			let this->_count = count(result),
+				this->_rows = result;
+			if cache !== null {
+				let this->_cache = cache;
+			}
+			return;
+		}
+
 		/**
 		* 'false' is given as result for empty result-sets
 		*/
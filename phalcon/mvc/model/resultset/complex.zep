@@ -21,7 +21,6 @@ namespace Phalcon\Mvc\Model\Resultset;
 
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\Model\Row;
-use Phalcon\Db\ResultInterface;
 use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Cache\BackendInterface;
@@ -46,10 +45,10 @@ class Complex extends Resultset implements ResultsetInterface
 	 * Phalcon\Mvc\Model\Resultset\Complex constructor
 	 *
 	 * @param array columnTypes
-	 * @param \Phalcon\Db\ResultInterface result
+	 * @param \Phalcon\Db\ResultInterface|array result
 	 * @param \Phalcon\Cache\BackendInterface cache
 	 */
-	public function __construct(var columnTypes, <ResultInterface> result = null, <BackendInterface> cache = null)
+	public function __construct(var columnTypes, var result = null, <BackendInterface> cache = null)
 	{
 		/**
 		 * Column types, tell the resultset how to build the result
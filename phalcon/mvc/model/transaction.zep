@@ -20,7 +20,9 @@
 namespace Phalcon\Mvc\Model;
 
 use Phalcon\DiInterface;
+use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
+use Phalcon\Mvc\Model\Manager as ModelsManager;
 use Phalcon\Mvc\Model\Transaction\Failed as TxFailed;
 use Phalcon\Mvc\Model\Transaction\ManagerInterface;
 use Phalcon\Mvc\Model\TransactionInterface;
@@ -79,6 +81,12 @@ class Transaction implements TransactionInterface
 
 	protected _rollbackRecord;
 
+	protected _pendingSaves;
+
+	protected _pendingDeletes;
+
+	protected _touchedModels;
+
 	/**
 	 * Phalcon\Mvc\Model\Transaction constructor
 	 *
@@ -123,14 +131,30 @@ class Transaction implements TransactionInterface
 	 */
 	public function commit() -> boolean
 	{
-		var manager;
+		var manager, touchedModels, modelName, modelsManager;
 
 		let manager = this->_manager;
 		if typeof manager == "object" {
 			call_user_func_array([manager, "notifyCommit"], [this]);
 		}
 
-		return this->_connection->commit();
+		let touchedModels = this->_touchedModels,
+			this->_touchedModels = null;
+
+		if !this->_connection->commit() {
+			return false;
+		}
+
+		/**
+		 * Resultsets cached while the transaction was open could hold rows not committed yet
+		 */
+		if typeof touchedModels == "array" {
+			for modelName, modelsManager in touchedModels {
+				modelsManager->bumpModelVersion(modelName);
+			}
+		}
+
+		return true;
 	}
 
 	/**
@@ -149,6 +173,8 @@ class Transaction implements TransactionInterface
 			call_user_func_array([manager, "notifyRollback"], [this]);
 		}
 
+		let this->_touchedModels = null;
+
 		let connection = this->_connection;
 		if connection->rollback() {
 			if !rollbackMessage {
@@ -163,6 +189,14 @@ class Transaction implements TransactionInterface
 		return true;
 	}
 
+	/**
+	 * Registers a model whose version in the automatic query cache must be replaced once the transaction is committed
+	 */
+	public function touchModel(<ModelsManager> modelsManager, string! modelName) -> void
+	{
+		let this->_touchedModels[modelName] = modelsManager;
+	}
+
 	/**
 	 * Returns the connection related to transaction
 	 */
@@ -216,6 +250,93 @@ class Transaction implements TransactionInterface
 		return this->_connection->isUnderTransaction();
 	}
 
+	/**
+	 * Schedules a record to be inserted or updated on the next flush()
+	 *
+	 *<code>
+	 *  foreach ($rows as $row) {
+	 *    $robot = new Robots();
+	 *    $robot->assign($row);
+	 *    $transaction->persist($robot);
+	 *  }
+	 *  if (!$transaction->flush()) {
+	 *    $transaction->rollback("Can't save robots");
+	 *  }
+	 *  $transaction->commit();
+	 *</code>
+	 */
+	public function persist(<ModelInterface> record) -> <Transaction>
+	{
+		record->setTransaction(this);
+		let this->_pendingSaves[spl_object_hash(record)] = record;
+		return this;
+	}
+
+	/**
+	 * Schedules a record to be deleted on the next flush()
+	 */
+	public function remove(<ModelInterface> record) -> <Transaction>
+	{
+		var hash;
+
+		let hash = spl_object_hash(record);
+
+		if typeof this->_pendingSaves == "array" {
+			if isset this->_pendingSaves[hash] {
+				unset this->_pendingSaves[hash];
+			}
+		}
+
+		record->setTransaction(this);
+		let this->_pendingDeletes[hash] = record;
+		return this;
+	}
+
+	/**
+	 * Writes the scheduled records in batches, saves are executed before deletions.
+	 * If a record fails its messages are available in getMessages()
+	 */
+	public function flush(int batchSize = 500) -> boolean
+	{
+		var pendingSaves, pendingDeletes, processed, record;
+		boolean success;
+
+		let pendingSaves = this->_pendingSaves,
+			pendingDeletes = this->_pendingDeletes,
+			this->_pendingSaves = null,
+			this->_pendingDeletes = null,
+			this->_messages = [];
+
+		let success = true,
+			processed = [];
+
+		if typeof pendingSaves == "array" && count(pendingSaves) {
+			let processed = pendingSaves,
+				success = Model::saveBatch(array_values(pendingSaves), batchSize);
+		}
+
+		if success && typeof pendingDeletes == "array" && count(pendingDeletes) {
+			let processed = pendingDeletes,
+				success = Model::deleteBatch(array_values(pendingDeletes), batchSize);
+		}
+
+		if !success {
+
+			/**
+			 * Report the messages of the first record that failed
+			 */
+			for record in processed {
+				if count(record->getMessages()) {
+					let this->_messages = record->getMessages(),
+						this->_rollbackRecord = record;
+					break;
+				}
+			}
+		}
+
+		return success;
+	}
+
 	/**
 	 * Sets object which generates rollback action
 	 */
@@ -53,6 +53,8 @@ use Phalcon\Mvc\Model\ValidatorInterface;
  */
 class Uniqueness extends Validator implements ValidatorInterface
 {
+	protected static _batchValues;
+
 	/**
 	 * Executes the validator
 	 */
@@ -60,7 +62,7 @@ class Uniqueness extends Validator implements ValidatorInterface
 	{
 		var field, dependencyInjector, metaData, message, bindTypes, bindDataTypes,
 			columnMap, conditions, bindParams, number, composeField, columnField,
-			bindType, primaryField, attributeField, params, className, replacePairs;
+			bindType, primaryField, attributeField, params, className, replacePairs, isPresent;
 
 		let dependencyInjector = record->getDI();
 		let metaData = dependencyInjector->getShared("modelsMetadata");
@@ -200,10 +202,19 @@ class Uniqueness extends Validator implements ValidatorInterface
 
 		let className = get_class(record);
 
+		/**
+		 * Inside saveBatch() new records are checked against the values of the whole batch
+		 */
+		if typeof field != "array" && record instanceof Model && record->getOperationMade() == Model::OP_CREATE {
+			let isPresent = this->_isPresentInBatch(record, className, field, dependencyInjector);
+		} else {
+			let isPresent = true;
+		}
+
 		/**
 		 * Check if the record does exist using a standard count
 		 */
-		if {className}::count(params) != 0 {
+		if isPresent && {className}::count(params) != 0 {
 
 			/**
 			 * Check if the developer has defined a custom message
@@ -231,4 +242,105 @@ class Uniqueness extends Validator implements ValidatorInterface
 
 		return true;
 	}
+
+	/**
+	 * Fetches the values of a field for all the records of a batch with a single query and checks
+	 * if the value of the record may be already present. The count is only skipped when the value
+	 * was queried and every returned row matches a queried value exactly, otherwise the database
+	 * collation (case, trailing spaces, accents) or a value changed after the prefetch could hide a duplicate
+	 */
+	protected function _isPresentInBatch(<Model> record, string! className, string! field, var dependencyInjector) -> boolean
+	{
+		var batch, batchId, value, values, batchRecord, key, cache, prefetch, queried, chunk,
+			resultset, row, returned, exact;
+
+		let batch = record->getBatchRecords(),
+			batchId = record->getBatchId();
+		if typeof batch != "array" || count(batch) < 2 || batchId === null {
+			return true;
+		}
+
+		let value = record->readAttribute(field);
+		if typeof value != "string" && typeof value != "int" {
+			return true;
+		}
+
+		/**
+		 * The cache only holds the values of the batch being saved
+		 */
+		let key = className . ":" . field,
+			cache = self::_batchValues;
+		if typeof cache != "array" || cache[0] !== batchId {
+			let cache = [batchId, []];
+		}
+
+		if !fetch prefetch, cache[1][key] {
+
+			let values = [];
+			for batchRecord in batch {
+				let values[] = batchRecord->readAttribute(field);
+			}
+
+			let queried = [];
+			for value in array_filter(values, "is_scalar") {
+				let queried[(string) value] = true;
+			}
+
+			let returned = [], exact = true;
+			for chunk in array_chunk(array_map("strval", array_keys(queried)), 1000) {
+
+				let resultset = {className}::find([
+					"[" . field . "] IN ({values:array})",
+					"bind": ["values": chunk],
+					"columns": "[" . field . "]",
+					"di": dependencyInjector
+				]);
+
+				for row in resultset->toArray() {
+					let value = (string) row[field];
+					if !isset queried[value] {
+						let exact = false;
+					}
+					let returned[value] = true;
+				}
+			}
+
+			let prefetch = ["queried": queried, "returned": returned, "exact": exact, "seen": []],
+				cache[1][key] = prefetch,
+				self::_batchValues = cache;
+
+			let value = record->readAttribute(field);
+		}
+
+		/**
+		 * Values changed after the prefetch, values already present in the table and any value
+		 * when the database matched rows differing from the queried values are counted
+		 */
+		let value = (string) value;
+		if !prefetch["exact"] || !isset prefetch["queried"][value] || isset prefetch["returned"][value] {
+			return true;
+		}
+
+		/**
+		 * Following records with the same value must be counted as this one could be inserted before them
+		 */
+		if isset prefetch["seen"][value] {
+			return true;
+		}
+
+		let prefetch["seen"][value] = true,
+			cache[1][key] = prefetch,
+			self::_batchValues = cache;
+
+		return false;
+	}
+
+	/**
+	 * Forgets the values fetched for the batch being saved, Phalcon\Mvc\Model::saveBatch() calls it
+	 * once the batch was validated
+	 */
+	public static function clearBatch() -> void
+	{
+		let self::_batchValues = null;
+	}
 }
@@ -143,6 +143,29 @@ class View extends Injectable implements ViewInterface
 
 	protected _disabled = false;
 
+	protected _streaming = false;
+
+	/**
+	 * Stages queued by a streaming render ([level, viewPath, silence]), the last one is rendered first
+	 */
+	protected _stages;
+
+	protected _streamed = false;
+
+	protected _directOutput = false;
+
+	protected _outputLevel = 0;
+
+	/**
+	 * Resolved view paths shared by every view in the process
+	 * (viewsDirPath + extensions => [extension|false, created])
+	 */
+	protected static _resolvedPaths;
+
+	protected static _resolvedPathsStamp;
+
+	protected static _resolvedPathsStats;
+
 	/**
 	 * Phalcon\Mvc\View constructor
 	 *
@@ -491,7 +514,57 @@ class View extends Injectable implements ViewInterface
 	public function start() -> <View>
 	{
 		ob_start();
-		let this->_content = null;
+		let this->_content = null,
+			this->_stages = null,
+			this->_streamed = false;
+		return this;
+	}
+
+	/**
+	 * Enables or disables the streaming render. When streaming, the upper rendering stage is written
+	 * directly to the output and the lower stages are rendered when their content is requested,
+	 * renders that are cached with Phalcon\Mvc\View::cache() are always buffered
+	 *
+	 *<code>
+	 * $view->setStreaming(true);
+	 *</code>
+	 */
+	public function setStreaming(boolean streaming) -> <View>
+	{
+		let this->_streaming = streaming;
+		return this;
+	}
+
+	/**
+	 * Checks if the streaming render is enabled
+	 */
+	public function isStreaming() -> boolean
+	{
+		return this->_streaming;
+	}
+
+	/**
+	 * Sends the output produced so far to the client. It only has effect while a streaming render is
+	 * writing directly to the output
+	 *
+	 *<code>
+	 * {{ flush() }}
+	 *</code>
+	 */
+	public function flush() -> <View>
+	{
+		int outputLevel;
+
+		/**
+		 * Buffers opened inside the view (partials captured by getPartial) are never flushed
+		 */
+		let outputLevel = (int) this->_outputLevel;
+		if this->_directOutput && ob_get_level() == outputLevel {
+			if outputLevel > 0 {
+				ob_flush();
+			}
+			flush();
+		}
 		return this;
 	}
 
@@ -568,14 +641,16 @@ class View extends Injectable implements ViewInterface
 	 * @param boolean silence
 	 * @param boolean mustClean
 	 * @param \Phalcon\Cache\BackendInterface $cache
+	 * @return boolean
 	 */
 	protected function _engineRender(engines, string viewPath, boolean silence, boolean mustClean, <BackendInterface> cache = null)
 	{
 		boolean notExists;
 		int renderLevel, cacheLevel;
+		boolean exists, pastResolved;
 		var key, lifetime, viewsDir, basePath, viewsDirPath,
 			viewOptions, cacheOptions, cachedView, viewParams, eventsManager,
-			extension, engine, viewEnginePath;
+			extension, engine, viewEnginePath, resolvedExtension;
 
 		let notExists = true,
 			viewsDir = this->_viewsDir,
@@ -639,13 +714,34 @@ class View extends Injectable implements ViewInterface
 		let viewParams = this->_viewParams,
 			eventsManager = <ManagerInterface> this->_eventsManager;
 
+		/**
+		 * Check if the path was already resolved by a previous render
+		 */
+		let resolvedExtension = this->_resolveViewPath(engines, viewsDirPath),
+			pastResolved = false;
+
 		/**
 		 * Views are rendered in each engine
 		 */
 		for extension, engine in engines {
 
 			let viewEnginePath = viewsDirPath . extension;
-			if file_exists(viewEnginePath) {
+
+			if resolvedExtension === null || pastResolved {
+				let exists = file_exists(viewEnginePath);
+			} else {
+				/**
+				 * Extensions before the resolved one are known to be missing, the ones after it
+				 * are only checked if a listener skipped the resolved view
+				 */
+				if resolvedExtension === extension {
+					let exists = true, pastResolved = true;
+				} else {
+					let exists = false;
+				}
+			}
+
+			if exists {
 
 				/**
 				 * Call beforeRenderView if there is a events manager available
@@ -684,6 +780,8 @@ class View extends Injectable implements ViewInterface
 				throw new Exception("View '" . viewsDirPath . "' was not found in the views directory");
 			}
 		}
+
+		return !notExists;
 	}
 
 	/**
@@ -708,7 +806,7 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function exists(string! view) -> boolean
 	{
-		var basePath, viewsDir, engines, extension;
+		var basePath, viewsDir, engines, extension, viewsDirPath, resolvedExtension;
 		boolean exists;
 
 		let basePath = this->_basePath,
@@ -721,9 +819,15 @@ class View extends Injectable implements ViewInterface
 				this->_registeredEngines = engines;
 		}
 
+		let viewsDirPath = basePath . viewsDir . view,
+			resolvedExtension = this->_resolveViewPath(engines, viewsDirPath);
+		if resolvedExtension !== null {
+			return resolvedExtension !== false;
+		}
+
 		let exists = false;
 		for extension, _ in engines {
-			let exists = (boolean) file_exists(basePath . viewsDir . view . extension);
+			let exists = (boolean) file_exists(viewsDirPath . extension);
 			if exists {
 				break;
 			}
@@ -732,6 +836,264 @@ class View extends Injectable implements ViewInterface
 		return exists;
 	}
 
+	/**
+	 * Resolves the extension of the first registered engine having a view file for the passed path
+	 * using the shared path cache. The cache is enabled with the "pathCache" option:
+	 *
+	 *<code>
+	 * $view = new \Phalcon\Mvc\View(array(
+	 *     "pathCache" => array(
+	 *         "size"     => 1024,       // maximum number of cached paths
+	 *         "lifetime" => 60,         // seconds a resolution is trusted, 0 = forever
+	 *         "stamp"    => $deployId   // a different stamp invalidates every cached path
+	 *     )
+	 * ));
+	 *</code>
+	 *
+	 * Returns the extension, false if no engine has the view or null if the cache is disabled
+	 *
+	 * @param array engines
+	 * @param string viewsDirPath
+	 * @return string|boolean|null
+	 */
+	protected function _resolveViewPath(engines, string viewsDirPath)
+	{
+		var viewOptions, cacheOptions, key, entry, stamp, resolvedPaths, extension, resolved,
+			stats, size, lifetime;
+		int now;
+
+		let viewOptions = this->_options;
+		if typeof viewOptions != "array" {
+			return null;
+		}
+
+		if !fetch cacheOptions, viewOptions["pathCache"] {
+			return null;
+		}
+
+		if typeof cacheOptions != "array" {
+			if !cacheOptions {
+				return null;
+			}
+			let cacheOptions = [];
+		}
+
+		let stats = self::_resolvedPathsStats;
+		if typeof stats != "array" {
+			let stats = ["hits": 0, "misses": 0, "evictions": 0];
+		}
+
+		/**
+		 * A new deploy stamp invalidates everything resolved before
+		 */
+		if fetch stamp, cacheOptions["stamp"] {
+			if stamp !== self::_resolvedPathsStamp {
+				let self::_resolvedPaths = [],
+					self::_resolvedPathsStamp = stamp;
+			}
+		}
+
+		if !fetch lifetime, cacheOptions["lifetime"] {
+			let lifetime = 0;
+		}
+
+		let now = 0;
+		if lifetime > 0 {
+			let now = time();
+		}
+
+		let key = join(",", array_keys(engines)) . "|" . viewsDirPath;
+
+		if fetch entry, self::_resolvedPaths[key] {
+			if lifetime <= 0 || (now - entry[1]) < lifetime {
+				let stats["hits"] = stats["hits"] + 1,
+					self::_resolvedPathsStats = stats;
+				return entry[0];
+			}
+		}
+
+		let stats["misses"] = stats["misses"] + 1;
+
+		let resolved = false;
+		for extension, _ in engines {
+			if file_exists(viewsDirPath . extension) {
+				let resolved = extension;
+				break;
+			}
+		}
+
+		if !fetch size, cacheOptions["size"] {
+			let size = 1024;
+		}
+
+		/**
+		 * The oldest resolution is dropped when the cache is full
+		 */
+		let resolvedPaths = self::_resolvedPaths;
+		if typeof resolvedPaths != "array" {
+			let resolvedPaths = [];
+		} else {
+			if !isset resolvedPaths[key] && count(resolvedPaths) >= size {
+				array_shift(resolvedPaths);
+				let stats["evictions"] = stats["evictions"] + 1;
+			}
+		}
+
+		let resolvedPaths[key] = [resolved, now],
+			self::_resolvedPaths = resolvedPaths,
+			self::_resolvedPathsStats = stats;
+
+		return resolved;
+	}
+
+	/**
+	 * Returns the hits, misses, evictions and number of entries of the shared view path cache
+	 */
+	public static function getPathCacheStats() -> array
+	{
+		var stats;
+
+		let stats = self::_resolvedPathsStats;
+		if typeof stats != "array" {
+			let stats = ["hits": 0, "misses": 0, "evictions": 0];
+		}
+
+		if typeof self::_resolvedPaths == "array" {
+			let stats["entries"] = count(self::_resolvedPaths);
+		} else {
+			let stats["entries"] = 0;
+		}
+
+		return stats;
+	}
+
+	/**
+	 * Removes every resolved path and resets the statistics of the shared view path cache
+	 */
+	public static function resetPathCache() -> void
+	{
+		let self::_resolvedPaths = [],
+			self::_resolvedPathsStamp = null,
+			self::_resolvedPathsStats = ["hits": 0, "misses": 0, "evictions": 0];
+	}
+
+	/**
+	 * Renders a stage, when the render is streamed the stage is queued instead
+	 *
+	 * @param array engines
+	 * @param string viewPath
+	 * @param boolean silence
+	 * @param boolean mustClean
+	 * @param \Phalcon\Cache\BackendInterface $cache
+	 * @return boolean
+	 */
+	protected function _renderStage(engines, string viewPath, boolean silence, boolean mustClean, <BackendInterface> cache = null)
+	{
+		if typeof this->_stages == "array" {
+			let this->_stages[] = [this->_currentRenderLevel, viewPath, silence];
+			return true;
+		}
+
+		return this->_engineRender(engines, viewPath, silence, mustClean, cache);
+	}
+
+	/**
+	 * Writes the upper queued stage directly to the output. The buffer started by Phalcon\Mvc\View::start()
+	 * is closed and the response headers are sent before any content, if no stage exists the output of
+	 * the controller is written instead
+	 *
+	 * @param array engines
+	 */
+	protected function _stream(engines) -> void
+	{
+		boolean rendered;
+		var stages, stage, dependencyInjector, response;
+
+		let stages = this->_stages;
+		if !count(stages) {
+			let this->_stages = null;
+			return;
+		}
+
+		ob_end_clean();
+		let this->_streamed = true,
+			this->_outputLevel = ob_get_level();
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector == "object" {
+			if dependencyInjector->has("response") {
+				let response = dependencyInjector->getShared("response");
+				response->sendHeaders();
+				response->sendCookies();
+			}
+		}
+
+		let rendered = false,
+			this->_directOutput = true;
+
+		while count(stages) {
+			let stage = array_pop(stages),
+				this->_stages = stages,
+				this->_currentRenderLevel = stage[0];
+			if this->_engineRender(engines, stage[1], stage[2], false) {
+				let rendered = true;
+				break;
+			}
+		}
+
+		if !rendered {
+			echo this->_content;
+		}
+
+		this->flush();
+
+		let this->_directOutput = false,
+			this->_currentRenderLevel = 0,
+			this->_stages = null;
+
+		/**
+		 * Everything was already sent, there is nothing left for the response
+		 */
+		let this->_content = "";
+	}
+
+	/**
+	 * Renders the queued stages below the stage that is being streamed. The output produced so far is
+	 * flushed first, so the client receives it while the lower stages are rendered
+	 */
+	protected function _renderPending() -> void
+	{
+		boolean directOutput;
+		var stages, stage, engines, currentRenderLevel;
+
+		this->flush();
+
+		let engines = this->_loadTemplateEngines(),
+			currentRenderLevel = this->_currentRenderLevel,
+			directOutput = this->_directOutput,
+			this->_directOutput = false;
+
+		let stages = this->_stages;
+
+		ob_start();
+		while count(stages) {
+			let stage = array_pop(stages),
+				this->_stages = stages,
+				this->_currentRenderLevel = stage[0];
+			if this->_engineRender(engines, stage[1], stage[2], true) {
+				break;
+			}
+		}
+		ob_end_clean();
+
+		/**
+		 * Stages that weren't requested by the rendered one are discarded, as in a buffered render
+		 */
+		let this->_stages = [],
+			this->_currentRenderLevel = currentRenderLevel,
+			this->_directOutput = directOutput;
+	}
+
 	/**
 	 * Executes render process from dispatching data
 	 *
@@ -746,7 +1108,7 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function render(string! controllerName, string! actionName, params = null) -> <View>|boolean
 	{
-		boolean silence, mustClean;
+		boolean silence, mustClean, streaming;
 		int renderLevel;
 		var layoutsDir, layout, pickView, layoutName,
 			engines, renderView, pickViewAction, eventsManager,
@@ -841,6 +1203,16 @@ class View extends Injectable implements ViewInterface
 		let mustClean = true,
 			silence = true;
 
+		/**
+		 * Cached renders are always buffered, the cache captures the output of every stage
+		 */
+		let streaming = this->_streaming && typeof cache != "object";
+		if streaming {
+			let this->_stages = [];
+		} else {
+			let this->_stages = null;
+		}
+
 		/**
 		 * Disabled levels allow to avoid an specific level of rendering
 		 */
@@ -858,7 +1230,7 @@ class View extends Injectable implements ViewInterface
 			if renderLevel >= self::LEVEL_ACTION_VIEW {
 				if !isset disabledLevels[self::LEVEL_ACTION_VIEW] {
 					let this->_currentRenderLevel = self::LEVEL_ACTION_VIEW;
-					this->_engineRender(engines, renderView, silence, mustClean, cache);
+					this->_renderStage(engines, renderView, silence, mustClean, cache);
 				}
 			}
 
@@ -876,7 +1248,7 @@ class View extends Injectable implements ViewInterface
 					if typeof templatesBefore == "array" {
 						let silence = false;
 						for templateBefore in templatesBefore {
-							this->_engineRender(engines, layoutsDir . templateBefore, silence, mustClean, cache);
+							this->_renderStage(engines, layoutsDir . templateBefore, silence, mustClean, cache);
 						}
 						let silence = true;
 					}
@@ -889,7 +1261,7 @@ class View extends Injectable implements ViewInterface
 			if renderLevel >= self::LEVEL_LAYOUT {
 				if !isset disabledLevels[self::LEVEL_LAYOUT] {
 					let this->_currentRenderLevel = self::LEVEL_LAYOUT;
-					this->_engineRender(engines, layoutsDir . layoutName, silence, mustClean, cache);
+					this->_renderStage(engines, layoutsDir . layoutName, silence, mustClean, cache);
 				}
 			}
 
@@ -907,7 +1279,7 @@ class View extends Injectable implements ViewInterface
 					if typeof templatesAfter == "array" {
 						let silence = false;
 						for templateAfter in templatesAfter {
-							this->_engineRender(engines, layoutsDir . templateAfter, silence, mustClean, cache);
+							this->_renderStage(engines, layoutsDir . templateAfter, silence, mustClean, cache);
 						}
 						let silence = true;
 					}
@@ -920,12 +1292,19 @@ class View extends Injectable implements ViewInterface
 			if renderLevel >= self::LEVEL_MAIN_LAYOUT {
 				if !isset disabledLevels[self::LEVEL_MAIN_LAYOUT] {
 					let this->_currentRenderLevel = self::LEVEL_MAIN_LAYOUT;
-					this->_engineRender(engines, this->_mainView, silence, mustClean, cache);
+					this->_renderStage(engines, this->_mainView, silence, mustClean, cache);
 				}
 			}
 
 			let this->_currentRenderLevel = 0;
 
+			/**
+			 * Write the queued stages to the output
+			 */
+			if streaming {
+				this->_stream(engines);
+			}
+
 			/**
 			 * Store the data in the cache
 			 */
@@ -1148,7 +1527,12 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function finish() -> <View>
 	{
-		ob_end_clean();
+		/**
+		 * A streaming render already closed the buffer
+		 */
+		if !this->_streamed {
+			ob_end_clean();
+		}
 		return this;
 	}
 
@@ -1290,6 +1674,18 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function getContent() -> string
 	{
+		var stages;
+
+		/**
+		 * Lower stages of a streaming render are rendered the first time their content is requested
+		 */
+		let stages = this->_stages;
+		if typeof stages == "array" {
+			if count(stages) {
+				this->_renderPending();
+			}
+		}
+
 		return this->_content;
 	}
 
@@ -1331,7 +1727,10 @@ class View extends Injectable implements ViewInterface
 			this->_cacheLevel = self::LEVEL_NO_RENDER,
 			this->_content = null,
 			this->_templatesBefore = null,
-			this->_templatesAfter = null;
+			this->_templatesAfter = null,
+			this->_streaming = false,
+			this->_stages = null,
+			this->_streamed = false;
 		return this;
 	}
 
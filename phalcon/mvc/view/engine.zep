@@ -63,6 +63,19 @@ abstract class Engine extends Injectable
 		return this->_view->partial(partialPath, params);
 	}
 
+	/**
+	 * Sends the output produced so far to the client if the view is streaming
+	 */
+	public function flush() -> void
+	{
+		var view;
+
+		let view = this->_view;
+		if method_exists(view, "flush") {
+			view->flush();
+		}
+	}
+
 	/**
 	 * Returns the view component related to the adapter
 	 */
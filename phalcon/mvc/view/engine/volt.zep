@@ -20,6 +20,8 @@
 namespace Phalcon\Mvc\View\Engine;
 
 use Phalcon\DiInterface;
+use Phalcon\Cache\Backend;
+use Phalcon\Cache\BackendInterface;
 use Phalcon\Mvc\View\Engine;
 use Phalcon\Mvc\View\EngineInterface;
 use Phalcon\Mvc\View\Engine\Volt\Compiler;
@@ -39,6 +41,12 @@ class Volt extends Engine implements EngineInterface
 
 	protected _macros;
 
+	protected _tagVersions = [];
+
+	protected _fragments = [];
+
+	protected _renderLevel = 0;
+
 	/**
 	 * Set Volt's options
 	 */
@@ -93,7 +101,7 @@ class Volt extends Engine implements EngineInterface
 	 */
 	public function render(string! templatePath, var params, boolean mustClean = false)
 	{
-		var compiler, compiledTemplatePath, key, value;
+		var compiler, compiledTemplatePath, key, value, e;
 
 		if mustClean {
 			ob_clean();
@@ -117,7 +125,22 @@ class Volt extends Engine implements EngineInterface
 			}
 		}
 
-		require compiledTemplatePath;
+		/**
+		 * Tag versions and prefetched fragments are only kept while a template and the partials it renders are rendered
+		 */
+		if !this->_renderLevel {
+			let this->_tagVersions = [],
+				this->_fragments = [];
+		}
+
+		let this->_renderLevel++;
+		try {
+			require compiledTemplatePath;
+		} catch \Exception, e {
+			let this->_renderLevel--;
+			throw e;
+		}
+		let this->_renderLevel--;
 
 		if mustClean {
 			this->_view->setContent(ob_get_contents());
@@ -282,6 +305,139 @@ class Volt extends Engine implements EngineInterface
 		return value;
 	}
 
+	/**
+	 * Returns the cache service used by the cache fragments
+	 */
+	protected function _getFragmentCache() -> <BackendInterface>
+	{
+		var dependencyInjector;
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injector container is required to obtain the fragments cache");
+		}
+
+		return dependencyInjector->get("viewCache");
+	}
+
+	/**
+	 * Fetches the cache fragments of a template before it's rendered, the versions of their tags and
+	 * the fragments with the same lifetime are read in a single request. Every fragment is passed as
+	 * [key, tags, lifetime]
+	 */
+	public function prefetchFragments(array! fragments) -> void
+	{
+		var cache, fragment, tag, tags, missing, version, groups, lifetime, fragmentKeys, key, content;
+
+		let cache = this->_getFragmentCache();
+
+		/**
+		 * Backends that only implement the interface can't read several keys at once,
+		 * their fragments are read one by one by startFragment()
+		 */
+		if !(cache instanceof Backend) {
+			return;
+		}
+
+		let missing = [];
+		for fragment in fragments {
+			let tags = fragment[1];
+			if typeof tags == "array" {
+				for tag in tags {
+					if !isset this->_tagVersions[tag] {
+						let missing[tag] = tag;
+					}
+				}
+			}
+		}
+
+		if count(missing) {
+			for tag, version in cache->getTagVersions(array_values(missing)) {
+				let this->_tagVersions[tag] = version;
+			}
+		}
+
+		let groups = [];
+		for fragment in fragments {
+			let lifetime = (string) fragment[2],
+				groups[lifetime][] = this->getFragmentKey(fragment[0], fragment[1]);
+		}
+
+		for lifetime, fragmentKeys in groups {
+			if lifetime === "" {
+				let lifetime = null;
+			}
+			for key, content in cache->getMultiple(fragmentKeys, lifetime) {
+				let this->_fragments[key] = content;
+			}
+		}
+	}
+
+	/**
+	 * Returns the key of a cache fragment, the key of a tagged fragment includes the current version
+	 * of its tags so it isn't found again once any of them is invalidated
+	 */
+	public function getFragmentKey(string key, var tags = null) -> string
+	{
+		var missing, tag, version, versions, cache;
+
+		if typeof tags != "array" || !count(tags) {
+			return key;
+		}
+
+		let missing = [];
+		for tag in tags {
+			if !isset this->_tagVersions[tag] {
+				let missing[] = tag;
+			}
+		}
+
+		if count(missing) {
+
+			let cache = this->_getFragmentCache();
+			if !(cache instanceof Backend) {
+				throw new Exception("Cache fragments with tags require a cache backend extending Phalcon\\Cache\\Backend");
+			}
+
+			for tag, version in cache->getTagVersions(missing) {
+				let this->_tagVersions[tag] = version;
+			}
+		}
+
+		let versions = [];
+		for tag in tags {
+			let versions[tag] = this->_tagVersions[tag];
+		}
+		ksort(versions);
+
+		return key . "_" . md5(serialize(versions));
+	}
+
+	/**
+	 * Returns a cache fragment fetched by prefetchFragments() or starts the cache to capture it
+	 */
+	public function startFragment(<BackendInterface> cache, string key, var lifetime = null)
+	{
+		var content;
+
+		if fetch content, this->_fragments[key] {
+			unset this->_fragments[key];
+			if content !== null {
+				return content;
+			}
+
+			/**
+			 * The fragment was already looked up, it's captured without reading it again
+			 */
+			if cache instanceof Backend {
+				cache->startCapture(lifetime);
+				return null;
+			}
+		}
+
+		return cache->start(key, lifetime);
+	}
+
 	/**
 	 * Checks if a macro is defined and calls it
 	 */
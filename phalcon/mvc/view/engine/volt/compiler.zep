@@ -19,6 +19,7 @@
 
 namespace Phalcon\Mvc\View\Engine\Volt;
 
+use Phalcon\Text;
 use Phalcon\DiInterface;
 use Phalcon\Mvc\ViewBaseInterface;
 use Phalcon\Di\InjectionAwareInterface;
@@ -84,6 +85,27 @@ class Compiler implements InjectionAwareInterface
 
 	protected _compiledTemplatePath;
 
+	protected _temporaryNumber = 0;
+
+	protected _hoisted;
+
+	protected _hoistedNumber = 0;
+
+	protected _includeNumber = 0;
+
+	protected _nested = false;
+
+	protected _dependencies = [];
+
+	/**
+	 * Cache fragments with literal keys and tags, they're fetched before the template is rendered
+	 */
+	protected _fragments = [];
+
+	protected static _modificationTimes;
+
+	protected static _manifests;
+
 	/**
 	 * Phalcon\Mvc\View\Engine\Volt\Compiler
 	 */
@@ -365,7 +387,7 @@ class Compiler implements InjectionAwareInterface
 		var code, funcArguments, arguments, nameExpr,
 			nameType, name, extensions, functions, definition,
 			extendedBlocks, block, currentBlock, exprLevel, escapedCode,
-			method, arrayHelpers, className;
+			method, arrayHelpers, className, temporary, macro;
 
 		let code = null;
 
@@ -435,6 +457,13 @@ class Compiler implements InjectionAwareInterface
 				return "$this->getContent()";
 			}
 
+			/**
+			 * This function sends the output produced so far when the view is streaming
+			 */
+			if name == "flush" {
+				return "$this->flush()";
+			}
+
 			/**
 			 * This function includes views of volt or others template engines dynamically
 			 */
@@ -560,6 +589,16 @@ class Compiler implements InjectionAwareInterface
 				return "constant(" . arguments . ")";
 			}
 
+			/**
+			 * Macros already compiled in this template are invoked directly, callMacro() reports
+			 * the macros that weren't defined when the template is executed
+			 */
+			if isset this->_macros[name] {
+				let macro = "$this->_macros['" . name . "']",
+					temporary = this->_getTemporary("isset(" . macro . ") ? " . macro . " : null");
+				return "(" . temporary[0] . " ? " . temporary[1] . "(array(" . arguments . ")) : $this->callMacro('" . name . "', array(" . arguments . ")))";
+			}
+
 			/**
 			 * By default it tries to call a macro
 			 */
@@ -669,7 +708,8 @@ class Compiler implements InjectionAwareInterface
 	final protected function resolveFilter(array! filter, string left) -> string
 	{
 		var code, type, functionName, name, file, line,
-			extensions, filters, funcArguments, arguments, definition;
+			extensions, filters, funcArguments, arguments, definition,
+			argument, start, end;
 
 		let code = null, type = filter["type"];
 
@@ -772,10 +812,10 @@ class Compiler implements InjectionAwareInterface
 		}
 
 		/**
-		 * "length" uses the length method implemented in the Volt adapter
+		 * "length" counts arrays/objects or measures strings
 		 */
 		if name == "length" {
-			return "$this->length(" . arguments . ")";
+			return this->_compileLength(arguments);
 		}
 
 		/**
@@ -936,7 +976,24 @@ class Compiler implements InjectionAwareInterface
 		 * "slice" slices string/arrays/traversable objects
 		 */
 		if name == "slice" {
-			return "$this->slice(" . arguments . ")";
+
+			let start = "0", end = "null";
+			if typeof funcArguments == "array" {
+
+				if count(funcArguments) > 3 {
+					return "$this->slice(" . arguments . ")";
+				}
+
+				if fetch argument, funcArguments[1] {
+					let start = this->expression(argument["expr"]);
+				}
+
+				if fetch argument, funcArguments[2] {
+					let end = this->expression(argument["expr"]);
+				}
+			}
+
+			return this->_compileSlice(left, start, end);
 		}
 
 		/**
@@ -950,7 +1007,7 @@ class Compiler implements InjectionAwareInterface
 		 * This function uses mbstring or iconv to convert strings from one chartset to another
 		 */
 		if name == "convert_encoding" {
-			return "$this->convertEncoding(" . arguments . ")";
+			return this->_compileConvertEncoding(left, arguments, funcArguments);
 		}
 
 		/**
@@ -959,6 +1016,429 @@ class Compiler implements InjectionAwareInterface
 		throw new Exception("Unknown filter \"" . name . "\" in " . filter["file"] . " on line " . filter["line"]);
 	}
 
+	/**
+	 * Returns the code that evaluates an expression once and the code that reads its value back.
+	 * Plain variables are reused as they are, anything else is stored in a temporary variable
+	 */
+	protected function _getTemporary(string! code) -> array
+	{
+		var temporary;
+
+		if preg_match("/^\\$[a-zA-Z_][a-zA-Z0-9_]*$/", code) {
+			return [code, code];
+		}
+
+		let this->_temporaryNumber++;
+		let temporary = "$__t" . this->_temporaryNumber;
+
+		return ["(" . temporary . " = " . code . ")", temporary];
+	}
+
+	/**
+	 * Compiles "length" to direct calls, the string function is chosen at compile time
+	 */
+	protected function _compileLength(string! value) -> string
+	{
+		var temporary, stringLength;
+
+		let temporary = this->_getTemporary(value);
+
+		if function_exists("mb_strlen") {
+			let stringLength = "mb_strlen";
+		} else {
+			let stringLength = "strlen";
+		}
+
+		return "((is_array(" . temporary[0] . ") || is_object(" . temporary[1] . ")) ? count(" . temporary[1] . ") : " . stringLength . "(" . temporary[1] . "))";
+	}
+
+	/**
+	 * Compiles the "in" operator, only haystacks that aren't arrays or strings go through the engine
+	 */
+	protected function _compileIncluded(string! needle, string! haystack) -> string
+	{
+		var temporary, stringPosition;
+
+		let temporary = this->_getTemporary(haystack);
+
+		if function_exists("mb_strpos") {
+			let stringPosition = "mb_strpos";
+		} else {
+			let stringPosition = "strpos";
+		}
+
+		return "(is_array(" . temporary[0] . ") ? in_array(" . needle . ", " . temporary[1] . ") : (is_string(" . temporary[1] . ") ? " . stringPosition . "(" . temporary[1] . ", " . needle . ") !== false : $this->isIncluded(" . needle . ", " . temporary[1] . ")))";
+	}
+
+	/**
+	 * Compiles slices, when both limits are integer literals the length is calculated at compile time
+	 */
+	protected function _compileSlice(string! value, string! start, string! end) -> string
+	{
+		var temporary, length, subString;
+
+		if start == "null" {
+			let start = "0";
+		}
+
+		if !preg_match("/^-?[0-9]+$/", start) || (end != "null" && !preg_match("/^-?[0-9]+$/", end)) {
+			return "$this->slice(" . value . ", " . start . ", " . end . ")";
+		}
+
+		if end == "null" {
+			let length = "";
+		} else {
+			let length = ", " . ((intval(end) - intval(start)) + 1);
+		}
+
+		let temporary = this->_getTemporary(value);
+
+		if function_exists("mb_substr") {
+			let subString = "mb_substr";
+		} else {
+			let subString = "substr";
+		}
+
+		return "(is_object(" . temporary[0] . ") ? $this->slice(" . temporary[1] . ", " . start . ", " . end . ") : (is_array(" . temporary[1] . ") ? array_slice(" . temporary[1] . ", " . start . length . ") : " . subString . "(" . temporary[1] . ", " . start . length . ")))";
+	}
+
+	/**
+	 * Compiles "convert_encoding", literal charsets are resolved to a conversion function at compile time
+	 */
+	protected function _compileConvertEncoding(string! text, string! arguments, var funcArguments) -> string
+	{
+		var argument, fromCode, toCode, from, to;
+
+		if typeof funcArguments != "array" || count(funcArguments) != 3 {
+			return "$this->convertEncoding(" . arguments . ")";
+		}
+
+		let argument = funcArguments[1],
+			fromCode = this->expression(argument["expr"]);
+
+		let argument = funcArguments[2],
+			toCode = this->expression(argument["expr"]);
+
+		if !preg_match("/^'[a-zA-Z0-9_-]+'$/", fromCode) || !preg_match("/^'[a-zA-Z0-9_-]+'$/", toCode) {
+			return "$this->convertEncoding(" . arguments . ")";
+		}
+
+		let from = substr(fromCode, 1, -1),
+			to = substr(toCode, 1, -1);
+
+		if from == "latin1" || to == "utf8" {
+			return "utf8_encode(" . text . ")";
+		}
+
+		if to == "latin1" || from == "utf8" {
+			return "utf8_decode(" . text . ")";
+		}
+
+		if function_exists("mb_convert_encoding") {
+			return "mb_convert_encoding(" . text . ", " . fromCode . ", " . toCode . ")";
+		}
+
+		if function_exists("iconv") {
+			return "iconv(" . fromCode . ", " . toCode . ", " . text . ")";
+		}
+
+		return "$this->convertEncoding(" . arguments . ")";
+	}
+
+	/**
+	 * Returns the PHP value of an integer or string literal, doubles are returned only when
+	 * "doubles" is true, any other node returns null
+	 */
+	protected function _getLiteral(var expr, boolean doubles = false)
+	{
+		var type, value;
+
+		if typeof expr != "array" {
+			return null;
+		}
+
+		if !fetch type, expr["type"] {
+			return null;
+		}
+
+		if type == 258 {
+			let value = intval(expr["value"]);
+			if (string) value !== expr["value"] {
+				return null;
+			}
+			return value;
+		}
+
+		if type == 259 && doubles {
+			return doubleval(expr["value"]);
+		}
+
+		if type == PHVOLT_T_STRING {
+			let value = expr["value"];
+			if memstr(value, "\\") {
+				return null;
+			}
+			return value;
+		}
+
+		return null;
+	}
+
+	/**
+	 * Creates a literal node for a value calculated at compile time
+	 */
+	protected function _getLiteralNode(var value, array! expr) -> array
+	{
+		var node, file, line;
+
+		if typeof value == "integer" {
+			let node = ["type": 258, "value": (string) value];
+		} else {
+			if typeof value == "double" {
+				let node = ["type": 259, "value": var_export(value, true)];
+			} else {
+				if memstr(value, "\\") {
+					let node = ["type": PHVOLT_T_RESOLVED_EXPR, "value": var_export(value, true)];
+				} else {
+					let node = ["type": PHVOLT_T_STRING, "value": value];
+				}
+			}
+		}
+
+		if fetch file, expr["file"] {
+			let node["file"] = file;
+		}
+
+		if fetch line, expr["line"] {
+			let node["line"] = line;
+		}
+
+		return node;
+	}
+
+	/**
+	 * Checks if a filter is a built-in filter without side effects that wasn't replaced by an user filter
+	 */
+	protected function _isPureFilter(var filter) -> boolean
+	{
+		var name, filters;
+
+		if typeof filter != "array" {
+			return false;
+		}
+
+		if filter["type"] != PHVOLT_T_IDENTIFIER {
+			return false;
+		}
+
+		let name = filter["value"];
+
+		let filters = this->_filters;
+		if typeof filters == "array" {
+			if isset filters[name] {
+				return false;
+			}
+		}
+
+		return in_array(name, [
+			"length", "e", "escape", "escape_attr", "trim", "left_trim", "right_trim", "striptags",
+			"url_encode", "nl2br", "keys", "lower", "lowercase", "upper", "uppercase", "capitalize",
+			"json_encode", "abs"
+		], true);
+	}
+
+	/**
+	 * Applies a pure filter on a literal value at compile time, returns null if it can't be folded
+	 */
+	protected function _foldFilter(string! name, var value)
+	{
+		if name == "abs" {
+			if typeof value == "integer" || typeof value == "double" {
+				return abs(value);
+			}
+			return null;
+		}
+
+		if typeof value != "string" {
+			return null;
+		}
+
+		switch name {
+
+			case "length":
+				if function_exists("mb_strlen") {
+					return mb_strlen(value);
+				}
+				return strlen(value);
+
+			case "trim":
+				return trim(value);
+
+			case "left_trim":
+				return ltrim(value);
+
+			case "right_trim":
+				return rtrim(value);
+
+			case "striptags":
+				return strip_tags(value);
+
+			case "url_encode":
+				return urlencode(value);
+
+			case "nl2br":
+				return nl2br(value);
+
+			case "lower":
+			case "lowercase":
+				return Text::lower(value);
+
+			case "upper":
+			case "uppercase":
+				return Text::upper(value);
+
+			case "capitalize":
+				return ucwords(value);
+		}
+
+		return null;
+	}
+
+	/**
+	 * Folds operations and filters on literals into a single literal node
+	 */
+	protected function _foldExpression(var expr)
+	{
+		var type, left, right, leftValue, rightValue, value;
+
+		if typeof expr != "array" {
+			return expr;
+		}
+
+		if !fetch type, expr["type"] {
+			return expr;
+		}
+
+		let left = null, right = null;
+
+		if fetch left, expr["left"] {
+			if typeof left == "array" && isset left["type"] {
+				let left = this->_foldExpression(left),
+					expr["left"] = left;
+			}
+		}
+
+		/**
+		 * The right side of attributes, filters and tests isn't an expression
+		 */
+		if type != PHVOLT_T_DOT && type != 124 && type != PHVOLT_T_IS {
+			if fetch right, expr["right"] {
+				if typeof right == "array" && isset right["type"] {
+					let right = this->_foldExpression(right),
+						expr["right"] = right;
+				}
+			}
+		}
+
+		let value = null;
+
+		switch type {
+
+			case PHVOLT_T_ADD:
+			case PHVOLT_T_SUB:
+			case PHVOLT_T_MUL:
+			case PHVOLT_T_DIV:
+			case 37:
+			case 278:
+				let leftValue = this->_getLiteral(left, true),
+					rightValue = this->_getLiteral(right, true);
+
+				if typeof leftValue != "integer" && typeof leftValue != "double" {
+					break;
+				}
+
+				if typeof rightValue != "integer" && typeof rightValue != "double" {
+					break;
+				}
+
+				if type == PHVOLT_T_ADD {
+					let value = leftValue + rightValue;
+				}
+
+				if type == PHVOLT_T_SUB {
+					let value = leftValue - rightValue;
+				}
+
+				if type == PHVOLT_T_MUL {
+					let value = leftValue * rightValue;
+				}
+
+				/**
+				 * Divisions by zero keep raising their warning at runtime
+				 */
+				if type == PHVOLT_T_DIV && rightValue != 0 {
+					let value = leftValue / rightValue;
+				}
+
+				if type == 37 && typeof leftValue == "integer" && typeof rightValue == "integer" && rightValue != 0 {
+					let value = leftValue % rightValue;
+				}
+
+				if type == 278 {
+					let value = pow(leftValue, rightValue);
+				}
+				break;
+
+			case 126:
+				let leftValue = this->_getLiteral(left),
+					rightValue = this->_getLiteral(right);
+				if typeof leftValue != "null" && typeof rightValue != "null" {
+					let value = leftValue . rightValue;
+				}
+				break;
+
+			case PHVOLT_T_MINUS:
+				let rightValue = this->_getLiteral(right, true);
+				if typeof rightValue == "integer" || typeof rightValue == "double" {
+					let value = -rightValue;
+				}
+				break;
+
+			case PHVOLT_T_PLUS:
+				let rightValue = this->_getLiteral(right, true);
+				if typeof rightValue == "integer" || typeof rightValue == "double" {
+					let value = rightValue;
+				}
+				break;
+
+			case PHVOLT_T_ENCLOSED:
+				let leftValue = this->_getLiteral(left, true);
+				if typeof leftValue != "null" {
+					return left;
+				}
+				break;
+
+			case 124:
+				if this->_isPureFilter(expr["right"]) {
+					let right = expr["right"],
+						value = this->_foldFilter(right["value"], this->_getLiteral(left, true));
+				}
+				break;
+		}
+
+		if typeof value == "null" || typeof value == "boolean" {
+			return expr;
+		}
+
+		if typeof value == "double" {
+			if is_nan(value) || is_infinite(value) {
+				return expr;
+			}
+		}
+
+		return this->_getLiteralNode(value, expr);
+	}
+
 	/**
 	 * Resolves an expression node in an AST volt tree
 	 */
@@ -1190,7 +1670,7 @@ class Compiler implements InjectionAwareInterface
 						let endCode = "null";
 					}
 
-					let exprCode = "$this->slice(" . leftCode . ", " . startCode . ", " . endCode . ")";
+					let exprCode = this->_compileSlice(leftCode, startCode, endCode);
 					break;
 
 				case PHVOLT_T_NOT_ISSET:
@@ -1250,11 +1730,11 @@ class Compiler implements InjectionAwareInterface
 					break;
 
 				case PHVOLT_T_IN:
-					let exprCode = "$this->isIncluded(" . leftCode . ", " . rightCode . ")";
+					let exprCode = this->_compileIncluded(leftCode, rightCode);
 					break;
 
 				case PHVOLT_T_NOT_IN:
-					let exprCode = "!$this->isIncluded(" . leftCode . ", " . rightCode . ")";
+					let exprCode = "!" . this->_compileIncluded(leftCode, rightCode);
 					break;
 
 				case PHVOLT_T_TERNARY:
@@ -1336,7 +1816,7 @@ class Compiler implements InjectionAwareInterface
 	{
 		var compilation, prefix, level, prefixLevel, expr,
 			exprCode, bstatement, type, blockStatements, forElse, code,
-			loopContext, iterator, key, ifExpr, variable;
+			loopContext, iterator, key, ifExpr, variable, hoisted, name, hoistedExpr;
 
 		/**
 		 * A valid expression is required
@@ -1426,21 +1906,42 @@ class Compiler implements InjectionAwareInterface
 		/**
 		 * Check if a "key" variable needs to be calculated
 		 */
+		let compilation .= "<?php ";
+
+		/**
+		 * Loop-invariant expressions are calculated in the first iteration
+		 */
+		if !fetch hoisted, statement["hoisted"] {
+			let hoisted = null;
+		}
+
+		if typeof hoisted == "array" {
+			let compilation .= "$" . prefixLevel . "hoisted = false; ";
+		}
+
 		if fetch key, statement["key"] {
-			let compilation .= "<?php foreach (" . iterator . " as $" . key . " => $" . variable . ") { ";
+			let compilation .= "foreach (" . iterator . " as $" . key . " => $" . variable . ") { ";
 		} else {
-			let compilation .= "<?php foreach (" . iterator . " as $" . variable . ") { ";
+			let compilation .= "foreach (" . iterator . " as $" . variable . ") { ";
 		}
 
 		/**
 		 * Check for an "if" expr in the block
 		 */
 		if fetch ifExpr, statement["if_expr"] {
-			let compilation .= "if (" . this->expression(ifExpr) . ") { ?>";
-		} else {
-			let compilation .= "?>";
+			let compilation .= "if (" . this->expression(ifExpr) . ") { ";
+		}
+
+		if typeof hoisted == "array" {
+			let compilation .= "if (!$" . prefixLevel . "hoisted) { ";
+			for name, hoistedExpr in hoisted {
+				let compilation .= name . " = " . this->expression(hoistedExpr) . "; ";
+			}
+			let compilation .= "$" . prefixLevel . "hoisted = true; } ";
 		}
 
+		let compilation .= "?>";
+
 		/**
 		 * Generate the loop context inside the cycle
 		 */
@@ -1574,7 +2075,15 @@ class Compiler implements InjectionAwareInterface
 		 * Cache statement
 		 */
 		let exprCode = this->expression(expr);
-		let compilation = "<?php $_cache[" . this->expression(expr) . "] = $this->di->get('viewCache'); ";
+
+		/**
+		 * Fragments with tags or a literal key are handled by the engine
+		 */
+		if isset statement["tags"] || expr["type"] == PHVOLT_T_STRING {
+			return this->_compileFragmentCache(statement, exprCode, extendsMode);
+		}
+
+		let compilation = "<?php $_cache[" . this->expression(expr) . "] = $this->di->get('viewCache'); ";
 		if fetch lifetime, statement["lifetime"] {
 			let compilation .= "$_cacheKey[" . exprCode . "]";
 			if lifetime["type"] == PHVOLT_T_IDENTIFIER {
@@ -1609,6 +2118,104 @@ class Compiler implements InjectionAwareInterface
 		return compilation;
 	}
 
+	/**
+	 * Compiles a "cache" statement whose fragment is handled by the engine. The key of tagged fragments
+	 * includes the current version of their tags, fragments with a literal key and literal tags are
+	 * fetched in a single request before the template is rendered
+	 */
+	protected function _compileFragmentCache(array! statement, string! exprCode, boolean extendsMode) -> string
+	{
+		var expr, tags, tagsCode, items, item, itemExpr, lifetime, lifetimeCode, fragmentCode, compilation;
+		boolean prefetch;
+
+		let expr = statement["expr"],
+			prefetch = expr["type"] == PHVOLT_T_STRING;
+
+		if fetch tags, statement["tags"] {
+			let tagsCode = this->expression(tags);
+
+			/**
+			 * Only arrays of strings are known before rendering
+			 */
+			if tags["type"] != PHVOLT_T_ARRAY {
+				let prefetch = false;
+			} else {
+				if fetch items, tags["left"] {
+					for item in items {
+						let itemExpr = item["expr"];
+						if isset item["name"] || itemExpr["type"] != PHVOLT_T_STRING {
+							let prefetch = false;
+							break;
+						}
+					}
+				}
+			}
+
+			let fragmentCode = "$_cacheFragment[" . exprCode . "]";
+		} else {
+			let tagsCode = "null",
+				fragmentCode = exprCode;
+		}
+
+		if fetch lifetime, statement["lifetime"] {
+			if lifetime["type"] == PHVOLT_T_IDENTIFIER {
+				let lifetimeCode = "$" . lifetime["value"],
+					prefetch = false;
+			} else {
+				let lifetimeCode = lifetime["value"];
+			}
+		} else {
+			let lifetimeCode = null;
+		}
+
+		if prefetch {
+			if lifetimeCode === null {
+				let this->_fragments[exprCode] = "array(" . exprCode . ", " . tagsCode . ", null)";
+			} else {
+				let this->_fragments[exprCode] = "array(" . exprCode . ", " . tagsCode . ", " . lifetimeCode . ")";
+			}
+		}
+
+		let compilation = "<?php $_cache[" . exprCode . "] = $this->di->get('viewCache'); ";
+		if isset statement["tags"] {
+			let compilation .= fragmentCode . " = $this->getFragmentKey(" . exprCode . ", " . tagsCode . "); ";
+		}
+
+		let compilation .= "$_cacheKey[" . exprCode . "] = $this->startFragment($_cache[" . exprCode . "], " . fragmentCode;
+		if lifetimeCode !== null {
+			let compilation .= ", " . lifetimeCode;
+		}
+		let compilation .= "); if ($_cacheKey[" . exprCode . "] === null) { ?>";
+
+		/**
+		 * Get the code in the block
+		 */
+		let compilation .= this->_statementList(statement["block_statements"], extendsMode);
+
+		let compilation .= "<?php $_cache[" . exprCode . "]->save(" . fragmentCode;
+		if lifetimeCode !== null {
+			let compilation .= ", null, " . lifetimeCode;
+		}
+		let compilation .= "); } else { echo $_cacheKey[" . exprCode . "]; } ?>";
+
+		return compilation;
+	}
+
+	/**
+	 * Prepends the request that fetches the cache fragments of the template
+	 */
+	protected function _compilePrefetch(var compilation)
+	{
+		var fragments;
+
+		let fragments = this->_fragments;
+		if typeof compilation != "string" || !count(fragments) {
+			return compilation;
+		}
+
+		return "<?php $this->prefetchFragments(array(" . join(", ", fragments) . ")); ?>" . compilation;
+	}
+
 	/**
 	 * Compiles a "set" statement returning PHP code
 	 */
@@ -1759,7 +2366,7 @@ class Compiler implements InjectionAwareInterface
 		 */
 		let exprCode = this->expression(expr);
 
-		if expr["type"] == PHVOLT_T_FCALL  {
+		if isset expr["type"] && expr["type"] == PHVOLT_T_FCALL  {
 
 			let name = expr["name"];
 
@@ -1789,7 +2396,8 @@ class Compiler implements InjectionAwareInterface
 	 */
 	public function compileInclude(array! statement) -> string
 	{
-		var pathExpr, path, view, subCompiler, finalPath, compilation, params;
+		var pathExpr, path, view, subCompiler, finalPath, compilation, params,
+			options, inlineIncludes;
 
 		/**
 		 * Include statement
@@ -1805,6 +2413,24 @@ class Compiler implements InjectionAwareInterface
 		 */
 		if pathExpr["type"] == 260 {
 
+			/**
+			 * The included template can be compiled into the current one with its parameters
+			 */
+			let options = this->_options;
+			if typeof options == "array" {
+				if fetch inlineIncludes, options["inlineIncludes"] {
+					if typeof inlineIncludes != "bool" {
+						throw new Exception("'inlineIncludes' must be boolean");
+					}
+					if inlineIncludes {
+						let compilation = this->_compileInlinedInclude(pathExpr["value"], statement);
+						if typeof compilation == "string" {
+							return compilation;
+						}
+					}
+				}
+			}
+
 			/**
 			 * Static compilation cannot be performed if the user passed extra parameters
 			 */
@@ -1827,8 +2453,14 @@ class Compiler implements InjectionAwareInterface
 				 * Perform a subcompilation of the included file
 				 * If the compilation doesn't return anything we include the compiled path
 				 */
-				let subCompiler = clone this;
+				let subCompiler = clone this,
+					subCompiler->_nested = true;
 				let compilation = subCompiler->compile(finalPath, false);
+
+				let this->_dependencies = array_merge(this->_dependencies, subCompiler->getDependencies()),
+					this->_dependencies[finalPath] = "include",
+					this->_hoistedNumber = subCompiler->_hoistedNumber,
+					this->_includeNumber = subCompiler->_includeNumber;
 				if typeof compilation == "null" {
 
 					/**
@@ -1857,6 +2489,112 @@ class Compiler implements InjectionAwareInterface
 		return "<?php $this->partial(" . path . ", " . this->expression(params) . "); ?>";
 	}
 
+	/**
+	 * Compiles a static include into the current template. The parameters passed with "with" are
+	 * assigned before the included code and the previous values are restored after it, they must be
+	 * an array literal with named items, otherwise null is returned and the include is left to the view
+	 *
+	 * @return string|null
+	 */
+	protected function _compileInlinedInclude(string! path, array! statement)
+	{
+		var params, items, item, name, names, view, finalPath, compilation, restore;
+
+		let names = [];
+
+		if fetch params, statement["params"] {
+
+			if params["type"] != PHVOLT_T_ARRAY {
+				return null;
+			}
+
+			if fetch items, params["left"] {
+				for item in items {
+					if !fetch name, item["name"] {
+						return null;
+					}
+					let names[] = name;
+				}
+			}
+		}
+
+		let view = this->_view;
+		if typeof view == "object" {
+			let finalPath = view->getViewsDir() . path;
+		} else {
+			let finalPath = path;
+		}
+
+		if !count(names) {
+			return this->_compileInlined(finalPath);
+		}
+
+		/**
+		 * The variable is reserved before compiling the included template so its own includes don't reuse it
+		 */
+		let this->_includeNumber++,
+			restore = "$__o" . this->_includeNumber,
+			compilation = this->_compileInlined(finalPath);
+
+		return "<?php " . restore . " = compact('" . join("', '", names) . "'); extract(" . this->expression(params) . "); ?>" .
+			compilation .
+			"<?php unset($" . join(", $", names) . "); extract(" . restore . "); ?>";
+	}
+
+	/**
+	 * Compiles a template that is written inside the current compilation, its loops are
+	 * numbered after the loops of the current template so their variables don't collide
+	 */
+	protected function _compileInlined(string! path) -> string
+	{
+		var viewCode, subCompiler, compilation;
+
+		if !file_exists(path) {
+			throw new Exception("Template file " . path . " does not exist");
+		}
+
+		/**
+		 * Always use file_get_contents instead of read the file directly, this respect the open_basedir directive
+		 */
+		let viewCode = file_get_contents(path);
+		if viewCode === false {
+			throw new Exception("Template file " . path . " could not be opened");
+		}
+
+		let subCompiler = clone this,
+			compilation = subCompiler->_compileNested(path, viewCode);
+
+		let this->_dependencies = array_merge(this->_dependencies, subCompiler->getDependencies()),
+			this->_dependencies[path] = "include",
+			this->_fragments = array_merge(this->_fragments, subCompiler->_fragments),
+			this->_includeNumber = subCompiler->_includeNumber;
+
+		return compilation;
+	}
+
+	/**
+	 * Compiles the source of an inlined template keeping the current loop level
+	 */
+	protected function _compileNested(string! path, string! viewCode) -> string
+	{
+		var compilation;
+
+		let this->_extended = false,
+			this->_extendedBlocks = false,
+			this->_blocks = null,
+			this->_level = 0,
+			this->_blockLevel = 0,
+			this->_exprLevel = 0,
+			this->_currentPath = path;
+
+		let compilation = this->_compileSource(viewCode, false);
+		if typeof compilation != "string" {
+			return "";
+		}
+
+		return compilation;
+	}
+
 	/**
 	 * Compiles macros
 	 */
@@ -2104,9 +2842,19 @@ class Compiler implements InjectionAwareInterface
 					/**
 					 * Perform a subcompilation of the extended file
 					 */
-					let subCompiler = clone this;
+					let subCompiler = clone this,
+						subCompiler->_nested = true;
 					let tempCompilation = subCompiler->compile(finalPath, extended);
 
+					/**
+					 * The compilation depends on the extended file and everything it depends on
+					 */
+					let this->_dependencies = array_merge(this->_dependencies, subCompiler->getDependencies()),
+						this->_dependencies[finalPath] = "extends",
+						this->_fragments = array_merge(this->_fragments, subCompiler->_fragments),
+						this->_hoistedNumber = subCompiler->_hoistedNumber,
+						this->_includeNumber = subCompiler->_includeNumber;
+
 					/**
 					 * If the compilation doesn't return anything we include the compiled path
 					 */
@@ -2205,141 +2953,787 @@ class Compiler implements InjectionAwareInterface
 	}
 
 	/**
-	 * Compiles a Volt source code returning a PHP plain version
+	 * Runs the optimisation passes over a list of statements before generating any code
 	 */
-	protected function _compileSource(string! viewCode, boolean extendsMode = false) -> string
+	protected function _optimizeStatements(array! statements, var autoescape) -> array
 	{
-		var currentPath, intermediate, extended,
-			finalCompilation, blocks, extendedBlocks, name, block,
-			blockCompilation, localBlock, compilation, options, autoescape;
+		var optimized, statement, type, assignments, assignment, position,
+			blockStatements, falseStatements;
 
-		let currentPath = this->_currentPath;
+		let optimized = [];
 
-		/**
-		 * Check for compilation options
-		 */
-		let options = this->_options;
-		if typeof options == "array" {
+		for statement in statements {
 
-			/**
-			 * Enable autoescape globally
-			 */
-			if fetch autoescape, options["autoescape"] {
-				if typeof autoescape != "bool" {
-					throw new Exception("'autoescape' must be boolean");
-				}
-				let this->_autoescape = autoescape;
+			if typeof statement != "array" {
+				let optimized[] = statement;
+				continue;
 			}
-		}
-
-		let intermediate = phvolt_parse_view(viewCode, currentPath);
-
-		/**
-		 * The parsing must return a valid array
-		 */
-		if typeof intermediate != "array" {
-			throw new Exception("Invalid intermediate representation");
-		}
-
-		let compilation = this->_statementList(intermediate, extendsMode);
-
-		/**
-		 * Check if the template is extending another
-		 */
-		let extended = this->_extended;
-		if extended === true {
 
-			/**
-			 * Multiple-Inheritance is allowed
-			 */
-			if extendsMode === true {
-				let finalCompilation = [];
-			} else {
-				let finalCompilation = null;
+			if !fetch type, statement["type"] {
+				let optimized[] = statement;
+				continue;
 			}
 
-			let blocks = this->_blocks;
-			let extendedBlocks = this->_extendedBlocks;
+			switch type {
 
-			for name, block in extendedBlocks {
+				case PHVOLT_T_ECHO:
+				case PHVOLT_T_ELSEIF:
+				case PHVOLT_T_DO:
+				case PHVOLT_T_RETURN:
+					if isset statement["expr"] {
+						let statement["expr"] = this->_foldExpression(statement["expr"]);
+					}
+					break;
 
-				/**
-				 * If name is a string then is a block name
-				 */
-				if typeof name == "string" {
+				case PHVOLT_T_SET:
+					if fetch assignments, statement["assignments"] {
+						for position, assignment in assignments {
+							let assignment["expr"] = this->_foldExpression(assignment["expr"]),
+								assignments[position] = assignment;
+						}
+						let statement["assignments"] = assignments;
+					}
+					break;
 
-					if isset blocks[name] {
-						/**
-						 * The block is set in the local template
-						 */
-						let localBlock = blocks[name],
-							this->_currentBlock = name,
-							blockCompilation = this->_statementList(localBlock);
-					} else {
-						if typeof block == "array" {
-							/**
-							 * The block is not set local only in the extended template
-							 */
-							let blockCompilation = this->_statementList(block);
-						} else {
-							let blockCompilation = block;
+				case PHVOLT_T_IF:
+					let statement["expr"] = this->_foldExpression(statement["expr"]),
+						statement["true_statements"] = this->_optimizeStatements(statement["true_statements"], autoescape);
+					if fetch falseStatements, statement["false_statements"] {
+						let statement["false_statements"] = this->_optimizeStatements(falseStatements, autoescape);
+					}
+					break;
+
+				case PHVOLT_T_FOR:
+					let statement["expr"] = this->_foldExpression(statement["expr"]);
+					if fetch blockStatements, statement["block_statements"] {
+						if typeof blockStatements == "array" {
+							let statement["block_statements"] = this->_optimizeStatements(blockStatements, autoescape),
+								statement = this->_hoistInvariants(statement);
 						}
 					}
+					break;
 
-					if extendsMode === true {
-						let finalCompilation[name] = blockCompilation;
-					} else {
-						let finalCompilation .= blockCompilation;
+				case PHVOLT_T_AUTOESCAPE:
+					if fetch blockStatements, statement["block_statements"] {
+						if typeof blockStatements == "array" {
+							let statement["block_statements"] = this->_optimizeStatements(blockStatements, statement["enable"]);
+						}
 					}
-				} else {
+					break;
 
-					/**
-					 * Here the block is an already compiled text
-					 */
-					if extendsMode === true {
-						let finalCompilation[] = block;
-					} else {
-						let finalCompilation .= block;
+				case PHVOLT_T_BLOCK:
+				case PHVOLT_T_CACHE:
+				case PHVOLT_T_MACRO:
+					if fetch blockStatements, statement["block_statements"] {
+						if typeof blockStatements == "array" {
+							let statement["block_statements"] = this->_optimizeStatements(blockStatements, autoescape);
+						}
 					}
-				}
+					break;
 			}
 
-			return finalCompilation;
+			let optimized[] = statement;
 		}
 
-		if extendsMode === true {
-			/**
-			 * In extends mode we return the template blocks instead of the compilation
-			 */
-			return this->_blocks;
-		}
-		return compilation;
+		return this->_coalesceOutput(optimized, autoescape);
 	}
 
 	/**
-	 * Compiles a template into a string
-	 *
-	 *<code>
-	 * echo $compiler->compileString('{{ "hello world" }}');
-	 *</code>
+	 * Checks if a statement only produces output and can be merged with its neighbours
 	 */
-	public function compileString(string! viewCode, boolean extendsMode = false) -> string
+	protected function _isOutputStatement(var statement, var autoescape) -> boolean
 	{
-		let this->_currentPath = "eval code";
-		return this->_compileSource(viewCode, extendsMode);
-	}
+		var type, expr, name;
 
-	/**
-	 * Compiles a template into a file forcing the destination path
-	 *
-	 *<code>
-	 *	$compiler->compile('views/layouts/main.volt', 'views/layouts/main.volt.php');
-	 *</code>
-	 *
-	 * @param string path
-	 * @param string compiledPath
-	 * @param boolean extendsMode
-	 * @return string|array
+		if typeof statement != "array" {
+			return false;
+		}
+
+		if !fetch type, statement["type"] {
+			return false;
+		}
+
+		if type == PHVOLT_T_RAW_FRAGMENT {
+			return true;
+		}
+
+		/**
+		 * Escaped output is left as it is, escaping concatenated values isn't always
+		 * the same as escaping them separately
+		 */
+		if type != PHVOLT_T_ECHO || autoescape {
+			return false;
+		}
+
+		let expr = statement["expr"];
+		if expr["type"] == PHVOLT_T_FCALL {
+			let name = expr["name"];
+			if name["type"] == PHVOLT_T_IDENTIFIER && name["value"] == "super" {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Merges adjacent raw fragments and echo statements. Literal values become part of the
+	 * raw text and the rest is written by a single echo statement
+	 */
+	protected function _coalesceOutput(array! statements, var autoescape) -> array
+	{
+		var coalesced, run, statement;
+
+		let coalesced = [], run = [];
+
+		for statement in statements {
+
+			if this->_isOutputStatement(statement, autoescape) {
+				let run[] = statement;
+				continue;
+			}
+
+			if count(run) {
+				let coalesced = array_merge(coalesced, this->_coalesceRun(run)),
+					run = [];
+			}
+
+			let coalesced[] = statement;
+		}
+
+		if count(run) {
+			let coalesced = array_merge(coalesced, this->_coalesceRun(run));
+		}
+
+		return coalesced;
+	}
+
+	/**
+	 * Produces a single echo statement, surrounded by the leading and trailing raw text, for
+	 * a list of adjacent output statements
+	 */
+	protected function _coalesceRun(array! run) -> array
+	{
+		var pieces, statement, first, text, value, afterEcho, items, piece,
+			leadingText, trailingText, node, coalesced;
+
+		if count(run) < 2 {
+			let statement = run[0];
+			if statement["type"] == PHVOLT_T_RAW_FRAGMENT {
+				return run;
+			}
+		}
+
+		let pieces = [], text = "", afterEcho = false;
+
+		for statement in run {
+
+			if statement["type"] == PHVOLT_T_RAW_FRAGMENT {
+
+				let value = statement["value"];
+
+				/**
+				 * PHP eats the newline that follows a closing tag
+				 */
+				if afterEcho {
+					if substr(value, 0, 2) == "\r\n" {
+						let value = substr(value, 2);
+					} else {
+						if substr(value, 0, 1) == "\n" {
+							let value = substr(value, 1);
+						}
+					}
+				}
+
+				let text .= value, afterEcho = false;
+				continue;
+			}
+
+			let value = this->_getLiteral(statement["expr"]),
+				afterEcho = true;
+
+			/**
+			 * Literals that could form an opening tag in the raw text are still echoed
+			 */
+			if typeof value != "null" {
+				if strpos(value, "<?") === false && substr(value, -1) != "<" && !(substr(text, -1) == "<" && substr(value, 0, 1) == "?") {
+					let text .= value;
+					continue;
+				}
+			}
+
+			if text !== "" {
+				let pieces[] = text, text = "";
+			}
+
+			let pieces[] = statement["expr"];
+		}
+
+		if text !== "" {
+			let pieces[] = text;
+		}
+
+		let first = run[0], leadingText = null;
+
+		/**
+		 * The text before the first echo is kept as a raw fragment, unless it starts with a
+		 * newline that would be eaten after a previous closing tag
+		 */
+		if count(pieces) {
+			let piece = pieces[0];
+			if typeof piece == "string" {
+				if first["type"] == PHVOLT_T_RAW_FRAGMENT || (substr(piece, 0, 1) != "\n" && substr(piece, 0, 1) != "\r") {
+					let leadingText = array_shift(pieces);
+				}
+			}
+		}
+
+		/**
+		 * The text after the last echo is kept as a raw fragment too, a newline is added
+		 * in front of it to replace the one eaten by the closing tag
+		 */
+		let trailingText = null;
+		if count(pieces) > 1 {
+			let piece = pieces[count(pieces) - 1];
+			if typeof piece == "string" {
+				let trailingText = array_pop(pieces);
+				if substr(trailingText, 0, 1) == "\n" || substr(trailingText, 0, 1) == "\r" {
+					let trailingText = "\n" . trailingText;
+				}
+			}
+		}
+
+		let items = [];
+		for piece in pieces {
+			if typeof piece == "string" {
+				let items[] = ["expr": this->_getLiteralNode(piece, first)];
+			} else {
+				let items[] = ["expr": piece];
+			}
+		}
+
+		let coalesced = [];
+
+		if typeof leadingText == "string" {
+			let node = ["type": PHVOLT_T_RAW_FRAGMENT, "value": leadingText];
+			if isset first["file"] {
+				let node["file"] = first["file"], node["line"] = first["line"];
+			}
+			let coalesced[] = node;
+		}
+
+		if count(items) {
+			if count(items) == 1 {
+				let piece = items[0],
+					node = ["type": PHVOLT_T_ECHO, "expr": piece["expr"]];
+			} else {
+				let node = ["type": PHVOLT_T_ECHO, "expr": items];
+			}
+			if isset first["file"] {
+				let node["file"] = first["file"], node["line"] = first["line"];
+			}
+			let coalesced[] = node;
+		}
+
+		if typeof trailingText == "string" {
+			let node = ["type": PHVOLT_T_RAW_FRAGMENT, "value": trailingText];
+			if isset first["file"] {
+				let node["file"] = first["file"], node["line"] = first["line"];
+			}
+			let coalesced[] = node;
+		}
+
+		return coalesced;
+	}
+
+	/**
+	 * Replaces the loop-invariant expressions in the statements executed by every iteration of a
+	 * "for" by temporary variables, these are calculated once in the first iteration
+	 */
+	protected function _hoistInvariants(array! statement) -> array
+	{
+		var variant, blockStatements, position, bstatement, type, key, hoisted;
+
+		let blockStatements = statement["block_statements"];
+
+		/**
+		 * Variables assigned, iterated or passed to functions in the loop aren't invariant
+		 */
+		let variant = this->_collectVariant(blockStatements, ["loop": true]);
+
+		/**
+		 * Includes and the statements not known by the optimizer could change any variable
+		 */
+		if variant === false {
+			return statement;
+		}
+
+		let variant[statement["variable"]] = true;
+
+		if fetch key, statement["key"] {
+			let variant[key] = true;
+		}
+
+		let hoisted = [];
+
+		for position, bstatement in blockStatements {
+
+			let type = bstatement["type"];
+
+			if type == PHVOLT_T_RAW_FRAGMENT || type == PHVOLT_T_SET {
+				continue;
+			}
+
+			if type != PHVOLT_T_ECHO && type != PHVOLT_T_IF {
+				break;
+			}
+
+			let this->_hoisted = hoisted,
+				bstatement["expr"] = this->_hoistExpression(bstatement["expr"], variant),
+				hoisted = this->_hoisted,
+				blockStatements[position] = bstatement;
+
+			/**
+			 * Statements after a condition may not run in every iteration
+			 */
+			if type == PHVOLT_T_IF {
+				break;
+			}
+		}
+
+		let this->_hoisted = null;
+
+		if count(hoisted) {
+			let statement["block_statements"] = blockStatements,
+				statement["hoisted"] = hoisted;
+		}
+
+		return statement;
+	}
+
+	/**
+	 * Moves the invariant parts of an expression to the list of hoisted expressions
+	 */
+	protected function _hoistExpression(var expr, array! variant)
+	{
+		var type, left, right, name, file, position, item;
+
+		if typeof expr != "array" {
+			return expr;
+		}
+
+		/**
+		 * Lists of values written by the same echo
+		 */
+		if !fetch type, expr["type"] {
+			for position, item in expr {
+				let item["expr"] = this->_hoistExpression(item["expr"], variant),
+					expr[position] = item;
+			}
+			return expr;
+		}
+
+		if this->_isInvariant(expr, variant) {
+
+			/**
+			 * Plain variables and literals are already cheap
+			 */
+			if type == PHVOLT_T_IDENTIFIER || type == PHVOLT_T_STRING || type == 258 || type == 259 || type == PHVOLT_T_NULL || type == PHVOLT_T_FALSE || type == PHVOLT_T_TRUE {
+				return expr;
+			}
+
+			let this->_hoistedNumber++,
+				name = "$__h" . this->_hoistedNumber,
+				this->_hoisted[name] = expr;
+
+			if fetch file, expr["file"] {
+				return ["type": PHVOLT_T_RESOLVED_EXPR, "value": name, "file": file, "line": expr["line"]];
+			}
+			return ["type": PHVOLT_T_RESOLVED_EXPR, "value": name];
+		}
+
+		/**
+		 * Only the operands that are always evaluated can be hoisted
+		 */
+		if type == PHVOLT_T_TERNARY {
+			let expr["ternary"] = this->_hoistExpression(expr["ternary"], variant);
+			return expr;
+		}
+
+		if fetch left, expr["left"] {
+			let expr["left"] = this->_hoistExpression(left, variant);
+		}
+
+		switch type {
+			case PHVOLT_T_DOT:
+			case PHVOLT_T_IS:
+			case PHVOLT_T_AND:
+			case 267:
+			case 124:
+				break;
+			default:
+				if fetch right, expr["right"] {
+					let expr["right"] = this->_hoistExpression(right, variant);
+				}
+		}
+
+		return expr;
+	}
+
+	/**
+	 * Checks if an expression is free of side effects and doesn't depend on variables changed by a loop
+	 */
+	protected function _isInvariant(var expr, array! variant) -> boolean
+	{
+		var type, left, right, item;
+
+		if typeof expr != "array" {
+			return false;
+		}
+
+		if !fetch type, expr["type"] {
+			return false;
+		}
+
+		if !fetch left, expr["left"] {
+			let left = null;
+		}
+
+		if !fetch right, expr["right"] {
+			let right = null;
+		}
+
+		switch type {
+
+			case 258:
+			case 259:
+			case PHVOLT_T_STRING:
+			case PHVOLT_T_NULL:
+			case PHVOLT_T_FALSE:
+			case PHVOLT_T_TRUE:
+				return true;
+
+			case PHVOLT_T_IDENTIFIER:
+				return !isset variant[expr["value"]];
+
+			case PHVOLT_T_DOT:
+				if typeof right != "array" || right["type"] != PHVOLT_T_IDENTIFIER {
+					return false;
+				}
+				return this->_isInvariant(left, variant);
+
+			case 124:
+				if !this->_isPureFilter(right) {
+					return false;
+				}
+				return this->_isInvariant(left, variant);
+
+			case PHVOLT_T_NOT:
+			case PHVOLT_T_MINUS:
+			case PHVOLT_T_PLUS:
+				return this->_isInvariant(right, variant);
+
+			case PHVOLT_T_ENCLOSED:
+				return this->_isInvariant(left, variant);
+
+			case PHVOLT_T_TERNARY:
+				if !this->_isInvariant(expr["ternary"], variant) {
+					return false;
+				}
+				return this->_isInvariant(left, variant) && this->_isInvariant(right, variant);
+
+			case PHVOLT_T_ARRAY:
+				if typeof left == "array" {
+					for item in left {
+						if !this->_isInvariant(item["expr"], variant) {
+							return false;
+						}
+					}
+				}
+				return true;
+
+			case PHVOLT_T_ADD:
+			case PHVOLT_T_SUB:
+			case PHVOLT_T_MUL:
+			case PHVOLT_T_DIV:
+			case 37:
+			case 126:
+			case 278:
+			case PHVOLT_T_AND:
+			case 267:
+			case PHVOLT_T_LESS:
+			case 62:
+			case PHVOLT_T_LESSEQUAL:
+			case 271:
+			case 272:
+			case 273:
+			case 274:
+			case 275:
+			case PHVOLT_T_ARRAYACCESS:
+				return this->_isInvariant(left, variant) && this->_isInvariant(right, variant);
+		}
+
+		return false;
+	}
+
+	/**
+	 * Collects the names of the variables a list of statements may change,
+	 * returns false if any variable could be changed by them
+	 */
+	protected function _collectVariant(var node, array! variant) -> array | boolean
+	{
+		var type, assignments, assignment, key, child, collected;
+
+		if typeof node != "array" {
+			return variant;
+		}
+
+		if fetch type, node["type"] {
+
+			switch type {
+
+				/**
+				 * Arguments passed to functions or methods could be changed by them
+				 */
+				case PHVOLT_T_FCALL:
+				case PHVOLT_T_DO:
+					return this->_collectIdentifiers(node, variant);
+
+				case PHVOLT_T_SET:
+					if fetch assignments, node["assignments"] {
+						for assignment in assignments {
+							let variant = this->_collectIdentifiers(assignment["variable"], variant);
+						}
+					}
+					break;
+
+				case PHVOLT_T_FOR:
+					let variant[node["variable"]] = true;
+					if fetch key, node["key"] {
+						let variant[key] = true;
+					}
+					break;
+
+				case PHVOLT_T_IF:
+				case PHVOLT_T_ELSEIF:
+				case PHVOLT_T_ECHO:
+				case PHVOLT_T_RAW_FRAGMENT:
+				case PHVOLT_T_AUTOESCAPE:
+				case PHVOLT_T_CONTINUE:
+				case PHVOLT_T_BREAK:
+				case 321:
+				case 358:
+					break;
+
+				default:
+					/**
+					 * Includes share the symbol table and other statements aren't analyzed
+					 */
+					if (type >= PHVOLT_T_IF && type <= PHVOLT_T_RETURN) || type == 400 {
+						return false;
+					}
+			}
+		}
+
+		for child in node {
+			if typeof child == "array" {
+				let collected = this->_collectVariant(child, variant);
+				if collected === false {
+					return false;
+				}
+				let variant = collected;
+			}
+		}
+
+		return variant;
+	}
+
+	/**
+	 * Collects the names of the identifiers found in a node
+	 */
+	protected function _collectIdentifiers(var node, array! variant) -> array
+	{
+		var type, child;
+
+		if typeof node != "array" {
+			return variant;
+		}
+
+		if fetch type, node["type"] {
+			if type == PHVOLT_T_IDENTIFIER {
+				let variant[node["value"]] = true;
+				return variant;
+			}
+		}
+
+		for child in node {
+			if typeof child == "array" {
+				let variant = this->_collectIdentifiers(child, variant);
+			}
+		}
+
+		return variant;
+	}
+
+	/**
+	 * Compiles a Volt source code returning a PHP plain version
+	 */
+	protected function _compileSource(string! viewCode, boolean extendsMode = false) -> string
+	{
+		var currentPath, intermediate, extended,
+			finalCompilation, blocks, extendedBlocks, name, block,
+			blockCompilation, localBlock, compilation, options, autoescape, optimize;
+
+		let currentPath = this->_currentPath,
+			this->_temporaryNumber = 0,
+			this->_dependencies = [],
+			this->_fragments = [],
+			optimize = false;
+
+		/**
+		 * Check for compilation options
+		 */
+		let options = this->_options;
+		if typeof options == "array" {
+
+			/**
+			 * Enable autoescape globally
+			 */
+			if fetch autoescape, options["autoescape"] {
+				if typeof autoescape != "bool" {
+					throw new Exception("'autoescape' must be boolean");
+				}
+				let this->_autoescape = autoescape;
+			}
+
+			/**
+			 * Run the optimisation passes over the intermediate representation
+			 */
+			if fetch optimize, options["optimize"] {
+				if typeof optimize != "bool" {
+					throw new Exception("'optimize' must be boolean");
+				}
+			}
+		}
+
+		let intermediate = phvolt_parse_view(viewCode, currentPath);
+
+		/**
+		 * The parsing must return a valid array
+		 */
+		if typeof intermediate != "array" {
+			throw new Exception("Invalid intermediate representation");
+		}
+
+		/**
+		 * Extensions could compile statements and expressions by themselves so the
+		 * intermediate representation is only optimised without them
+		 */
+		if optimize === true && typeof this->_extensions != "array" {
+			let intermediate = this->_optimizeStatements(intermediate, this->_autoescape);
+		}
+
+		let compilation = this->_statementList(intermediate, extendsMode);
+
+		/**
+		 * Check if the template is extending another
+		 */
+		let extended = this->_extended;
+		if extended === true {
+
+			/**
+			 * Multiple-Inheritance is allowed
+			 */
+			if extendsMode === true {
+				let finalCompilation = [];
+			} else {
+				let finalCompilation = null;
+			}
+
+			let blocks = this->_blocks;
+			let extendedBlocks = this->_extendedBlocks;
+
+			for name, block in extendedBlocks {
+
+				/**
+				 * If name is a string then is a block name
+				 */
+				if typeof name == "string" {
+
+					if isset blocks[name] {
+						/**
+						 * The block is set in the local template
+						 */
+						let localBlock = blocks[name],
+							this->_currentBlock = name,
+							blockCompilation = this->_statementList(localBlock);
+					} else {
+						if typeof block == "array" {
+							/**
+							 * The block is not set local only in the extended template
+							 */
+							let blockCompilation = this->_statementList(block);
+						} else {
+							let blockCompilation = block;
+						}
+					}
+
+					if extendsMode === true {
+						let finalCompilation[name] = blockCompilation;
+					} else {
+						let finalCompilation .= blockCompilation;
+					}
+				} else {
+
+					/**
+					 * Here the block is an already compiled text
+					 */
+					if extendsMode === true {
+						let finalCompilation[] = block;
+					} else {
+						let finalCompilation .= block;
+					}
+				}
+			}
+
+			return finalCompilation;
+		}
+
+		if extendsMode === true {
+			/**
+			 * In extends mode we return the template blocks instead of the compilation
+			 */
+			return this->_blocks;
+		}
+		return compilation;
+	}
+
+	/**
+	 * Compiles a template into a string
+	 *
+	 *<code>
+	 * echo $compiler->compileString('{{ "hello world" }}');
+	 *</code>
+	 */
+	public function compileString(string! viewCode, boolean extendsMode = false) -> string
+	{
+		let this->_currentPath = "eval code",
+			this->_hoistedNumber = 0,
+			this->_includeNumber = 0;
+		return this->_compilePrefetch(this->_compileSource(viewCode, extendsMode));
+	}
+
+	/**
+	 * Compiles a template into a file forcing the destination path
+	 *
+	 *<code>
+	 *	$compiler->compile('views/layouts/main.volt', 'views/layouts/main.volt.php');
+	 *</code>
+	 *
+	 * @param string path
+	 * @param string compiledPath
+	 * @param boolean extendsMode
+	 * @return string|array
 	 */
 	public function compileFile(string! path, string! compiledPath, boolean extendsMode = false)
 	{
@@ -2364,8 +3758,16 @@ class Compiler implements InjectionAwareInterface
 			throw new Exception("Template file " . path . " could not be opened");
 		}
 
+		/**
+		 * Templates compiled by the includes and extends of another one keep numbering its variables
+		 */
+		if !this->_nested {
+			let this->_hoistedNumber = 0,
+				this->_includeNumber = 0;
+		}
+
 		let this->_currentPath = path;
-		let compilation = this->_compileSource(viewCode, extendsMode);
+		let compilation = this->_compilePrefetch(this->_compileSource(viewCode, extendsMode));
 
 		/**
 		 * We store the file serialized if it's an array of blocks
@@ -2399,7 +3801,7 @@ class Compiler implements InjectionAwareInterface
 	{
 		var stat, compileAlways, prefix, compiledPath, compiledSeparator, blocksCode,
 			compiledExtension, compilation, options, realCompiledPath,
-			compiledTemplatePath, templateSepPath;
+			compiledTemplatePath, templateSepPath, manifestPath;
 
 		/**
 		 * Re-initialize some properties already initialized when the object is cloned
@@ -2411,6 +3813,7 @@ class Compiler implements InjectionAwareInterface
 		let this->_foreachLevel = 0;
 		let this->_blockLevel = 0;
 		let this->_exprLevel = 0;
+		let this->_dependencies = [];
 
 		let stat = true;
 		let compileAlways = false;
@@ -2419,6 +3822,7 @@ class Compiler implements InjectionAwareInterface
 		let compiledSeparator = "%%";
 		let compiledExtension = ".php";
 		let compilation = null;
+		let manifestPath = null;
 
 		let options = this->_options;
 		if typeof options == "array" {
@@ -2481,6 +3885,16 @@ class Compiler implements InjectionAwareInterface
 			if isset options["stat"] {
 				let stat = options["stat"];
 			}
+
+			/**
+			 * The manifest records the files every compiled template depends on
+			 */
+			if isset options["manifest"] {
+				let manifestPath = options["manifest"];
+				if typeof manifestPath != "string" {
+					throw new Exception("'manifest' must be a string");
+				}
+			}
 		}
 
 		/**
@@ -2537,6 +3951,15 @@ class Compiler implements InjectionAwareInterface
 		 */
 		let realCompiledPath = compiledTemplatePath;
 
+		/**
+		 * The manifest replaces the checks on the compiled file, templates are recompiled
+		 * when they or any of their dependencies change
+		 */
+		if typeof manifestPath == "string" && !compileAlways {
+			let this->_compiledTemplatePath = realCompiledPath;
+			return this->_compileWithManifest(manifestPath, templatePath, realCompiledPath, extendsMode, stat);
+		}
+
 		if compileAlways {
 
 			/**
@@ -2598,6 +4021,204 @@ class Compiler implements InjectionAwareInterface
 		return compilation;
 	}
 
+	/**
+	 * Compiles a template only if the manifest says it's outdated, updating its entry afterwards.
+	 * With "stat" disabled the entries of the manifest are trusted without checking the sources
+	 *
+	 * @return string|array
+	 */
+	protected function _compileWithManifest(string! manifestPath, string! templatePath, string! compiledPath, boolean extendsMode, boolean stat = true)
+	{
+		var manifest, entry, path, modificationTime, blocksCode, compilation,
+			dependencies, modificationTimes;
+
+		let manifest = this->_readManifest(manifestPath);
+
+		if fetch entry, manifest[compiledPath] {
+
+			let compilation = null;
+
+			if stat {
+				for path, modificationTime in entry["mtimes"] {
+					if this->_getModificationTime(path) !== modificationTime {
+						let compilation = false;
+						break;
+					}
+				}
+			}
+
+			if compilation !== false {
+
+				let this->_dependencies = entry["dependencies"];
+
+				if extendsMode === true {
+
+					/**
+					 * In extends mode we read the file that must contains a serialized array of blocks
+					 */
+					let blocksCode = file_get_contents(compiledPath);
+					if blocksCode === false {
+						throw new Exception("Extends compilation file " . compiledPath . " could not be opened");
+					}
+
+					if blocksCode {
+						return unserialize(blocksCode);
+					}
+					return [];
+				}
+
+				return null;
+			}
+		}
+
+		let compilation = this->compileFile(templatePath, compiledPath, extendsMode);
+
+		/**
+		 * Store the modification times the compilation is based on
+		 */
+		let dependencies = this->_dependencies,
+			modificationTimes = [];
+
+		let modificationTimes[templatePath] = this->_getModificationTime(templatePath);
+		for path in array_keys(dependencies) {
+			let modificationTimes[path] = this->_getModificationTime(path);
+		}
+
+		this->_writeManifest(manifestPath, compiledPath, [
+			"path":         templatePath,
+			"dependencies": dependencies,
+			"mtimes":       modificationTimes
+		]);
+
+		return compilation;
+	}
+
+	/**
+	 * Returns the modification time of a source file, every file is checked once per request
+	 *
+	 * @return int|boolean
+	 */
+	protected function _getModificationTime(string! path)
+	{
+		var modificationTimes, modificationTime;
+
+		let modificationTimes = self::_modificationTimes;
+		if typeof modificationTimes == "array" {
+			if fetch modificationTime, modificationTimes[path] {
+				return modificationTime;
+			}
+		}
+
+		if file_exists(path) {
+			let modificationTime = filemtime(path);
+		} else {
+			let modificationTime = false;
+		}
+
+		let self::_modificationTimes[path] = modificationTime;
+
+		return modificationTime;
+	}
+
+	/**
+	 * Forgets the manifests and the modification times read in the current request,
+	 * long running processes can call it to check the templates again
+	 */
+	public static function clearManifests() -> void
+	{
+		let self::_manifests = null,
+			self::_modificationTimes = null;
+	}
+
+	/**
+	 * Reads a manifest, it's loaded only once per request
+	 */
+	protected function _readManifest(string! manifestPath) -> array
+	{
+		var manifests, manifest;
+
+		let manifests = self::_manifests;
+		if typeof manifests == "array" {
+			if fetch manifest, manifests[manifestPath] {
+				return manifest;
+			}
+		}
+
+		let manifest = this->_loadManifest(manifestPath),
+			self::_manifests[manifestPath] = manifest;
+
+		return manifest;
+	}
+
+	/**
+	 * Loads a manifest from the disk, it's stored serialized instead of as PHP code so opcache
+	 * never returns an outdated copy of it
+	 */
+	protected function _loadManifest(string! manifestPath) -> array
+	{
+		var contents, manifest;
+
+		if !file_exists(manifestPath) {
+			return [];
+		}
+
+		/**
+		 * Use file_get_contents to respect the open_basedir directive
+		 */
+		let contents = file_get_contents(manifestPath);
+		if !contents {
+			return [];
+		}
+
+		let manifest = unserialize(contents);
+		if typeof manifest != "array" {
+			return [];
+		}
+
+		return manifest;
+	}
+
+	/**
+	 * Stores the entry of a compiled template in the manifest
+	 */
+	protected function _writeManifest(string! manifestPath, string! compiledPath, array! entry) -> void
+	{
+		var manifest, temporaryFile;
+
+		/**
+		 * Other requests could have updated the manifest since it was read
+		 */
+		let manifest = this->_loadManifest(manifestPath),
+			manifest[compiledPath] = entry,
+			self::_manifests[manifestPath] = manifest;
+
+		/**
+		 * The manifest is written to a temporary file and renamed so concurrent requests never read a partial file
+		 */
+		let temporaryFile = manifestPath . "." . uniqid() . ".tmp";
+		if file_put_contents(temporaryFile, serialize(manifest)) === false {
+			throw new Exception("Volt manifest '" . manifestPath . "' can't be written");
+		}
+
+		if !rename(temporaryFile, manifestPath) {
+			unlink(temporaryFile);
+			throw new Exception("Volt manifest '" . manifestPath . "' can't be written");
+		}
+	}
+
+	/**
+	 * Returns the files extended or included by the last compiled template
+	 *
+	 *<code>
+	 *	$compiler->compile('views/index/index.volt');
+	 *	print_r($compiler->getDependencies()); // ['views/layouts/main.volt' => 'extends']
+	 *</code>
+	 */
+	public function getDependencies() -> array
+	{
+		return this->_dependencies;
+	}
+
 	/**
 	 * Returns the path that is currently being compiled
 	 */
@@ -21,6 +21,7 @@ namespace Phalcon\Queue;
 
 use Phalcon\Queue\Beanstalk\Job;
 use Phalcon\Queue\Beanstalk\Exception;
+use Phalcon\Cache\FrontendInterface;
 
 /**
  * Phalcon\Queue\Beanstalk
@@ -35,9 +36,13 @@ use Phalcon\Queue\Beanstalk\Exception;
  *     'host'       => '127.0.0.1',
  *     'port'       => 11300,
  *     'persistent' => true,
+ *     'serializer' => 'json',
  * ]);
  * </code>
  *
+ * Job bodies are serialized with "php" by default, "json", "igbinary" and "none" (raw strings)
+ * are also available, as well as any Phalcon\Cache\FrontendInterface
+ *
  * @link http://www.igvita.com/2010/05/20/scalable-work-queues-with-beanstalk/
  */
 class Beanstalk
@@ -46,6 +51,8 @@ class Beanstalk
 
 	protected _parameters;
 
+	protected _serializer = "php";
+
 	/**
 	 * Phalcon\Queue\Beanstalk
 	 *
@@ -69,9 +76,40 @@ class Beanstalk
 			let parameters["port"] = 11300;
 		}
 
+		if isset parameters["serializer"] {
+			this->setSerializer(parameters["serializer"]);
+		}
+
 		let this->_parameters = parameters;
 	}
 
+	/**
+	 * Sets how job bodies are serialized: "php", "json", "igbinary", "none" or a Phalcon\Cache\FrontendInterface
+	 */
+	public function setSerializer(var serializer) -> <Beanstalk>
+	{
+		if typeof serializer == "object" {
+			if !(serializer instanceof FrontendInterface) {
+				throw new Exception("The serializer must implement Phalcon\\Cache\\FrontendInterface");
+			}
+		} else {
+			if !in_array(serializer, ["php", "json", "igbinary", "none"], true) {
+				throw new Exception("Unknown serializer '" . serializer . "'");
+			}
+		}
+
+		let this->_serializer = serializer;
+		return this;
+	}
+
+	/**
+	 * Returns the serializer used for job bodies
+	 */
+	public function getSerializer() -> string|<FrontendInterface>
+	{
+		return this->_serializer;
+	}
+
 	/**
 	 * Makes a connection to the Beanstalkd server
 	 */
@@ -117,7 +155,101 @@ class Beanstalk
 	 */
 	public function put(var data, array options = null) -> string|boolean
 	{
-		var priority, delay, ttr, serialized, response, status, length;
+		var response, status;
+
+		/**
+		 * The command and the body are sent in the same packet
+		 */
+		this->write(this->_putCommand(data, options));
+
+		let response = this->readStatus();
+		let status = response[0];
+
+		if status != "INSERTED" && status != "BURIED" {
+			return false;
+		}
+
+		return response[1];
+	}
+
+	/**
+	 * Inserts several jobs into the queue. The commands are pipelined, a window of jobs is written
+	 * at once and then its responses are read, the option "pipeline" sets the size of the window.
+	 * Returns the ids of the jobs with the same keys as the passed jobs, false for the ones that weren't inserted
+	 *
+	 * <code>
+	 * $ids = $queue->putMany([$job1, $job2, $job3], ['priority' => 10]);
+	 * </code>
+	 */
+	public function putMany(array! jobs, array options = null) -> array
+	{
+		var pipeline, keys, key, packet, ids, data;
+		int window;
+
+		if !fetch pipeline, options["pipeline"] {
+			let pipeline = 256;
+		}
+
+		let window = (int) pipeline;
+		if window < 1 {
+			let window = 1;
+		}
+
+		let ids = [],
+			keys = [],
+			packet = "";
+
+		for key, data in jobs {
+
+			let keys[] = key;
+			if packet === "" {
+				let packet = this->_putCommand(data, options);
+			} else {
+				let packet .= "\r\n" . this->_putCommand(data, options);
+			}
+
+			if count(keys) == window {
+				let ids = this->_writePipeline(packet, keys, ids),
+					keys = [],
+					packet = "";
+			}
+		}
+
+		if count(keys) {
+			let ids = this->_writePipeline(packet, keys, ids);
+		}
+
+		return ids;
+	}
+
+	/**
+	 * Writes a window of "put" commands and reads their responses, which arrive in the same order
+	 */
+	protected function _writePipeline(string! packet, array! keys, array! ids) -> array
+	{
+		var key, response, status;
+
+		this->write(packet);
+
+		for key in keys {
+			let response = this->readStatus(),
+				status = response[0];
+			if status == "INSERTED" || status == "BURIED" {
+				let ids[key] = response[1];
+			} else {
+				let ids[key] = false;
+			}
+		}
+
+		return ids;
+	}
+
+	/**
+	 * Builds the "put" command followed by the serialized body
+	 */
+	protected function _putCommand(var data, var options) -> string
+	{
+		var priority, delay, ttr, serialized;
 
 		/**
 		 * Priority is 100 by default
@@ -137,23 +269,9 @@ class Beanstalk
 		/**
 		 * Data is automatically serialized before be sent to the server
 		 */
-		let serialized = serialize(data);
-
-		/**
-		 * Create the command
-		 */
-		let length = strlen(serialized);
-		this->write("put " . priority . " " . delay . " " . ttr ." " . length);
-		this->write(serialized);
-
-		let response = this->readStatus();
-		let status = response[0];
-
-		if status != "INSERTED" && status != "BURIED" {
-			return false;
-		}
+		let serialized = this->_serialize(data);
 
-		return response[1];
+		return "put " . priority . " " . delay . " " . ttr ." " . strlen(serialized) . "\r\n" . serialized;
 	}
 
 	/**
@@ -182,7 +300,56 @@ class Beanstalk
 		 * The body is serialized
 		 * Create a beanstalk job abstraction
 		 */
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_unserialize(this->read(response[2])));
+	}
+
+	/**
+	 * Reserves up to "limit" ready jobs in a single round trip, the "reserve-with-timeout 0" commands
+	 * are pipelined and the server answers TIMED_OUT as soon as no more jobs are ready.
+	 * If a timeout is passed the first job is waited for that number of seconds
+	 *
+	 * <code>
+	 * foreach ($queue->reserveMany(50) as $job) {
+	 *     // process the job
+	 *     $job->delete();
+	 * }
+	 * </code>
+	 */
+	public function reserveMany(int limit, var timeout = null) -> <Job[]>
+	{
+		var jobs, job, response;
+		int pending;
+
+		let jobs = [],
+			pending = limit;
+
+		if pending < 1 {
+			return jobs;
+		}
+
+		if typeof timeout != "null" {
+			let job = this->reserve(timeout);
+			if typeof job != "object" {
+				return jobs;
+			}
+			let jobs[] = job,
+				pending--;
+			if !pending {
+				return jobs;
+			}
+		}
+
+		this->write(rtrim(str_repeat("reserve-with-timeout 0\r\n", pending), "\r\n"));
+
+		while pending > 0 {
+			let response = this->readStatus();
+			if response[0] == "RESERVED" {
+				let jobs[] = new Job(this, response[1], this->_unserialize(this->read(response[2])));
+			}
+			let pending--;
+		}
+
+		return jobs;
 	}
 
 	/**
@@ -284,7 +451,7 @@ class Beanstalk
 			return false;
 		}
 
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_unserialize(this->read(response[2])));
 	}
 
 	/**
@@ -301,7 +468,61 @@ class Beanstalk
 			return false;
 		}
 
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_unserialize(this->read(response[2])));
+	}
+
+	/**
+	 * Serializes a job body with the current serializer
+	 */
+	protected function _serialize(var data) -> string
+	{
+		var serializer;
+
+		let serializer = this->_serializer;
+		if typeof serializer == "object" {
+			return serializer->beforeStore(data);
+		}
+
+		switch serializer {
+
+			case "json":
+				return json_encode(data);
+
+			case "igbinary":
+				return igbinary_serialize(data);
+
+			case "none":
+				return (string) data;
+		}
+
+		return serialize(data);
+	}
+
+	/**
+	 * Unserializes a job body with the current serializer
+	 */
+	protected function _unserialize(var body)
+	{
+		var serializer;
+
+		let serializer = this->_serializer;
+		if typeof serializer == "object" {
+			return serializer->afterRetrieve(body);
+		}
+
+		switch serializer {
+
+			case "json":
+				return json_decode(body, true);
+
+			case "igbinary":
+				return igbinary_unserialize(body);
+
+			case "none":
+				return body;
+		}
+
+		return unserialize(body);
 	}
 
 	/**
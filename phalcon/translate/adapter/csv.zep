@@ -26,6 +26,16 @@ use Phalcon\Translate\Adapter;
  * Phalcon\Translate\Adapter\Csv
  *
  * Allows to define translation lists using CSV file
+ *
+ *<code>
+ * $translate = new \Phalcon\Translate\Adapter\Csv(array(
+ *     "content"      => "app/messages/es.csv",
+ *     "compiledPath" => "app/cache/translations/"
+ * ));
+ *</code>
+ *
+ * If "compiledPath" is set the CSV is compiled into a PHP array file that is only regenerated
+ * when the CSV is modified, so it can be kept in the opcode cache instead of being parsed on every request
  */
 class Csv extends Adapter implements AdapterInterface, \ArrayAccess
 {
@@ -37,13 +47,57 @@ class Csv extends Adapter implements AdapterInterface, \ArrayAccess
 	 */
 	public function __construct(array! options)
 	{
+		var compiledPath;
+
 		parent::__construct(options);
 
 		if !isset options["content"] {
 			throw new Exception("Parameter 'content' is required");
 		}
 
-		this->_load(options["content"], 0, ";", "\"");
+		if fetch compiledPath, options["compiledPath"] {
+			this->_loadCompiled(options["content"], compiledPath);
+		} else {
+			this->_load(options["content"], 0, ";", "\"");
+		}
+	}
+
+	/**
+	 * Load translates from the compiled catalogue, compiling it if the file was modified
+	 *
+	 * @param string file
+	 * @param string compiledPath
+	 */
+	private function _loadCompiled(string! file, string! compiledPath) -> void
+	{
+		var compiledFile, translate, temporaryFile;
+
+		let compiledFile = compiledPath . prepare_virtual_path(file, "_") . ".php";
+
+		if file_exists(compiledFile) {
+			if compare_mtime(compiledFile, file) {
+				let translate = require compiledFile;
+				if typeof translate == "array" {
+					let this->_translate = translate;
+					return;
+				}
+			}
+		}
+
+		this->_load(file, 0, ";", "\"");
+
+		/**
+		 * The catalogue is written to a temporary file and renamed so concurrent requests never read a partial file
+		 */
+		let temporaryFile = compiledFile . "." . uniqid() . ".tmp";
+		if file_put_contents(temporaryFile, "<?php return " . var_export(this->_translate, true) . "; ") === false {
+			throw new Exception("Translation compiled path '" . compiledPath . "' cannot be written");
+		}
+
+		if !rename(temporaryFile, compiledFile) {
+			unlink(temporaryFile);
+			throw new Exception("Translation compiled path '" . compiledPath . "' cannot be written");
+		}
 	}
 
 	/**
@@ -26,15 +26,25 @@ class AssociativeArray implements InterpolatorInterface
 
 	/**
 	 * Replaces placeholders by the values passed
+	 *
+	 * The translation is scanned once replacing every %key% token, values are not scanned again
 	*/
 	public function replacePlaceholders(string! translation, placeholders = null) -> string
 	{
-		var key, value;
+		var key, value, replacePairs;
 
 		if typeof placeholders === "array" && count(placeholders) {
+
+			if !memstr(translation, "%") {
+				return translation;
+			}
+
+			let replacePairs = [];
 			for key, value in placeholders {
-				let translation = str_replace("%" . key . "%", value, translation);
+				let replacePairs["%" . key . "%"] = value;
 			}
+
+			return strtr(translation, replacePairs);
 		}
 
 		return translation;
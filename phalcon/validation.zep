@@ -21,6 +21,7 @@ namespace Phalcon;
 
 use Phalcon\Di\Injectable;
 use Phalcon\Validation\Exception;
+use Phalcon\Validation\Message;
 use Phalcon\Validation\MessageInterface;
 use Phalcon\Validation\Message\Group;
 use Phalcon\Validation\ValidatorInterface;
@@ -143,6 +144,452 @@ class Validation extends Injectable
 		return messages;
 	}
 
+	/**
+	 * Validates a list of rows compiling the rule set only once. Messages are returned indexed
+	 * by the key of the row that produced them, rows without messages are not included
+	 *
+	 *<code>
+	 * $messages = $validation->validateMultiple($rows);
+	 * if (isset($messages[3])) {
+	 *     foreach ($messages[3] as $message) {
+	 *         echo $message, PHP_EOL;
+	 *     }
+	 * }
+	 *</code>
+	 */
+	public function validateMultiple(array! rows) -> array
+	{
+		var plan, rule, key, row, rowMessages, results, existing, values, value,
+			filterService, type, validator, field, length, matches, failed;
+
+		/**
+		 * An entity bound before would be read instead of the rows
+		 */
+		let this->_entity = null;
+
+		/**
+		 * Callbacks receive every data set, validate them one by one
+		 */
+		if method_exists(this, "beforeValidation") || method_exists(this, "afterValidation") {
+			let results = [];
+			for key, row in rows {
+				let rowMessages = this->validate(row);
+				if typeof rowMessages == "object" && count(rowMessages) {
+					let results[key] = rowMessages;
+				}
+			}
+			return results;
+		}
+
+		let plan = this->_compilePlan(),
+			filterService = null,
+			existing = [];
+
+		if typeof this->_filters == "array" && count(this->_filters) {
+			let filterService = this->_getFilterService();
+		}
+
+		/**
+		 * Uniqueness is checked with one query per rule for the whole batch
+		 */
+		for key, rule in plan {
+			if rule["type"] == "Uniqueness" {
+				let values = [];
+				for row in rows {
+					let value = this->_getRowValue(row, rule["field"], filterService);
+					if value !== null {
+						let values[] = value;
+					}
+				}
+				let existing[key] = this->_getExistingValues(rule, values);
+			}
+		}
+
+		let results = [];
+
+		for key, row in rows {
+
+			let rowMessages = null;
+
+			for rule in plan {
+
+				let type = rule["type"],
+					field = rule["field"],
+					failed = false;
+
+				if type === null {
+
+					/**
+					 * Validators without a native path run against the current row
+					 */
+					if typeof rowMessages != "object" {
+						let rowMessages = new Group();
+					}
+
+					let this->_data = row,
+						this->_values = null,
+						this->_messages = rowMessages;
+
+					let validator = rule["validator"];
+					if validator->validate(this, field) === false {
+						if rule["cancelOnFail"] {
+							break;
+						}
+					}
+					continue;
+				}
+
+				let value = this->_getRowValue(row, field, filterService);
+
+				if rule["allowEmpty"] && empty value {
+					continue;
+				}
+
+				switch type {
+
+					case "PresenceOf":
+						let failed = value === null || value === "";
+						break;
+
+					case "StringLength":
+						if rule["multibyte"] {
+							let length = mb_strlen(value);
+						} else {
+							let length = strlen(value);
+						}
+						if rule["max"] !== null && length > rule["max"] {
+							let failed = "TooLong";
+						} else {
+							if rule["min"] !== null && length < rule["min"] {
+								let failed = "TooShort";
+							}
+						}
+						break;
+
+					case "Numericality":
+						let failed = !preg_match("/^-?\d+\.?\d*$/", value);
+						break;
+
+					case "Regex":
+						let matches = null;
+						if preg_match(rule["pattern"], value, matches) {
+							let failed = matches[0] != value;
+						} else {
+							let failed = true;
+						}
+						break;
+
+					case "InclusionIn":
+						let failed = !in_array(value, rule["domain"], rule["strict"]);
+						break;
+
+					case "Email":
+						let failed = !filter_var(value, FILTER_VALIDATE_EMAIL);
+						break;
+
+					case "Uniqueness":
+						if value !== null {
+							let values = existing[rule["key"]],
+								failed = isset values[value];
+						}
+						break;
+				}
+
+				if failed === false {
+					continue;
+				}
+
+				if typeof rowMessages != "object" {
+					let rowMessages = new Group();
+				}
+
+				if failed === true {
+					rowMessages->appendMessage(new Message(rule["message"], field, type));
+				} else {
+					let type = failed;
+					rowMessages->appendMessage(new Message(rule["message" . type], field, type));
+				}
+
+				if rule["cancelOnFail"] {
+					break;
+				}
+			}
+
+			if typeof rowMessages == "object" && count(rowMessages) {
+				let results[key] = rowMessages;
+			}
+		}
+
+		let this->_data = null,
+			this->_values = null,
+			this->_messages = null;
+
+		return results;
+	}
+
+	/**
+	 * Compiles the validators into a plan, labels and messages of the built-in validators with
+	 * a native path are resolved here once instead of on every failure
+	 */
+	protected function _compilePlan() -> array
+	{
+		var validators, plan, scope, field, validator, rule, label, message, key,
+			domain, strict;
+
+		let validators = this->_validators;
+		if typeof validators != "array" {
+			throw new Exception("There are no validators to validate");
+		}
+
+		let plan = [];
+
+		for key, scope in validators {
+
+			if typeof scope != "array" {
+				throw new Exception("The validator scope is not valid");
+			}
+
+			let field = scope[0],
+				validator = scope[1];
+
+			if typeof validator != "object" {
+				throw new Exception("One of the validators is not valid");
+			}
+
+			let rule = [
+				"key": key,
+				"field": field,
+				"validator": validator,
+				"type": null,
+				"allowEmpty": validator->isSetOption("allowEmpty"),
+				"cancelOnFail": validator->getOption("cancelOnFail")
+			];
+
+			/**
+			 * Only the exact built-in classes are compiled, subclasses may change the behavior
+			 */
+			switch get_class(validator) {
+
+				case "Phalcon\\Validation\\Validator\\PresenceOf":
+					let rule["type"] = "PresenceOf",
+						rule["allowEmpty"] = false;
+					break;
+
+				case "Phalcon\\Validation\\Validator\\StringLength":
+					if !validator->isSetOption("min") && !validator->isSetOption("max") {
+						throw new Exception("A minimum or maximum must be set");
+					}
+					let rule["type"] = "StringLength",
+						rule["min"] = validator->getOption("min"),
+						rule["max"] = validator->getOption("max"),
+						rule["multibyte"] = function_exists("mb_strlen");
+					break;
+
+				case "Phalcon\\Validation\\Validator\\Numericality":
+					let rule["type"] = "Numericality";
+					break;
+
+				case "Phalcon\\Validation\\Validator\\Regex":
+					let rule["type"] = "Regex",
+						rule["pattern"] = validator->getOption("pattern");
+					break;
+
+				case "Phalcon\\Validation\\Validator\\InclusionIn":
+					let domain = validator->getOption("domain");
+					if typeof domain != "array" {
+						throw new Exception("Option 'domain' must be an array");
+					}
+					let strict = validator->getOption("strict");
+					let rule["type"] = "InclusionIn",
+						rule["domain"] = domain,
+						rule["strict"] = strict ? true : false;
+					break;
+
+				case "Phalcon\\Validation\\Validator\\Email":
+					let rule["type"] = "Email";
+					break;
+
+				case "Phalcon\\Validation\\Validator\\Uniqueness":
+					if empty validator->getOption("model") {
+						throw new Exception("Model must be set");
+					}
+					let rule["type"] = "Uniqueness",
+						rule["allowEmpty"] = false;
+					break;
+			}
+
+			if rule["type"] !== null {
+
+				let label = validator->getOption("label");
+				if empty label {
+					let label = this->getLabel(field);
+				}
+
+				if rule["type"] == "StringLength" {
+
+					let message = validator->getOption("messageMaximum");
+					if empty message {
+						let message = this->getDefaultMessage("TooLong");
+					}
+					let rule["messageTooLong"] = strtr(message, [":field": label, ":max": rule["max"]]);
+
+					let message = validator->getOption("messageMinimum");
+					if empty message {
+						let message = this->getDefaultMessage("TooShort");
+					}
+					let rule["messageTooShort"] = strtr(message, [":field": label, ":min": rule["min"]]);
+
+				} else {
+
+					let message = validator->getOption("message");
+					if empty message {
+						let message = this->getDefaultMessage(rule["type"]);
+					}
+
+					if rule["type"] == "InclusionIn" {
+						let rule["message"] = strtr(message, [":field": label, ":domain": join(", ", rule["domain"])]);
+					} else {
+						let rule["message"] = strtr(message, [":field": label]);
+					}
+				}
+			}
+
+			let plan[key] = rule;
+		}
+
+		return plan;
+	}
+
+	/**
+	 * Returns the values of a uniqueness rule that already exist in the model, indexed by value
+	 */
+	protected function _getExistingValues(array! rule, array! values) -> array
+	{
+		var validator, model, attribute, except, conditions, bind, chunk, records, record, existing, value;
+
+		let existing = [];
+		if !count(values) {
+			return existing;
+		}
+
+		let validator = rule["validator"],
+			model = validator->getOption("model"),
+			attribute = validator->getOption("attribute"),
+			except = validator->getOption("except");
+
+		if empty attribute {
+			let attribute = rule["field"];
+		}
+
+		let conditions = attribute . " IN ({values:array})";
+		if except {
+			let conditions .= " AND " . attribute . " != :except:";
+		}
+
+		for chunk in array_chunk(array_values(array_unique(values)), 1000) {
+
+			let bind = ["values": chunk];
+			if except {
+				let bind["except"] = except;
+			}
+
+			let records = {model}::find([
+				conditions,
+				"bind": bind,
+				"columns": attribute
+			]);
+
+			for record in records {
+				let existing[record->{attribute}] = true;
+			}
+		}
+
+		/**
+		 * The database could match values that differ in PHP (case, trailing spaces, collations),
+		 * once it returned any row the values not found exactly are counted one by one
+		 */
+		if count(existing) {
+
+			let conditions = attribute . " = :value:";
+			if except {
+				let conditions .= " AND " . attribute . " != :except:";
+			}
+
+			for value in array_unique(values) {
+
+				if isset existing[value] {
+					continue;
+				}
+
+				let bind = ["value": value];
+				if except {
+					let bind["except"] = except;
+				}
+
+				if {model}::count([conditions, "bind": bind]) {
+					let existing[value] = true;
+				}
+			}
+		}
+
+		return existing;
+	}
+
+	/**
+	 * Reads a field from one of the rows of a batch applying the field filters
+	 */
+	protected function _getRowValue(var row, string! field, var filterService)
+	{
+		var value, filters, fieldFilters;
+
+		let value = null;
+		if typeof row == "array" {
+			fetch value, row[field];
+		} else {
+			if typeof row == "object" {
+				if isset row->{field} {
+					let value = row->{field};
+				}
+			}
+		}
+
+		if value === null || typeof filterService != "object" {
+			return value;
+		}
+
+		let filters = this->_filters;
+		if fetch fieldFilters, filters[field] {
+			if fieldFilters {
+				return filterService->sanitize(value, fieldFilters);
+			}
+		}
+
+		return value;
+	}
+
+	/**
+	 * Returns the 'filter' service from the dependency injector
+	 */
+	protected function _getFilterService()
+	{
+		var dependencyInjector, filterService;
+
+		let dependencyInjector = this->getDI();
+		if typeof dependencyInjector != "object" {
+			let dependencyInjector = Di::getDefault();
+			if typeof dependencyInjector != "object" {
+				throw new Exception("A dependency injector is required to obtain the 'filter' service");
+			}
+		}
+
+		let filterService = dependencyInjector->getShared("filter");
+		if typeof filterService != "object" {
+			throw new Exception("Returned 'filter' service is invalid");
+		}
+
+		return filterService;
+	}
+
 	/**
 	 * Adds a validator to a field
 	 */
@@ -356,8 +803,7 @@ class Validation extends Injectable
 	public function getValue(string field)
 	{
 		var entity, method, value, data, values,
-			filters, fieldFilters, dependencyInjector,
-			filterService;
+			filters, fieldFilters, filterService;
 
 		let entity = this->_entity;
 
@@ -417,20 +863,7 @@ class Validation extends Injectable
 			if fetch fieldFilters, filters[field] {
 
 				if fieldFilters {
-
-					let dependencyInjector = this->getDI();
-					if typeof dependencyInjector != "object" {
-						let dependencyInjector = Di::getDefault();
-						if typeof dependencyInjector != "object" {
-							throw new Exception("A dependency injector is required to obtain the 'filter' service");
-						}
-					}
-
-					let filterService = dependencyInjector->getShared("filter");
-					if typeof filterService != "object" {
-						throw new Exception("Returned 'filter' service is invalid");
-					}
-
+					let filterService = this->_getFilterService();
 					return filterService->sanitize(value, fieldFilters);
 				}
 			}
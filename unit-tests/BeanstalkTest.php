@@ -128,4 +128,74 @@ class BeanstalkTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue(is_array($jobStats));
 		$this->assertTrue($jobStats['tube'] === 'beanstalk-test');
 	}
+
+	public function testPutManyReserveMany()
+	{
+		$queue = new Phalcon\Queue\Beanstalk(array('serializer' => 'json'));
+		try {
+			@$queue->connect();
+		}
+		catch (Exception $e) {
+			$this->markTestSkipped($e->getMessage());
+			return;
+		}
+
+		$this->assertEquals($queue->getSerializer(), 'json');
+
+		$this->assertTrue($queue->choose('beanstalk-test-many') !== false);
+		$this->assertTrue($queue->watch('beanstalk-test-many') !== false);
+
+		$jobs = array();
+		for ($i = 0; $i < 10; $i++) {
+			$jobs['job' . $i] = array('number' => $i);
+		}
+
+		$ids = $queue->putMany($jobs, array('pipeline' => 4));
+		$this->assertEquals(array_keys($ids), array_keys($jobs));
+		foreach ($ids as $id) {
+			$this->assertTrue($id !== false);
+		}
+
+		$reserved = $queue->reserveMany(6, 0);
+		$this->assertEquals(count($reserved), 6);
+		$this->assertEquals($reserved[0]->getBody(), array('number' => 0));
+		$this->assertEquals($reserved[5]->getBody(), array('number' => 5));
+
+		$reserved = array_merge($reserved, $queue->reserveMany(10));
+		$this->assertEquals(count($reserved), 10);
+
+		foreach ($reserved as $job) {
+			$this->assertTrue($job->delete());
+		}
+
+		$this->assertEquals($queue->reserveMany(5), array());
+	}
+
+	public function testSerializers()
+	{
+		$queue = new Phalcon\Queue\Beanstalk(array('serializer' => 'none'));
+		try {
+			@$queue->connect();
+		}
+		catch (Exception $e) {
+			$this->markTestSkipped($e->getMessage());
+			return;
+		}
+
+		$this->assertTrue($queue->choose('beanstalk-test-raw') !== false);
+		$this->assertTrue($queue->watch('beanstalk-test-raw') !== false);
+
+		$this->assertTrue($queue->put('raw body') !== false);
+
+		$job = $queue->reserve(0);
+		$this->assertEquals($job->getBody(), 'raw body');
+		$this->assertTrue($job->delete());
+
+		try {
+			$queue->setSerializer('unknown');
+			$this->assertTrue(false);
+		} catch (Phalcon\Queue\Beanstalk\Exception $e) {
+			$this->assertEquals($e->getMessage(), "Unknown serializer 'unknown'");
+		}
+	}
 }
@@ -279,6 +279,64 @@ class CacheTest extends PHPUnit_Framework_TestCase
 		//echo $r1, ' ', $r2, ' ', $r3, ' ', $r4, "\n";
 	}
 
+	public function testMemoryCacheMultipleAndTags()
+	{
+		$frontCache = new Phalcon\Cache\Frontend\Data(array(
+			'lifetime' => 20
+		));
+
+		$cache = new Phalcon\Cache\Backend\Memory($frontCache);
+
+		$cache->save('a', array(1, 2));
+		$cache->save('b', 'value');
+
+		$this->assertEquals($cache->getMultiple(array('a', 'b', 'c')), array(
+			'a' => array(1, 2),
+			'b' => 'value',
+			'c' => null
+		));
+
+		//Tags get a version the first time they're read
+		$versions = $cache->getTagVersions(array('user:42', 'posts'));
+		$this->assertEquals(array_keys($versions), array('user:42', 'posts'));
+		$this->assertEquals($cache->getTagVersions(array('posts', 'user:42')), array('posts' => $versions['posts'], 'user:42' => $versions['user:42']));
+
+		$cache->invalidateTags(array('user:42'));
+
+		$newVersions = $cache->getTagVersions(array('user:42', 'posts'));
+		$this->assertNotEquals($newVersions['user:42'], $versions['user:42']);
+		$this->assertEquals($newVersions['posts'], $versions['posts']);
+	}
+
+	public function testMemoryCacheTagsWhileCapturing()
+	{
+		$frontCache = new Phalcon\Cache\Frontend\Output(array(
+			'lifetime' => 20
+		));
+
+		$cache = new Phalcon\Cache\Backend\Memory($frontCache);
+
+		//Versions created while a content is captured are stored without writing them in it
+		ob_start();
+		$this->assertNull($cache->start('fragment'));
+		echo 'content';
+		$versions = $cache->getTagVersions(array('nested'));
+		$this->assertTrue($cache->isStarted());
+		$cache->save();
+		$this->assertEquals(ob_get_clean(), 'content');
+
+		$this->assertEquals($cache->get('fragment'), 'content');
+		$this->assertEquals($cache->getTagVersions(array('nested')), $versions);
+
+		//A content already known to be missing is captured without reading it again
+		ob_start();
+		$cache->startCapture(20);
+		echo 'captured';
+		$cache->save('captured');
+		$this->assertEquals(ob_get_clean(), 'captured');
+		$this->assertEquals($cache->get('captured'), 'captured');
+	}
+
 	public function testMemoryCacheIncrAndDecr()
 	{
 		$frontCache = new Phalcon\Cache\Frontend\Output(array(
@@ -181,6 +181,28 @@ class CollectionsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals(count($songs), 1);
 		$this->assertEquals($songs[0]->name, 'Teardrop');
 
+		//Lazy resultsets
+		$songs = Songs::find(array(
+			'conditions' => array('artist' => 'Massive Attack'),
+			'sort' => array('name' => 1),
+			'lazy' => true,
+			'batchSize' => 1
+		));
+		$this->assertInstanceOf('Phalcon\Mvc\Collection\Resultset', $songs);
+		$this->assertEquals(count($songs), 2);
+
+		$names = array();
+		foreach ($songs as $position => $song) {
+			$this->assertInstanceOf('Songs', $song);
+			$names[$position] = $song->name;
+		}
+		$this->assertEquals($names, array('Paradise Circus', 'Teardrop'));
+
+		$documents = $songs->toArray();
+		$this->assertEquals(count($documents), 2);
+		$this->assertTrue(is_array($documents[0]));
+		$this->assertEquals($documents[1]['name'], 'Teardrop');
+
 		//Find first
 		$song = Songs::findFirst(array(
 			array('artist' => 'Massive Attack'),
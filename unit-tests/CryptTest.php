@@ -107,4 +107,56 @@ class CryptTest extends PHPUnit_Framework_TestCase
 		$actual = $crypt->decryptBase64($encrypted, $key, TRUE);
 		$this->assertEquals($actual, $text);
 	}
+
+	public function testAeadEncryption()
+	{
+		$sodium = function_exists('sodium_crypto_aead_chacha20poly1305_ietf_encrypt') || function_exists('Sodium\\crypto_aead_chacha20poly1305_ietf_encrypt');
+
+		$crypt = new Phalcon\Crypt();
+		$crypt->setKey('le password');
+
+		//Only the ciphers implemented by libsodium are supported
+		foreach (array('aes-128-gcm', 'aes-192-gcm') as $cipher) {
+			try {
+				$crypt->setCipher($cipher);
+				$this->assertTrue(false);
+			} catch (Phalcon\Crypt\Exception $e) {
+				$this->assertEquals($e->getMessage(), "The cipher '" . $cipher . "' is not supported, use 'aes-256-gcm' or 'chacha20-poly1305'");
+			}
+		}
+
+		$sodiumAes = (function_exists('sodium_crypto_aead_aes256gcm_is_available') && sodium_crypto_aead_aes256gcm_is_available()) ||
+			(function_exists('Sodium\\crypto_aead_aes256gcm_is_available') && call_user_func('Sodium\\crypto_aead_aes256gcm_is_available'));
+
+		foreach (array('aes-256-gcm' => $sodiumAes, 'chacha20-poly1305' => $sodium) as $cipher => $hasSodium) {
+
+			if (!$hasSodium) {
+				try {
+					$crypt->setCipher($cipher);
+					$this->assertTrue(false);
+				} catch (Phalcon\Crypt\Exception $e) {
+					$this->assertEquals($e->getMessage(), "The cipher '" . $cipher . "' requires libsodium");
+				}
+				continue;
+			}
+
+			$crypt->setCipher($cipher);
+
+			$encrypted = $crypt->encryptBase64('This is a secret text', null, true);
+			$this->assertEquals($crypt->decryptBase64($encrypted, null, true), 'This is a secret text');
+
+			$texts = array('first' => 'one', 'second' => 'two');
+			$this->assertEquals($crypt->decryptBase64Many($crypt->encryptBase64Many($texts)), $texts);
+
+			$raw = $crypt->encrypt('This is a secret text');
+			$raw[20] = chr(ord($raw[20]) ^ 1);
+
+			try {
+				$crypt->decrypt($raw);
+				$this->assertTrue(false);
+			} catch (Phalcon\Crypt\Exception $e) {
+				$this->assertEquals($e->getMessage(), 'The text to decrypt was modified or the key is not valid');
+			}
+		}
+	}
 }
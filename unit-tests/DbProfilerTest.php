@@ -57,7 +57,7 @@ class DbProfilerListener
 
 	public function afterQuery($event, $connection)
 	{
-		$this->_profiler->stopProfile();
+		$this->_profiler->stopProfile($connection->getSQLRowCount());
 	}
 
 	public function getProfiler()
@@ -112,6 +112,46 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 		$this->_executeTests($connection);
 	}
 
+	public function testAggregated()
+	{
+		$profiler = new Phalcon\Db\Profiler();
+		$profiler->setAggregated(true, 2);
+
+		$this->assertEquals($profiler->getFingerprint("SELECT * FROM robots WHERE id = 10 AND name IN ('a', 'b')"), "SELECT * FROM robots WHERE id = ? AND name IN (?+)");
+
+		foreach (array(1, 2, 3) as $id) {
+			$profiler->startProfile("SELECT * FROM robots WHERE id = " . $id);
+			$profiler->stopProfile(1);
+		}
+
+		$profiler->startProfile("DELETE FROM robots WHERE id = 1");
+		$profiler->stopProfile(0);
+
+		$profiler->startProfile("UPDATE robots SET name = 'x'");
+		$profiler->stopProfile(5);
+
+		$this->assertEquals($profiler->getNumberTotalStatements(), 5);
+		$this->assertEquals($profiler->getNumberOverflowStatements(), 1);
+		$this->assertNull($profiler->getProfiles());
+
+		$aggregates = $profiler->getAggregates();
+		$this->assertEquals(count($aggregates), 2);
+
+		$aggregate = $aggregates["SELECT * FROM robots WHERE id = ?"];
+		$this->assertEquals($aggregate["count"], 3);
+		$this->assertEquals($aggregate["rows"], 3);
+		$this->assertTrue($aggregate["minTime"] <= $aggregate["p95Time"]);
+		$this->assertTrue($aggregate["p95Time"] <= $aggregate["maxTime"]);
+
+		$profiler->reset();
+		$this->assertEquals($profiler->getAggregates(), array());
+
+		$profiler->setSamplingRate(0);
+		$profiler->startProfile("SELECT 1");
+		$profiler->stopProfile();
+		$this->assertEquals($profiler->getNumberTotalStatements(), 0);
+	}
+
 	public function _executeTests($connection)
 	{
 
@@ -161,5 +201,14 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 
 		$this->assertEquals(count($profiler->getProfiles()), 0);
 		$this->assertEquals($profiler->getNumberTotalStatements(), 0);
+
+		//The adapter provides the row count of the statement to the listener
+		$profiler->setAggregated(true);
+		$connection->query("SELECT * FROM personas LIMIT 3");
+
+		$aggregates = $profiler->getAggregates();
+		$aggregate = $aggregates["SELECT * FROM personas LIMIT ?"];
+		$this->assertEquals($aggregate["count"], 1);
+		$this->assertEquals($aggregate["rows"], $connection->getSQLRowCount());
 	}
 }
@@ -108,6 +108,54 @@ class DbTest extends PHPUnit_Framework_TestCase
 		}
 	}
 
+	public function testDbSqliteStatementsCache()
+	{
+		require 'unit-tests/config.db.php';
+
+		if (empty($configSqlite)) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		$configSqlite['statementsCache'] = 2;
+		$connection = new Phalcon\Db\Adapter\Pdo\Sqlite($configSqlite);
+
+		$sql = "SELECT * FROM personas WHERE estado = ? LIMIT 3";
+
+		$result = $connection->query($sql, array("A"));
+		$statement = $result->getInternalResult();
+
+		//The cached statement is in use, a nested query must not reuse it
+		$nested = $connection->query($sql, array("I"));
+		$this->assertNotSame($statement, $nested->getInternalResult());
+		$this->assertEquals(count($result->fetchAll()), 3);
+		unset($nested, $result);
+
+		//Once released the statement is reused
+		$result = $connection->query($sql, array("A"));
+		$this->assertSame($statement, $result->getInternalResult());
+		$this->assertEquals(count($result->fetchAll()), 3);
+		unset($result);
+
+		//A statement that failed to execute is released too
+		try {
+			$connection->query($sql, array("A", "B"));
+			$this->assertTrue(false);
+		} catch (PDOException $e) {
+		}
+
+		$result = $connection->query($sql, array("A"));
+		$this->assertSame($statement, $result->getInternalResult());
+		unset($result);
+
+		$connection->close();
+		$connection->connect();
+
+		$result = $connection->query($sql, array("A"));
+		$this->assertNotSame($statement, $result->getInternalResult());
+		$this->assertEquals(count($result->fetchAll()), 3);
+	}
+
 	protected function _executeTests($connection)
 	{
 
@@ -0,0 +1,55 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+  | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+  |          Eduar Carvajal <eduar@phalconphp.com>                         |
+  +------------------------------------------------------------------------+
+*/
+
+class DebugTest extends PHPUnit_Framework_TestCase
+{
+
+	public function testKernelStats()
+	{
+		try {
+			$stats = Phalcon\Debug::getKernelStats();
+		} catch (Phalcon\Exception $e) {
+			$this->assertContains('build/kernel-stats', $e->getMessage());
+			$this->markTestSkipped('The kernel hooks were not applied with build/kernel-stats');
+			return;
+		}
+
+		if ($stats === false) {
+			$this->markTestSkipped('The extension was not compiled with ZEPHIR_KERNEL_STATS');
+			return;
+		}
+
+		Phalcon\Debug::resetKernelStats();
+
+		$config = new Phalcon\Config(array('database' => array('host' => 'localhost')));
+		for ($i = 0; $i < 3; $i++) {
+			$config->merge(new Phalcon\Config(array('database' => array('port' => $i))));
+		}
+
+		$stats = Phalcon\Debug::getKernelStats();
+		$this->assertTrue(is_array($stats));
+		$this->assertTrue(isset($stats['Phalcon\Config::_merge']));
+		$this->assertTrue($stats['Phalcon\Config::_merge']['calls'] >= 3);
+		$this->assertTrue($stats['Phalcon\Config::_merge']['time'] >= 0);
+
+		Phalcon\Debug::resetKernelStats();
+		$this->assertEquals(Phalcon\Debug::getKernelStats(), array());
+	}
+}
@@ -317,6 +317,44 @@ class FormsTest extends PHPUnit_Framework_TestCase
 		)));
 	}
 
+	public function testFormCompiledRenderAndValidation()
+	{
+		$element = new Text("name", array('class' => 'big-input'));
+
+		$element->setDefault('Phalcon');
+		$this->assertEquals($element->render(), '<input type="text" id="name" name="name" value="Phalcon" class="big-input" />');
+
+		$element->setDefault('"quoted" <b>');
+		$this->assertEquals($element->render(), '<input type="text" id="name" name="name" value="&quot;quoted&quot; &lt;b&gt;" class="big-input" />');
+
+		$element->setDefault(100);
+		$this->assertEquals($element->render(array('class' => 'small-input')), '<input type="text" id="name" name="name" value="100" class="small-input" />');
+
+		$element->setDefault(null);
+		$this->assertEquals($element->render(), '<input type="text" id="name" name="name" class="big-input" />');
+
+		$telephone = new Text("telephone");
+		$telephone->addValidator(new PresenceOf(array(
+			'message' => 'The telephone is required'
+		)));
+
+		$form = new Form();
+		$form->add($telephone);
+
+		$this->assertFalse($form->isValid(array()));
+		$this->assertEquals(count($form->getMessages()), 1);
+
+		$this->assertTrue($form->isValid(array('telephone' => '12345')));
+
+		$telephone->addValidator(new StringLength(array(
+			'min' => 8,
+			'messageMinimum' => 'The telephone is too short'
+		)));
+
+		$this->assertFalse($form->isValid(array('telephone' => '12345')));
+		$this->assertEquals($form->getMessagesFor('telephone')->offsetGet(0)->getMessage(), 'The telephone is too short');
+	}
+
 	public function testFormRenderEntity()
 	{
 		//Second element
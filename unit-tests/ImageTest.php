@@ -146,6 +146,23 @@ class ImageTest extends PHPUnit_Framework_TestCase
 		$mark->background('#000')->save('unit-tests/assets/production/gd-background.jpg');
 		$this->assertTrue(file_exists('unit-tests/assets/production/gd-background.jpg'));
 
+		// Lazy mode fuses the resize and the crop into a single resample
+		@unlink('unit-tests/assets/production/gd-lazy.jpg');
+
+		$image = new Phalcon\Image\Adapter\GD('unit-tests/assets/phalconphp.jpg', null, null, true);
+		$this->assertTrue($image->isLazy());
+
+		$image->resize(200, 200)->crop(100, 100);
+		$this->assertEquals($image->getWidth(), 100);
+		$this->assertEquals($image->getHeight(), 100);
+
+		$image->save('unit-tests/assets/production/gd-lazy.jpg');
+		$this->assertTrue(file_exists('unit-tests/assets/production/gd-lazy.jpg'));
+
+		$tmp = imagecreatefromjpeg('unit-tests/assets/production/gd-lazy.jpg');
+		$this->assertEquals(imagesx($tmp), 100);
+		$this->assertEquals(imagesy($tmp), 100);
+
 		// Make the image background black with 50% opacity
 		//$image->background('#000', 50);
 
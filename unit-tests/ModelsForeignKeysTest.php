@@ -183,6 +183,28 @@ class ModelsForeignKeysTest extends PHPUnit_Framework_TestCase
 
 		$this->assertEquals($part->getMessages(), $messages);
 
+		//Foreign keys checked in bulk by saveBatch
+		$records = array();
+		foreach (array(100, 1, 2) as $robotId) {
+			$robotsParts = new RobotsParts();
+			$robotsParts->robots_id = $robotId;
+			$robotsParts->parts_id = 1;
+			$records[] = $robotsParts;
+		}
+
+		$this->assertFalse(RobotsParts::saveBatch($records));
+
+		$messages = array(
+			0 => Phalcon\Mvc\Model\Message::__set_state(array(
+				'_type' => 'ConstraintViolation',
+				'_message' => 'The robot code does not exist',
+				'_field' => 'robots_id',
+				'_code' => 0,
+			))
+		);
+
+		$this->assertEquals($records[0]->getMessages(), $messages);
+
 	}
 
 	public function _executeTestsRenamed($di)
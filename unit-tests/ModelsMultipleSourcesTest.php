@@ -91,6 +91,60 @@ class ModelsMultipleSourcesTest extends PHPUnit_Framework_TestCase
 		}
 	}
 
+	public function testReadConnectionPool()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->marktestSkipped('Test skipped');
+			return;
+		}
+
+		$this->_prepareDI();
+
+		$di = Phalcon\DI::getDefault();
+
+		$di->set('dbReplicaDown', function() {
+			throw new PDOException('Replica is down');
+		}, true);
+
+		$di->set('dbReplica', function() {
+			require 'unit-tests/config.db.php';
+			return new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
+		}, true);
+
+		$robot = new Store\Robots();
+
+		$manager = $di->getShared('modelsManager');
+		$manager->setReadConnectionPool($robot, array('dbReplicaDown' => 100, 'dbReplica' => 1));
+
+		//The failing replica is skipped
+		$this->assertSame($di->getShared('dbReplica'), $robot->getReadConnection());
+		$this->assertSame($di->getShared('dbReplica'), $robot->getReadConnection());
+
+		//Reading doesn't connect to the primary
+		$this->assertFalse($di->hasSharedInstance('dbOne'));
+
+		$robot = Store\Robots::findFirst();
+		$this->assertTrue(is_object($robot));
+
+		//Requesting the write connection doesn't pin the reads
+		$robot->getWriteConnection();
+		$this->assertSame($di->getShared('dbReplica'), $robot->getReadConnection());
+
+		//Reads are pinned to the primary after a write
+		$this->assertTrue($robot->save());
+		$this->assertSame($di->getShared('dbOne'), $robot->getReadConnection());
+
+		$manager->clearConnectionRouting();
+		$this->assertSame($di->getShared('dbReplica'), $robot->getReadConnection());
+
+		//Reads are pinned to the primary while it is under a transaction
+		$di->getShared('dbOne')->begin();
+		$this->assertSame($di->getShared('dbOne'), $robot->getReadConnection());
+		$di->getShared('dbOne')->rollback();
+		$this->assertSame($di->getShared('dbReplica'), $robot->getReadConnection());
+	}
+
 	public function ytestSourcesInstance()
 	{
 		require 'unit-tests/config.db.php';
@@ -532,4 +532,40 @@ class ModelsQueryBuilderTest extends PHPUnit_Framework_TestCase
 				->getPhql();
 		$this->assertEquals($phql, 'SELECT name, SUM(price) FROM [Robots] GROUP BY [id], [name]');
 	}
+
+	public function testInWhereArrayPlaceholder()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped("Test skipped");
+			return;
+		}
+
+		$di = $this->_getDI();
+
+		$builder = new Builder();
+		$builder->setDi($di)
+				->from('Robots')
+				->inWhere('id', array(1, 2))
+				->notInWhere('name', array('Terminator'));
+
+		$this->assertEquals($builder->getPhql(), 'SELECT [Robots].* FROM [Robots] WHERE (id IN ({AP0_:array})) AND (name NOT IN ({AP1_:array}))');
+
+		$params = $builder->getQuery()->getBindParams();
+		$this->assertEquals($params['AP0_'], array(1, 2));
+		$this->assertEquals($params['AP1_'], array('Terminator'));
+
+		//The PHQL doesn't depend on the number of values
+		$other = new Builder();
+		$other->setDi($di)
+			  ->from('Robots')
+			  ->inWhere('id', array(1, 2, 3))
+			  ->notInWhere('name', array('Terminator', 'Astro Boy'));
+
+		$this->assertEquals($builder->getPhql(), $other->getPhql());
+
+		$robots = $other->getQuery()->execute();
+		$this->assertEquals(count($robots), 1);
+		$this->assertEquals($robots[0]->name, 'Robotina');
+	}
 }
@@ -76,6 +76,7 @@ class ModelsQueryExecuteTest extends PHPUnit_Framework_TestCase
 		}, true);
 
 		$this->_testSelectExecute($di);
+		$this->_testSelectSqlCache($di);
 		$this->_testSelectRenamedExecute($di);
 		$this->_testInsertExecute($di);
 		$this->_testInsertRenamedExecute($di);
@@ -102,6 +103,7 @@ class ModelsQueryExecuteTest extends PHPUnit_Framework_TestCase
 		}, true);
 
 		$this->_testSelectExecute($di);
+		$this->_testSelectSqlCache($di);
 		$this->_testSelectRenamedExecute($di);
 		$this->_testInsertExecute($di);
 		$this->_testInsertRenamedExecute($di);
@@ -128,6 +130,7 @@ class ModelsQueryExecuteTest extends PHPUnit_Framework_TestCase
 		}, true);
 
 		$this->_testSelectExecute($di);
+		$this->_testSelectSqlCache($di);
 		$this->_testSelectRenamedExecute($di);
 		$this->_testInsertExecute($di);
 		$this->_testInsertRenamedExecute($di);
@@ -138,6 +141,50 @@ class ModelsQueryExecuteTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function _testSelectSqlCache($di)
+	{
+
+		$manager = $di->getShared('modelsManager');
+
+		Query::resetSqlCache();
+
+		$robots = $manager->executeQuery('SELECT * FROM Robots WHERE id IN ({ids:array}) ORDER BY id', array('ids' => array(1, 2)));
+		$this->assertEquals(count($robots), 2);
+		$this->assertInstanceOf('Robots', $robots[0]);
+
+		$robots = $manager->executeQuery('SELECT * FROM Robots WHERE id IN ({ids:array}) ORDER BY id', array('ids' => array(2, 3)));
+		$this->assertEquals(count($robots), 2);
+		$this->assertEquals($robots[0]->id, 2);
+
+		$stats = Query::getSqlCacheStats();
+		$this->assertEquals($stats['misses'], 1);
+		$this->assertEquals($stats['hits'], 1);
+
+		//A different number of elements in the array placeholder generates another statement
+		$robots = $manager->executeQuery('SELECT * FROM Robots WHERE id IN ({ids:array}) ORDER BY id', array('ids' => array(1, 2, 3)));
+		$this->assertEquals(count($robots), 3);
+
+		$stats = Query::getSqlCacheStats();
+		$this->assertEquals($stats['misses'], 2);
+		$this->assertEquals($stats['entries'], 2);
+
+		//Complex resultsets restore their base instances
+		for ($i = 0; $i < 2; $i++) {
+			$result = $manager->executeQuery('SELECT r.*, p.* FROM Robots r JOIN RobotsParts p ORDER BY r.id, p.id');
+			$this->assertInstanceOf('Phalcon\Mvc\Model\Resultset\Complex', $result);
+			$this->assertInstanceOf('Robots', $result[0]->r);
+			$this->assertInstanceOf('RobotsParts', $result[0]->p);
+		}
+
+		$stats = Query::getSqlCacheStats();
+		$this->assertEquals($stats['hits'], 2);
+
+		Query::resetSqlCache();
+
+		$stats = Query::getSqlCacheStats();
+		$this->assertEquals($stats['entries'], 0);
+	}
+
 	public function _testSelectExecute($di)
 	{
 
@@ -243,6 +243,106 @@ class ModelsResultsetCacheTest extends PHPUnit_Framework_TestCase
 		));
 	}
 
+	protected function _testCacheAuto($di)
+	{
+
+		$di->set('modelsCache', function(){
+			$frontCache = new Phalcon\Cache\Frontend\Data();
+			return new Phalcon\Cache\Backend\File($frontCache, array(
+				'cacheDir' => 'unit-tests/cache/'
+			));
+		}, true);
+
+		$di->getShared('modelsManager')->setQueryCacheService('modelsCache');
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertTrue($robots->isFresh());
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertFalse($robots->isFresh());
+		$this->assertEquals($robots[0]->id, 1);
+
+		//Different bound parameters use different entries
+		$robot = Robots::findFirst(array(
+			'id = ?0',
+			'bind' => array(2),
+			'cache' => array('auto' => true)
+		));
+		$this->assertEquals($robot->id, 2);
+
+		$robot = Robots::findFirst(array(
+			'id = ?0',
+			'bind' => array(1),
+			'cache' => array('auto' => true)
+		));
+		$this->assertEquals($robot->id, 1);
+
+		//Saving a record invalidates the entries of its model
+		$this->assertTrue($robot->save());
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertEquals(count($robots), 3);
+		$this->assertTrue($robots->isFresh());
+
+		//Entries cached while a transaction is open are invalidated again on commit
+		$transactionManager = new Phalcon\Mvc\Model\Transaction\Manager($di);
+		$transaction = $transactionManager->get();
+
+		$robot->setTransaction($transaction);
+		$this->assertTrue(Robots::saveBatch(array($robot)));
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertTrue($robots->isFresh());
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertFalse($robots->isFresh());
+
+		$this->assertTrue($transaction->commit());
+
+		$robots = Robots::find(array(
+			'cache' => array('auto' => true),
+			'order' => 'id'
+		));
+		$this->assertTrue($robots->isFresh());
+	}
+
+	public function testCacheAutoMysql()
+	{
+		$di = $this->_prepareTestMysql();
+		if ($di) {
+			$this->_testCacheAuto($di);
+		} else {
+			$this->markTestSkipped("Skipped");
+		}
+	}
+
+	public function testCacheAutoSqlite()
+	{
+		$di = $this->_prepareTestSqlite();
+		if ($di) {
+			$this->_testCacheAuto($di);
+		} else {
+			$this->markTestSkipped("Skipped");
+		}
+	}
+
 	public function testCacheDefaultDIMysql()
 	{
 		$di = $this->_prepareTestMysql();
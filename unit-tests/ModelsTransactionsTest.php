@@ -203,6 +203,63 @@ class ModelsTransactionsTest extends PHPUnit_Framework_TestCase {
 			$this->assertTrue(FALSE, 'oh, Why?');
 		}
 
+		//Unit of work, records are written in batches on flush
+		$transaction3 = $transactionManager->get();
+
+		$p = 300;
+		for ($i = 0; $i < 12; $i++) {
+			$persona = new Personas($di);
+			$persona->cedula = 'T-Cx'.$p;
+			$persona->tipo_documento_id = 1;
+			$persona->nombres = 'LOST LOST';
+			$persona->telefono = '3';
+			$persona->cupo = 0;
+			$persona->estado = 'A';
+			$this->assertSame($transaction3, $transaction3->persist($persona));
+			$p++;
+		}
+
+		$this->assertTrue($transaction3->flush(5));
+		$this->assertEquals($persona->getDirtyState(), Phalcon\Mvc\Model::DIRTY_STATE_PERSISTENT);
+
+		//Existing records are updated
+		$persona->telefono = '4';
+		$transaction3->persist($persona);
+		$this->assertTrue($transaction3->flush());
+
+		//New instances carrying an existing primary key are updated
+		$existing = new Personas($di);
+		$existing->cedula = 'T-Cx300';
+		$existing->tipo_documento_id = 1;
+		$existing->nombres = 'LOST LOST';
+		$existing->telefono = '5';
+		$existing->cupo = 0;
+		$existing->estado = 'A';
+		$transaction3->persist($existing);
+		$this->assertTrue($transaction3->flush());
+		$this->assertEquals($existing->getDirtyState(), Phalcon\Mvc\Model::DIRTY_STATE_PERSISTENT);
+
+		$existing = new Personas($di);
+		$existing->cedula = 'T-Cx301';
+		$existing->tipo_documento_id = 1;
+		$existing->nombres = 'LOST LOST';
+		$existing->telefono = '5';
+		$existing->cupo = 0;
+		$existing->estado = 'A';
+		$existing->setTransaction($transaction3);
+		$this->assertTrue(Personas::saveBatch(array($existing)));
+		$this->assertEquals($existing->getDirtyState(), Phalcon\Mvc\Model::DIRTY_STATE_PERSISTENT);
+
+		$transaction3->remove($persona);
+		$this->assertTrue($transaction3->flush());
+		$this->assertEquals($persona->getDirtyState(), Phalcon\Mvc\Model::DIRTY_STATE_DETACHED);
+
+		$transaction3->commit();
+
+		$this->assertEquals(Personas::count(), $numPersonas + 26);
+		$this->assertEquals(Personas::count("telefono = '4'"), 0);
+		$this->assertEquals(Personas::count("telefono = '5'"), 2);
+
 	}
 
 }
@@ -231,6 +231,71 @@ class ModelsValidatorsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($messages[0]->getField(), "email");
 		$this->assertEquals($messages[0]->getMessage(), "Value of field 'email' must have a valid e-mail format");
 
+		//Uniqueness validator in batches
+		$first = new Subscriptores();
+		$first->email = 'batch1@hotmail.com';
+		$first->created_at = $createdAt;
+		$first->status = 'P';
+
+		$second = new Subscriptores();
+		$second->email = 'batch2@hotmail.com';
+		$second->created_at = $createdAt;
+		$second->status = 'P';
+
+		$this->assertTrue(Subscriptores::saveBatch(array($first, $second)));
+
+		$subscriptor = new Subscriptores();
+		$subscriptor->email = 'batch3@hotmail.com';
+		$subscriptor->created_at = $createdAt;
+		$subscriptor->status = 'P';
+		$this->assertTrue($subscriptor->save());
+
+		//The values fetched for the previous batch aren't reused
+		$third = new Subscriptores();
+		$third->email = 'batch3@hotmail.com';
+		$third->created_at = $createdAt;
+		$third->status = 'P';
+
+		$this->assertFalse(Subscriptores::saveBatch(array($first, $third)));
+
+		$messages = $third->getMessages();
+		$this->assertEquals($messages[0]->getType(), "Unique");
+		$this->assertEquals($messages[0]->getField(), "email");
+		$this->assertEquals(Subscriptores::count("email = 'batch3@hotmail.com'"), 1);
+
+		//Values already present in the table are counted in batches
+		$fourth = new Subscriptores();
+		$fourth->email = 'batch4@hotmail.com';
+		$fourth->created_at = $createdAt;
+		$fourth->status = 'P';
+
+		$fifth = new Subscriptores();
+		$fifth->email = 'fuego@hotmail.com';
+		$fifth->created_at = $createdAt;
+		$fifth->status = 'P';
+
+		$this->assertFalse(Subscriptores::saveBatch(array($fourth, $fifth)));
+
+		$messages = $fifth->getMessages();
+		$this->assertEquals($messages[0]->getType(), "Unique");
+		$this->assertEquals($messages[0]->getField(), "email");
+
+		//Values matched by the collation but differing in PHP are counted too
+		if ($connection->getType() == 'mysql') {
+			$fifth = new Subscriptores();
+			$fifth->email = 'FUEGO@hotmail.com';
+			$fifth->created_at = $createdAt;
+			$fifth->status = 'P';
+
+			$this->assertFalse(Subscriptores::saveBatch(array($fourth, $fifth)));
+
+			$messages = $fifth->getMessages();
+			$this->assertEquals($messages[0]->getType(), "Unique");
+			$this->assertEquals($messages[0]->getField(), "email");
+		}
+
+		$this->assertEquals(Subscriptores::count("email = 'batch4@hotmail.com'"), 0);
+
 		// Issue 1527
 		$subscriptor = Subscriptores::findFirst();
 		//$this->assertTrue($subscriptor->validation()); // This fails
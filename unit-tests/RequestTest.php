@@ -409,4 +409,45 @@ class RequestTest extends PHPUnit_Framework_TestCase
 
 		$this->assertEquals($request->getHeaders(), $headers);
 	}
+
+	public function testQualityHeaders()
+	{
+		$tmpServer = $_SERVER;
+
+		$_SERVER['HTTP_ACCEPT'] = '*/*;q=0.8, text/*;q=0.8,text/html ; level=1;q=0.8, application/json;q=0.5';
+		$_SERVER['HTTP_ACCEPT_LANGUAGE'] = '*, es-ES;q=0.9, en-US';
+		$_SERVER['HTTP_ACCEPT_CHARSET'] = 'iso-8859-5, unicode-1-1;q=0.8';
+
+		$request = new \Phalcon\Http\Request();
+
+		$this->assertEquals($request->getAcceptableContent(), array(
+			array('accept' => '*/*', 'quality' => 0.8),
+			array('accept' => 'text/*', 'quality' => 0.8),
+			array('accept' => 'text/html', 'quality' => 0.8, 'level' => '1'),
+			array('accept' => 'application/json', 'quality' => 0.5)
+		));
+
+		$this->assertEquals($request->getBestAccept(), 'text/html');
+		$this->assertEquals($request->getBestLanguage(), 'en-US');
+		$this->assertEquals($request->getBestCharset(), 'iso-8859-5');
+
+		$_SERVER['HTTP_ACCEPT'] = 'application/json';
+		$this->assertEquals($request->getBestAccept(), 'application/json');
+
+		$_SERVER['HTTP_ACCEPT'] = '';
+		$this->assertEquals($request->getAcceptableContent(), array());
+		$this->assertEquals($request->getBestAccept(), '');
+
+		$_SERVER['HTTP_X_FORWARDED_FOR'] = '10.0.0.1, 10.0.0.2';
+		$this->assertEquals($request->getClientAddress(true), '10.0.0.1');
+
+		$headers = $request->getHeaders();
+		$this->assertEquals($headers['X-Forwarded-For'], '10.0.0.1, 10.0.0.2');
+
+		$_SERVER['HTTP_X_CUSTOM_HEADER'] = 'value';
+		$headers = $request->getHeaders();
+		$this->assertEquals($headers['X-Custom-Header'], 'value');
+
+		$_SERVER = $tmpServer;
+	}
 }
@@ -208,6 +208,86 @@ class ResponseTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($this->_response->isSent(), true);
 	}
 
+	public function testSetFileToSendRange()
+	{
+		$filename = __FILE__;
+		$expected = file_get_contents($filename);
+
+		$_SERVER['HTTP_RANGE'] = 'bytes=6-15';
+		$this->_response->setFileToSend($filename);
+		ob_start();
+		$this->_response->send();
+		$actual = ob_get_clean();
+		unset($_SERVER['HTTP_RANGE']);
+
+		$headers = $this->_response->getHeaders();
+		$this->assertEquals($actual, substr($expected, 6, 10));
+		$this->assertEquals($headers->get('Status'), '206 Partial Content');
+		$this->assertEquals($headers->get('Content-Range'), 'bytes 6-15/' . strlen($expected));
+		$this->assertEquals($headers->get('Content-Length'), 10);
+
+		$response = new Phalcon\Http\Response();
+		$_SERVER['HTTP_RANGE'] = 'bytes=-5';
+		$response->setFileToSend($filename);
+		ob_start();
+		$response->send();
+		$actual = ob_get_clean();
+		unset($_SERVER['HTTP_RANGE']);
+		$this->assertEquals($actual, substr($expected, -5));
+
+		$response = new Phalcon\Http\Response();
+		$_SERVER['HTTP_RANGE'] = 'bytes=' . strlen($expected) . '-';
+		$response->setFileToSend($filename);
+		ob_start();
+		$response->send();
+		$actual = ob_get_clean();
+		unset($_SERVER['HTTP_RANGE']);
+		$this->assertEquals($actual, '');
+		$this->assertEquals($response->getHeaders()->get('Status'), '416 Requested range not satisfiable');
+	}
+
+	public function testSetFileToSendNotModified()
+	{
+		$filename = __FILE__;
+		$etag = '"' . dechex(filemtime($filename)) . '-' . dechex(filesize($filename)) . '"';
+
+		$_SERVER['HTTP_IF_NONE_MATCH'] = 'W/"other", ' . $etag;
+		$this->_response->setFileToSend($filename);
+		ob_start();
+		$this->_response->send();
+		$actual = ob_get_clean();
+		unset($_SERVER['HTTP_IF_NONE_MATCH']);
+
+		$this->assertEquals($actual, '');
+		$this->assertEquals($this->_response->getHeaders()->get('Etag'), $etag);
+		$this->assertEquals($this->_response->getHeaders()->get('Status'), '304 Not modified');
+
+		$response = new Phalcon\Http\Response();
+		$_SERVER['HTTP_IF_MODIFIED_SINCE'] = gmdate('D, d M Y H:i:s', filemtime($filename) - 60) . ' GMT';
+		$response->setFileToSend($filename);
+		ob_start();
+		$response->send();
+		$actual = ob_get_clean();
+		unset($_SERVER['HTTP_IF_MODIFIED_SINCE']);
+
+		$this->assertEquals($actual, file_get_contents($filename));
+		$this->assertEquals($response->getHeaders()->get('Content-Length'), filesize($filename));
+	}
+
+	public function testSetFileOffload()
+	{
+		$filename = __FILE__;
+
+		$this->_response->setFileToSend($filename);
+		$this->_response->setFileOffload('X-Accel-Redirect', dirname($filename) . '/', '/protected/');
+		ob_start();
+		$this->_response->send();
+		$actual = ob_get_clean();
+
+		$this->assertEquals($actual, '');
+		$this->assertEquals($this->_response->getHeaders()->get('X-Accel-Redirect'), '/protected/' . basename($filename));
+	}
+
 	public function testMultipleHttpHeadersBug1892()
 	{
 		$this->_response->resetHeaders();
@@ -42,6 +42,49 @@ class TranslateTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($expected, $actual);
 	}
 
+	public function testInterpolationSinglePass()
+	{
+		$t = new \Phalcon\Translate\Adapter\NativeArray(array(
+			'content' => array('Hello %fname% %lname%!' => 'Hola %fname% %lname%!')
+		));
+
+		//Substituted values are not scanned again
+		$actual = $t->_('Hello %fname% %lname%!', array('fname' => '%lname%', 'lname' => 'Doe'));
+		$this->assertEquals('Hola %lname% Doe!', $actual);
+	}
+
+	public function testCsvCompiled()
+	{
+		$csvFile      = sys_get_temp_dir() . DIRECTORY_SEPARATOR . 'phalcon-translate-test.csv';
+		$compiledPath = sys_get_temp_dir() . DIRECTORY_SEPARATOR;
+
+		file_put_contents($csvFile, "# comment\n\"Hello!\";\"Hola!\"\n\"Bye %name%\";\"Adios %name%\"\n");
+		touch($csvFile, time() - 10);
+
+		$compiledFile = $compiledPath . strtolower(str_replace(array('/', '\\', ':'), '_', $csvFile)) . '.php';
+		@unlink($compiledFile);
+
+		$t = new \Phalcon\Translate\Adapter\Csv(array('content' => $csvFile, 'compiledPath' => $compiledPath));
+		$this->assertTrue(file_exists($compiledFile));
+		$this->assertEquals('Hola!', $t['Hello!']);
+		$this->assertEquals('Adios Phalcon', $t->_('Bye %name%', array('name' => 'Phalcon')));
+		$this->assertFalse(isset($t['# comment']));
+
+		//The compiled catalogue is used while the CSV isn't modified
+		$this->assertEquals(require $compiledFile, array('Hello!' => 'Hola!', 'Bye %name%' => 'Adios %name%'));
+
+		//Modifying the CSV recompiles the catalogue
+		file_put_contents($csvFile, "\"Hello!\";\"Buenas!\"\n");
+		touch($csvFile, time() + 10);
+
+		$t = new \Phalcon\Translate\Adapter\Csv(array('content' => $csvFile, 'compiledPath' => $compiledPath));
+		$this->assertEquals('Buenas!', $t['Hello!']);
+		$this->assertFalse($t->exists('Bye %name%'));
+
+		@unlink($compiledFile);
+		@unlink($csvFile);
+	}
+
 	public function testGettextTranslate()
 	{
 		$t = new Gettext(array(
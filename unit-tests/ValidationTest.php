@@ -29,7 +29,8 @@ use Phalcon\Validation\Validator\PresenceOf,
 	Phalcon\Validation\Validator\Between,
 	Phalcon\Validation\Validator\Url,
 	Phalcon\Validation\Validator\CreditCard,
-	Phalcon\Validation\Validator\Date;
+	Phalcon\Validation\Validator\Date,
+	Phalcon\Validation\Validator\Uniqueness;
 
 class ValidationTest extends PHPUnit_Framework_TestCase
 {
@@ -1136,6 +1137,97 @@ class ValidationTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($expectedMessages, $messages);
 	}
 
+	public function testValidationMultiple()
+	{
+		$validation = new Phalcon\Validation();
+
+		$validation->setDI(new Phalcon\DI\FactoryDefault());
+
+		$validation
+			->add('name', new PresenceOf(array(
+				'message' => 'The name is required',
+				'cancelOnFail' => true
+			)))
+			->add('name', new StringLength(array(
+				'min' => 3,
+				'max' => 8
+			)))
+			->add('email', new Email())
+			->add('type', new InclusionIn(array(
+				'domain' => array('A', 'B'),
+				'allowEmpty' => true
+			)))
+			->add('code', new Identical(array(
+				'accepted' => 'x'
+			)));
+
+		$validation->setFilters('name', 'trim');
+
+		$rows = array(
+			10 => array('name' => 'peter', 'email' => 'peter@example.com', 'type' => 'A', 'code' => 'x'),
+			11 => array('name' => '   ', 'email' => 'nope', 'type' => 'C', 'code' => 'y'),
+			12 => array('name' => ' jo ', 'email' => 'jo@example.com', 'type' => '', 'code' => 'x'),
+			13 => array('name' => 'elizabeth', 'email' => 'liz@example.com', 'code' => 'x')
+		);
+
+		$messages = $validation->validateMultiple($rows);
+
+		$this->assertEquals(array_keys($messages), array(11, 12, 13));
+
+		foreach ($messages as $key => $rowMessages) {
+			$this->assertEquals($rowMessages, $validation->validate($rows[$key]));
+		}
+
+		$this->assertEquals(count($messages[11]), 1);
+		$this->assertEquals($messages[11][0]->getMessage(), 'The name is required');
+		$this->assertEquals($messages[12][0]->getType(), 'TooShort');
+		$this->assertEquals($messages[12][0]->getMessage(), 'Field name must be at least 3 characters long');
+		$this->assertEquals($messages[13][0]->getType(), 'TooLong');
+
+		//A previously bound entity isn't validated instead of the rows
+		$validation->bind((object) array('name' => 'peter', 'email' => 'peter@example.com', 'type' => 'A', 'code' => 'y'), array());
+		$this->assertEquals(array_keys($validation->validateMultiple($rows)), array(11, 12, 13));
+	}
+
+	public function testValidationMultipleUniquenessMysql()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped('Test skipped');
+			return;
+		}
+
+		require_once 'unit-tests/models/Robots.php';
+
+		Phalcon\DI::reset();
+
+		$di = new Phalcon\DI\FactoryDefault();
+
+		$di->set('db', function(){
+			require 'unit-tests/config.db.php';
+			return new Phalcon\Db\Adapter\Pdo\Mysql($configMysql);
+		}, true);
+
+		$validation = new Phalcon\Validation();
+		$validation->setDI($di);
+
+		$validation->add('name', new Uniqueness(array(
+			'model' => 'Robots'
+		)));
+
+		//Values differing in case are duplicated for the collation of the column
+		$rows = array(
+			array('name' => 'Robotina'),
+			array('name' => 'TERMINATOR'),
+			array('name' => 'Optimus')
+		);
+
+		$messages = $validation->validateMultiple($rows);
+
+		$this->assertEquals(array_keys($messages), array(0, 1));
+		$this->assertEquals($messages[1][0]->getType(), 'Uniqueness');
+	}
+
 	public function testGetDefaultValidationMessageShouldReturnEmptyStringIfNoneIsSet()
 	{
 		$validation = new \Phalcon\Validation();
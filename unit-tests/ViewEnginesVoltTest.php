@@ -88,6 +88,33 @@ function phalcon_prepare_virtual_path($path, $separator) {
 	return $virtual_str;
 }
 
+/**
+ * A cache that only implements the backend interface
+ */
+class InterfaceOnlyCache implements Phalcon\Cache\BackendInterface
+{
+	private $_backend;
+
+	public function __construct()
+	{
+		$this->_backend = new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Output(array('lifetime' => 60)));
+	}
+
+	public function start($keyName, $lifetime = null) { return $this->_backend->start($keyName, $lifetime); }
+	public function stop($stopBuffer = true) { return $this->_backend->stop($stopBuffer); }
+	public function getFrontend() { return $this->_backend->getFrontend(); }
+	public function getOptions() { return $this->_backend->getOptions(); }
+	public function isFresh() { return $this->_backend->isFresh(); }
+	public function isStarted() { return $this->_backend->isStarted(); }
+	public function setLastKey($lastKey) { return $this->_backend->setLastKey($lastKey); }
+	public function getLastKey() { return $this->_backend->getLastKey(); }
+	public function get($keyName, $lifetime = null) { return $this->_backend->get($keyName, $lifetime); }
+	public function save($keyName = null, $content = null, $lifetime = null, $stopBuffer = true) { return $this->_backend->save($keyName, $content, $lifetime, $stopBuffer); }
+	public function delete($keyName) { return $this->_backend->delete($keyName); }
+	public function queryKeys($prefix = null) { return $this->_backend->queryKeys($prefix); }
+	public function exists($keyName = null, $lifetime = null) { return $this->_backend->exists($keyName, $lifetime); }
+}
+
 class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 {
 
@@ -566,6 +593,16 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue(is_array($intermediate));
 		$this->assertEquals(count($intermediate), 1);
 
+		$intermediate = $volt->parse('{% cache "sidebar" tags ["user:42", "posts"] %} hello {% endcache %}');
+		$this->assertTrue(is_array($intermediate));
+		$this->assertEquals(count($intermediate), 1);
+		$this->assertTrue(isset($intermediate[0]['tags']));
+
+		$intermediate = $volt->parse('{% cache "sidebar" 500 tags userTags %} hello {% endcache %}');
+		$this->assertTrue(is_array($intermediate));
+		$this->assertEquals(count($intermediate), 1);
+		$this->assertEquals($intermediate[0]['lifetime']['value'], '500');
+
 		//Mixed
 		$intermediate = $volt->parse('{# some comment #}{{ "hello" }}{# other comment }}');
 		$this->assertTrue(is_array($intermediate));
@@ -647,6 +684,14 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 			$this->assertEquals($e->getMessage(), 'Syntax error, unexpected token IDENTIFIER(y) in eval code on line 8');
 		}
 
+		try {
+			$volt->parse('{% cache "sidebar" labels ["posts"] %} hello {% endcache %}');
+			$this->assertTrue(false);
+		}
+		catch (Phalcon\Mvc\View\Exception $e){
+			$this->assertEquals($e->getMessage(), 'Syntax error, unexpected token IDENTIFIER(labels) in eval code on line 1');
+		}
+
 		try {
 			$volt->parse('{# Hello #}
 
@@ -873,6 +918,9 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$compilation = $volt->compileString("{{ get_content() }}");
 		$this->assertEquals($compilation, '<?php echo $this->getContent(); ?>');
 
+		$compilation = $volt->compileString("{{ flush() }}");
+		$this->assertEquals($compilation, '<?php echo $this->flush(); ?>');
+
 		$compilation = $volt->compileString("{{ partial('hello/x') }}");
 		$this->assertEquals($compilation, '<?php echo $this->partial(\'hello/x\'); ?>');
 
@@ -930,14 +978,18 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($compilation, '<?php echo Phalcon\Text::lower(\'hello\'); ?>');
 
 		$compilation = $volt->compileString('{{ ("hello" ~ "lol")|e|length }}');
-		$this->assertEquals($compilation, '<?php echo $this->length($this->escaper->escapeHtml((\'hello\' . \'lol\'))); ?>');
+		$strlen = function_exists('mb_strlen') ? 'mb_strlen' : 'strlen';
+		$this->assertEquals($compilation, '<?php echo ((is_array(($__t1 = $this->escaper->escapeHtml((\'hello\' . \'lol\')))) || is_object($__t1)) ? count($__t1) : ' . $strlen . '($__t1)); ?>');
 
 		//Filters with parameters
 		$compilation = $volt->compileString('{{ "My name is %s, %s"|format(name, "thanks") }}');
 		$this->assertEquals($compilation, "<?php echo sprintf('My name is %s, %s', \$name, 'thanks'); ?>");
 
 		$compilation = $volt->compileString('{{ "some name"|convert_encoding("utf-8", "latin1") }}');
-		$this->assertEquals($compilation, "<?php echo \$this->convertEncoding('some name', 'utf-8', 'latin1'); ?>");
+		$this->assertEquals($compilation, "<?php echo utf8_decode('some name'); ?>");
+
+		$compilation = $volt->compileString('{{ "some name"|convert_encoding(from, to) }}');
+		$this->assertEquals($compilation, "<?php echo \$this->convertEncoding('some name', \$from, \$to); ?>");
 
 		//if statement
 		$compilation = $volt->compileString('{% if a==b %} hello {% endif %}');
@@ -1093,6 +1145,12 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$compilation = $volt->compileString('{% cache somekey 500 %} hello {% endcache %}');
 		$this->assertEquals($compilation, '<?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheKey[$somekey] = $_cache[$somekey]->start($somekey, 500); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($somekey, null, 500); } else { echo $_cacheKey[$somekey]; } ?>');
 
+		$compilation = $volt->compileString('{% cache "sidebar" tags ["user:42", "posts"] %} hello {% endcache %}');
+		$this->assertEquals($compilation, '<?php $this->prefetchFragments(array(array(\'sidebar\', array(\'user:42\', \'posts\'), null))); ?><?php $_cache[\'sidebar\'] = $this->di->get(\'viewCache\'); $_cacheFragment[\'sidebar\'] = $this->getFragmentKey(\'sidebar\', array(\'user:42\', \'posts\')); $_cacheKey[\'sidebar\'] = $this->startFragment($_cache[\'sidebar\'], $_cacheFragment[\'sidebar\']); if ($_cacheKey[\'sidebar\'] === null) { ?> hello <?php $_cache[\'sidebar\']->save($_cacheFragment[\'sidebar\']); } else { echo $_cacheKey[\'sidebar\']; } ?>');
+
+		$compilation = $volt->compileString('{% cache "footer" 500 %} bye {% endcache %}{% cache somekey tags ["post:" ~ id] %} hello {% endcache %}');
+		$this->assertEquals($compilation, '<?php $this->prefetchFragments(array(array(\'footer\', null, 500))); ?><?php $_cache[\'footer\'] = $this->di->get(\'viewCache\'); $_cacheKey[\'footer\'] = $this->startFragment($_cache[\'footer\'], \'footer\', 500); if ($_cacheKey[\'footer\'] === null) { ?> bye <?php $_cache[\'footer\']->save(\'footer\', null, 500); } else { echo $_cacheKey[\'footer\']; } ?><?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheFragment[$somekey] = $this->getFragmentKey($somekey, array(\'post:\' . $id)); $_cacheKey[$somekey] = $this->startFragment($_cache[$somekey], $_cacheFragment[$somekey]); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($_cacheFragment[$somekey]); } else { echo $_cacheKey[$somekey]; } ?>');
+
 		//Autoescape mode
 		$compilation = $volt->compileString('{{ "hello" }}{% autoescape true %}{{ "hello" }}{% autoescape false %}{{ "hello" }}{% endautoescape %}{{ "hello" }}{% endautoescape %}{{ "hello" }}');
 		$this->assertEquals($compilation, "<?php echo 'hello'; ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?>");
@@ -1107,6 +1165,129 @@ class ViewEnginesVoltTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($compilation, "<?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo 'hello'; ?><?php echo \$this->escaper->escapeHtml('hello'); ?><?php echo \$this->escaper->escapeHtml('hello'); ?>");
 	}
 
+	public function testVoltCompilerNativeHelpers()
+	{
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+
+		$strpos = function_exists('mb_strpos') ? 'mb_strpos' : 'strpos';
+		$substr = function_exists('mb_substr') ? 'mb_substr' : 'substr';
+
+		$compilation = $volt->compileString('{{ a in b }}');
+		$this->assertEquals($compilation, '<?php echo (is_array($b) ? in_array($a, $b) : (is_string($b) ? ' . $strpos . '($b, $a) !== false : $this->isIncluded($a, $b))); ?>');
+
+		$compilation = $volt->compileString('{{ a not in b.c }}');
+		$this->assertEquals($compilation, '<?php echo !(is_array(($__t1 = $b->c)) ? in_array($a, $__t1) : (is_string($__t1) ? ' . $strpos . '($__t1, $a) !== false : $this->isIncluded($a, $__t1))); ?>');
+
+		$compilation = $volt->compileString('{{ a[1:3] }}');
+		$this->assertEquals($compilation, '<?php echo (is_object($a) ? $this->slice($a, 1, 3) : (is_array($a) ? array_slice($a, 1, 3) : ' . $substr . '($a, 1, 3))); ?>');
+
+		$compilation = $volt->compileString('{{ a|slice(2) }}');
+		$this->assertEquals($compilation, '<?php echo (is_object($a) ? $this->slice($a, 2, null) : (is_array($a) ? array_slice($a, 2) : ' . $substr . '($a, 2))); ?>');
+
+		$compilation = $volt->compileString('{{ a[b:c] }}');
+		$this->assertEquals($compilation, '<?php echo $this->slice($a, $b, $c); ?>');
+
+		$compilation = $volt->compileString('{% macro hello(name) %}{{ name }}{% endmacro %}{{ hello("world") }}');
+		$this->assertContains('<?php echo (($__t1 = isset($this->_macros[\'hello\']) ? $this->_macros[\'hello\'] : null) ? $__t1(array(\'world\')) : $this->callMacro(\'hello\', array(\'world\'))); ?>', $compilation);
+
+		$compilation = $volt->compileString('{% macro hello(name, type) %}{{ name }}{% endmacro %}{{ hello("world", "type": "x") }}');
+		$this->assertContains('<?php echo (($__t1 = isset($this->_macros[\'hello\']) ? $this->_macros[\'hello\'] : null) ? $__t1(array(\'world\', \'type\' => \'x\')) : $this->callMacro(\'hello\', array(\'world\', \'type\' => \'x\'))); ?>', $compilation);
+
+		$compilation = $volt->compileString('{{ goodbye("world") }}');
+		$this->assertEquals($compilation, '<?php echo $this->callMacro(\'goodbye\', array(\'world\')); ?>');
+	}
+
+	public function testVoltCompilerOptimize()
+	{
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setUniquePrefix('t');
+		$volt->setOption('optimize', true);
+
+		//Constant folding
+		$compilation = $volt->compileString('Some = {{ 60 * 60 }} seconds');
+		$this->assertEquals($compilation, 'Some = 3600 seconds');
+
+		$compilation = $volt->compileString('{{ "a" ~ "b" ~ 10 }}');
+		$this->assertEquals($compilation, 'ab10');
+
+		$compilation = $volt->compileString('{{ (1 + 2) * 3 - -1 }}');
+		$this->assertEquals($compilation, '10');
+
+		$compilation = $volt->compileString('{{ " hello "|trim|upper }}');
+		$this->assertEquals($compilation, 'HELLO');
+
+		$compilation = $volt->compileString('{{ 10 / 4 }}');
+		$this->assertEquals($compilation, '<?php echo 2.5; ?>');
+
+		$compilation = $volt->compileString('{% set a = 2 * 3 %}');
+		$this->assertEquals($compilation, '<?php $a = 6; ?>');
+
+		//Output coalescing
+		$compilation = $volt->compileString('<p>{{ a }} and {{ b }}</p>');
+		$this->assertEquals($compilation, '<p><?php echo $a, \' and \', $b; ?></p>');
+
+		$compilation = $volt->compileString("{{ a }}\n{{ b }}\n</p>");
+		$this->assertEquals($compilation, '<?php echo $a, $b; ?></p>');
+
+		//Literals that would open a PHP tag aren't written as raw text
+		$compilation = $volt->compileString('{{ \'<?xml version="1.0"?>\' }}');
+		$this->assertEquals($compilation, '<?php echo \'<?xml version="1.0"?>\'; ?>');
+
+		$compilation = $volt->compileString('<{{ "?php" }}');
+		$this->assertEquals($compilation, '<<?php echo \'?php\'; ?>');
+
+		//Loop-invariant expressions
+		$compilation = $volt->compileString('{% for item in items %}{{ item ~ (prefix|upper) }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php $t1hoisted = false; foreach ($items as $item) { if (!$t1hoisted) { $__h1 = (Phalcon\Text::upper($prefix)); $t1hoisted = true; } ?><?php echo $item . $__h1; ?><?php } ?>');
+
+		$compilation = $volt->compileString('{% for item in items %}{% set total = total + 1 %}{{ total * 2 }}{% endfor %}');
+		$this->assertEquals($compilation, '<?php foreach ($items as $item) { ?><?php $total = $total + 1; ?><?php echo $total * 2; ?><?php } ?>');
+
+		//Every compilation numbers its temporaries again
+		$compilation = $volt->compileString('{% for item in items %}{{ item ~ (prefix|upper) }}{% endfor %}');
+		$this->assertContains('$__h1 = (Phalcon\Text::upper($prefix));', $compilation);
+
+		//Included templates share the variables of the loop
+		$compilation = $volt->compileString('{% for item in items %}{% include partial %}{{ item ~ (prefix|upper) }}{% endfor %}');
+		$this->assertNotContains('$__h', $compilation);
+
+		//Escaped output isn't merged
+		$volt->setOption('autoescape', true);
+		$compilation = $volt->compileString('{{ "a" }}{{ "b" }}');
+		$this->assertEquals($compilation, "<?php echo \$this->escaper->escapeHtml('a'); ?><?php echo \$this->escaper->escapeHtml('b'); ?>");
+	}
+
+	public function testVoltCompilerInlineIncludes()
+	{
+		file_put_contents('unit-tests/cache/inline-card.volt', '<b>{{ title }}</b>');
+		file_put_contents('unit-tests/cache/inline-list.volt', '{% for tag in tags %}{{ loop.index }}{% endfor %}');
+		file_put_contents('unit-tests/cache/inline-box.volt', '{% include "unit-tests/cache/inline-card.volt" with ["title": name] %}{{ name }}');
+
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setUniquePrefix('t');
+		$volt->setOption('inlineIncludes', true);
+
+		$compilation = $volt->compileString('{% for item in items %}{% include "unit-tests/cache/inline-card.volt" with ["title": item] %}{% endfor %}');
+		$this->assertEquals($compilation, '<?php foreach ($items as $item) { ?><?php $__o1 = compact(\'title\'); extract(array(\'title\' => $item)); ?><b><?php echo $title; ?></b><?php unset($title); extract($__o1); ?><?php } ?>');
+		$this->assertEquals($volt->getDependencies(), array('unit-tests/cache/inline-card.volt' => 'include'));
+
+		//Loops of the included template are nested in the current loop
+		$compilation = $volt->compileString('{% for item in items %}{{ loop.index }}{% include "unit-tests/cache/inline-list.volt" %}{% endfor %}');
+		$this->assertContains('<?php echo $t1loop->index; ?>', $compilation);
+		$this->assertContains('<?php echo $t2loop->index; ?>', $compilation);
+
+		//Nested includes restore their variables from different temporaries
+		$volt = new \Phalcon\Mvc\View\Engine\Volt\Compiler();
+		$volt->setOption('inlineIncludes', true);
+
+		$compilation = $volt->compileString('{% include "unit-tests/cache/inline-box.volt" with ["name": a] %}{% include "unit-tests/cache/inline-card.volt" with ["title": b] %}');
+		$this->assertEquals($compilation, '<?php $__o1 = compact(\'name\'); extract(array(\'name\' => $a)); ?><?php $__o2 = compact(\'title\'); extract(array(\'title\' => $name)); ?><b><?php echo $title; ?></b><?php unset($title); extract($__o2); ?><?php echo $name; ?><?php unset($name); extract($__o1); ?><?php $__o3 = compact(\'title\'); extract(array(\'title\' => $b)); ?><b><?php echo $title; ?></b><?php unset($title); extract($__o3); ?>');
+
+		//Parameters that aren't an array literal are passed to the view
+		$compilation = $volt->compileString('{% include "unit-tests/cache/inline-card.volt" with params %}');
+		$this->assertEquals($compilation, '<?php $this->partial(\'unit-tests/cache/inline-card.volt\', $params); ?>');
+	}
+
 	public function testVoltUsersFunctions()
 	{
 
@@ -1262,6 +1443,66 @@ Clearly, the song is: <?php echo $this->getContent(); ?>.
 
 	}
 
+	public function testVoltCompilerManifest()
+	{
+
+		$manifest = 'unit-tests/cache/volt.manifest';
+		$layout = 'unit-tests/cache/manifest-layout.volt';
+		$child = 'unit-tests/cache/manifest-child.volt';
+
+		@unlink($manifest);
+		@unlink($child . '.php');
+		@unlink($layout . '%%e%%.php');
+		Compiler::clearManifests();
+
+		file_put_contents($layout, '[{% block body %}{% endblock %}]');
+		file_put_contents($child, "{% extends '" . $layout . "' %}{% block body %}child{% endblock %}");
+
+		$volt = new Compiler();
+		$volt->setOptions(array('manifest' => $manifest));
+
+		$volt->compile($child);
+		$this->assertEquals(file_get_contents($child . '.php'), '[child]');
+		$this->assertEquals($volt->getDependencies(), array($layout => 'extends'));
+
+		$entries = unserialize(file_get_contents($manifest));
+		$this->assertEquals($entries[$child . '.php']['dependencies'], array($layout => 'extends'));
+		$this->assertEquals($entries[$child . '.php']['mtimes'], array($child => filemtime($child), $layout => filemtime($layout)));
+
+		//The sources are only checked once per request
+		file_put_contents($layout, '<{% block body %}{% endblock %}>');
+		touch($layout, time() + 10);
+
+		$volt = new Compiler();
+		$volt->setOptions(array('manifest' => $manifest));
+
+		$volt->compile($child);
+		$this->assertEquals(file_get_contents($child . '.php'), '[child]');
+
+		//Changing the layout recompiles the templates extending it
+		Compiler::clearManifests();
+
+		$volt = new Compiler();
+		$volt->setOptions(array('manifest' => $manifest));
+
+		$volt->compile($child);
+		$this->assertEquals(file_get_contents($child . '.php'), '<child>');
+		$this->assertEquals($volt->getDependencies(), array($layout => 'extends'));
+
+		//Without stat the manifest is trusted
+		file_put_contents($layout, '({% block body %}{% endblock %})');
+		touch($layout, time() + 20);
+		Compiler::clearManifests();
+
+		$volt = new Compiler();
+		$volt->setOptions(array('manifest' => $manifest, 'stat' => false));
+
+		$volt->compile($child);
+		$this->assertEquals(file_get_contents($child . '.php'), '<child>');
+		$this->assertEquals($volt->getDependencies(), array($layout => 'extends'));
+
+	}
+
 	public function testVoltCompilerFileOptions()
 	{
 
@@ -1292,6 +1533,110 @@ Clearly, the song is: <?php echo $this->getContent(); ?>.
 
 	}
 
+	public function testVoltEngineTaggedFragments()
+	{
+		$di = new Phalcon\DI();
+		$di->setShared('viewCache', function() {
+			return new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Output(array('lifetime' => 60)));
+		});
+
+		$view = new Phalcon\Mvc\View();
+		$view->setDI($di);
+
+		$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+		$volt->setOptions(array(
+			"compiledPath" => "unit-tests/cache/",
+			"compiledSeparator" => "."
+		));
+
+		$template = 'unit-tests/cache/fragments.volt';
+		file_put_contents($template, '{% cache "sidebar" tags ["user:42", "posts"] %}[{{ name }}]{% endcache %}{% cache "footer" tags ["posts"] %}({{ name }}){% endcache %}');
+
+		$view->start();
+		$volt->render($template, array('name' => 'first'), true);
+		$view->finish();
+		$this->assertEquals($view->getContent(), '[first](first)');
+
+		//Both fragments are served from the cache
+		$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+		$volt->setOptions(array(
+			"compiledPath" => "unit-tests/cache/",
+			"compiledSeparator" => "."
+		));
+
+		$view->start();
+		$volt->render($template, array('name' => 'second'), true);
+		$view->finish();
+		$this->assertEquals($view->getContent(), '[first](first)');
+
+		//Invalidating a tag only renders the fragments tagged with it again
+		$cache = $di->get('viewCache');
+		$cache->invalidateTags(array('user:42'));
+
+		$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+		$volt->setOptions(array(
+			"compiledPath" => "unit-tests/cache/",
+			"compiledSeparator" => "."
+		));
+
+		$view->start();
+		$volt->render($template, array('name' => 'third'), true);
+		$view->finish();
+		$this->assertEquals($view->getContent(), '[third](first)');
+
+		$versions = $cache->getTagVersions(array('user:42', 'posts'));
+		$this->assertEquals(array_keys($versions), array('user:42', 'posts'));
+		$this->assertEquals($volt->getFragmentKey('footer', array('posts')), 'footer_' . md5(serialize(array('posts' => $versions['posts']))));
+
+		//The versions read by a render aren't used by the next one
+		$cache->invalidateTags(array('posts'));
+
+		$view->start();
+		$volt->render($template, array('name' => 'fourth'), true);
+		$view->finish();
+		$this->assertEquals($view->getContent(), '[fourth](fourth)');
+
+		@unlink($template);
+	}
+
+	public function testVoltEngineFragmentsInterfaceOnlyCache()
+	{
+		$di = new Phalcon\DI();
+		$di->setShared('viewCache', function() {
+			return new InterfaceOnlyCache();
+		});
+
+		$view = new Phalcon\Mvc\View();
+		$view->setDI($di);
+
+		$template = 'unit-tests/cache/fragments-interface.volt';
+		file_put_contents($template, '{% cache "footer" %}({{ name }}){% endcache %}');
+
+		//Literal keys are read with start() when the backend can't fetch several keys at once
+		foreach (array('first', 'second') as $name) {
+
+			$volt = new Phalcon\Mvc\View\Engine\Volt($view, $di);
+			$volt->setOptions(array(
+				"compiledPath" => "unit-tests/cache/",
+				"compiledSeparator" => "."
+			));
+
+			$view->start();
+			$volt->render($template, array('name' => $name), true);
+			$view->finish();
+			$this->assertEquals($view->getContent(), '(first)');
+		}
+
+		try {
+			$volt->getFragmentKey('footer', array('posts'));
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\View\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Cache fragments with tags require a cache backend extending Phalcon\\Cache\\Backend');
+		}
+
+		@unlink($template);
+	}
+
 	public function testVoltEngine()
 	{
 
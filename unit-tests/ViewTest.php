@@ -130,6 +130,45 @@ class ViewTest extends PHPUnit_Framework_TestCase
 		$this->assertFalse($view->exists('does_not_exist'));
 	}
 
+	public function testPathCache()
+	{
+		View::resetPathCache();
+
+		$view = new View(array('pathCache' => array('size' => 2, 'stamp' => 'v1')));
+		$view->setBasePath(__DIR__.'/../');
+		$view->setViewsDir('unit-tests/views/');
+
+		$this->assertTrue($view->exists('test2/index'));
+		$this->assertTrue($view->exists('test2/index'));
+		$this->assertFalse($view->exists('does_not_exist'));
+		$this->assertFalse($view->exists('does_not_exist'));
+
+		$stats = View::getPathCacheStats();
+		$this->assertEquals(2, $stats['hits']);
+		$this->assertEquals(2, $stats['misses']);
+		$this->assertEquals(2, $stats['entries']);
+
+		$this->assertTrue($view->exists('test3/other'));
+		$stats = View::getPathCacheStats();
+		$this->assertEquals(1, $stats['evictions']);
+		$this->assertEquals(2, $stats['entries']);
+
+		$view->start();
+		$view->render('test2', 'index');
+		$view->finish();
+		$this->assertEquals($view->getContent(), '<html>here</html>' . PHP_EOL);
+
+		$view = new View(array('pathCache' => array('stamp' => 'v2')));
+		$view->setBasePath(__DIR__.'/../');
+		$view->setViewsDir('unit-tests/views/');
+		$this->assertTrue($view->exists('test2/index'));
+
+		$stats = View::getPathCacheStats();
+		$this->assertEquals(1, $stats['entries']);
+
+		View::resetPathCache();
+	}
+
 	public function testStandardRender()
 	{
 
@@ -376,6 +415,71 @@ class ViewTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($view->getContent(), '<div class="action">Action</div>');
 	}
 
+	public function testStreamingRender()
+	{
+		$view = new View();
+		$view->setBasePath(__DIR__.'/../');
+		$view->setViewsDir('unit-tests/views/');
+
+		$this->assertFalse($view->isStreaming());
+		$view->setStreaming(true);
+		$this->assertTrue($view->isStreaming());
+
+		//The output is captured in chunks to check when it was flushed
+		$chunks = array();
+		ob_start(function ($chunk) use (&$chunks) {
+			if ($chunk !== '') {
+				$chunks[] = $chunk;
+			}
+			return '';
+		});
+
+		$view->start();
+		$view->render('test3', 'other');
+		$view->finish();
+
+		$view->setTemplateAfter('after');
+		$view->setTemplateBefore('before');
+
+		$view->start();
+		$view->render('test13', 'index');
+		$view->finish();
+
+		$view->cleanTemplateAfter();
+		$view->cleanTemplateBefore();
+
+		$view->disableLevel(View::LEVEL_MAIN_LAYOUT);
+
+		$view->start();
+		$view->render('test3', 'other');
+		$view->finish();
+
+		ob_end_flush();
+
+		//The layout head is flushed before the lower stages are rendered
+		$this->assertEquals($chunks, array(
+			'<html>',
+			'lolhere</html>' . PHP_EOL,
+			'<html>',
+			'<div class="after-layout"><div class="controller-layout"><div class="before-layout"><div class="action">Action</div></div></div></div></html>' . PHP_EOL,
+			'lol',
+			'here'
+		));
+
+		//The content was already sent
+		$this->assertEquals($view->getContent(), '');
+
+		//Flushing is ignored when the view isn't streaming
+		ob_start();
+		echo 'buffered';
+		$view->flush();
+		$this->assertEquals(ob_get_clean(), 'buffered');
+
+		//getRender() always buffers
+		$view->disableLevel(array());
+		$this->assertEquals($view->getRender('test3', 'other'), '<html>lolhere</html>' . PHP_EOL);
+	}
+
 	/**
 	 * @covers \Phalcon\Mvc\View::getActiveRenderPath
 	 */